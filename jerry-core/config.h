@@ -113,6 +113,46 @@
  */
 // #define CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
 
+/**
+ * Number of entries in the number to string conversion cache of property names
+ * (at most 65536, 0 disables the cache)
+ */
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE
+# define CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE (32)
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE */
+
+/**
+ * Number of entries in the cache of enumerable property names used by for-in and Object.keys
+ * (at most 65536, 0 disables the cache)
+ */
+#ifndef CONFIG_ECMA_ENUM_CACHE_SIZE
+# define CONFIG_ECMA_ENUM_CACHE_SIZE (16)
+#endif /* !CONFIG_ECMA_ENUM_CACHE_SIZE */
+
+/**
+ * Default capacity of the RegExp bytecode cache (can be changed with jerry_set_regexp_cache_size)
+ *
+ * Note:
+ *      the capacity is at most 1024 (RE_CACHE_MAX_SIZE), larger values are rejected at build time
+ */
+#ifndef CONFIG_REGEXP_CACHE_SIZE
+# define CONFIG_REGEXP_CACHE_SIZE (8)
+#endif /* !CONFIG_REGEXP_CACHE_SIZE */
+
+/**
+ * Capacity of the compiled code cache of eval and jerry_parse (0 disables the cache)
+ */
+#ifndef CONFIG_PARSER_CACHE_SIZE
+# define CONFIG_PARSER_CACHE_SIZE (8)
+#endif /* !CONFIG_PARSER_CACHE_SIZE */
+
+/**
+ * Byte code of source codes longer than this limit is not cached
+ */
+#ifndef CONFIG_PARSER_CACHE_MAX_SOURCE_SIZE
+# define CONFIG_PARSER_CACHE_MAX_SOURCE_SIZE (4096)
+#endif /* !CONFIG_PARSER_CACHE_MAX_SOURCE_SIZE */
+
 /**
  * Share of newly allocated since last GC objects among all currently allocated objects,
  * after achieving which, GC is started upon low severity try-give-memory-back requests.
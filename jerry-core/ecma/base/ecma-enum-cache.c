@@ -0,0 +1,490 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-enum-cache.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaenumcache Enumerable property names cache
+ * @{
+ *
+ * The enumerable property names of an object only depend on the named properties
+ * of the object and its prototypes, unless the object has lazy instantiated
+ * properties. The names are cached together with this layout: the name and the
+ * enumerable flag of each named property in the order of the property lists.
+ * An object which has the same layout as a cached entry shares its names.
+ *
+ * The layout holds a reference to its property names, so their compressed
+ * pointers cannot be reused by other strings while the entry is alive.
+ */
+
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_ENUM_CACHE_SIZE <= 65536,
+                     enum_cache_size_must_be_less_than_or_equal_to_65536);
+
+/**
+ * Objects with longer layouts are not cached
+ */
+#define ECMA_ENUM_CACHE_MAX_LAYOUT_COUNT 1024
+
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
+
+/**
+ * Calculate the size of an enumeration cache entry
+ *
+ * @return size in bytes
+ */
+static inline size_t __attr_always_inline___
+ecma_enum_cache_entry_size (uint32_t name_count, /**< number of property names */
+                            uint32_t layout_count) /**< number of layout items */
+{
+  return (sizeof (ecma_enum_cache_entry_t)
+          + name_count * sizeof (ecma_value_t)
+          + layout_count * sizeof (ecma_enum_cache_layout_item_t));
+} /* ecma_enum_cache_entry_size */
+
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+
+/**
+ * Get the layout of an enumeration cache entry
+ *
+ * @return pointer to the first layout item
+ */
+static inline ecma_enum_cache_layout_item_t * __attr_always_inline___
+ecma_enum_cache_entry_get_layout (ecma_enum_cache_entry_t *entry_p) /**< enumeration cache entry */
+{
+  return (ecma_enum_cache_layout_item_t *) (ECMA_ENUM_CACHE_ENTRY_GET_NAMES (entry_p) + entry_p->name_count);
+} /* ecma_enum_cache_entry_get_layout */
+
+/**
+ * Check whether the enumerable property names of the object are determined by its layout,
+ * that is, the object has no lazy instantiated properties.
+ *
+ * @return true - if the names of the object can be cached,
+ *         false - otherwise
+ */
+static bool
+ecma_enum_cache_is_cacheable (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_is_builtin (obj_p))
+  {
+    return false;
+  }
+
+  ecma_object_type_t type = ecma_get_object_type (obj_p);
+
+  return (type != ECMA_OBJECT_TYPE_FUNCTION && type != ECMA_OBJECT_TYPE_STRING);
+} /* ecma_enum_cache_is_cacheable */
+
+/**
+ * Get the first property pair of an object
+ *
+ * @return pointer to the property pair, or NULL if the object has no properties
+ */
+static ecma_property_header_t *
+ecma_enum_cache_get_first_property_pair (ecma_object_t *obj_p) /**< object */
+{
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
+  return prop_iter_p;
+} /* ecma_enum_cache_get_first_property_pair */
+
+/**
+ * Check whether a property is a named data or named accessor property
+ *
+ * @return true / false
+ */
+static inline bool __attr_always_inline___
+ecma_enum_cache_is_named_property (ecma_property_t *property_p) /**< property */
+{
+  return (ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          || ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+} /* ecma_enum_cache_is_named_property */
+
+/**
+ * Calculate the index of an object in the enumeration cache.
+ *
+ * The index is computed from the newest properties and the prototype of the object,
+ * so it does not need a walk over the whole layout.
+ *
+ * @return index of the cache entry
+ */
+static uint32_t
+ecma_enum_cache_index (ecma_object_t *obj_p, /**< object */
+                       bool is_with_prototype_chain) /**< names of the prototype chain are included */
+{
+  uint32_t hash = 0;
+
+  if (is_with_prototype_chain)
+  {
+    hash = (uint32_t) obj_p->prototype_or_outer_reference_cp + 1;
+  }
+
+  ecma_property_header_t *prop_iter_p = ecma_enum_cache_get_first_property_pair (obj_p);
+
+  if (prop_iter_p != NULL)
+  {
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      if (ecma_enum_cache_is_named_property (prop_iter_p->types + i))
+      {
+        hash = (hash ^ prop_pair_p->names_cp[i]) * 0x9e3779b1u;
+      }
+    }
+  }
+
+  hash *= 0x9e3779b1u;
+  return ((hash >> 16) * CONFIG_ECMA_ENUM_CACHE_SIZE) >> 16;
+} /* ecma_enum_cache_index */
+
+/**
+ * Count the layout items of an object, and optionally record them
+ *
+ * Note:
+ *      the recorded property names are referenced
+ *
+ * @return number of layout items
+ */
+static uint32_t
+ecma_enum_cache_record_layout (ecma_object_t *obj_p, /**< object */
+                               bool is_with_prototype_chain, /**< names of the prototype chain are included */
+                               ecma_enum_cache_layout_item_t *items_p) /**< [out] layout items, or NULL
+                                                                        *   if the items are only counted */
+{
+  uint32_t count = 0;
+
+  for (ecma_object_t *prototype_chain_iter_p = obj_p;
+       prototype_chain_iter_p != NULL;
+       prototype_chain_iter_p = is_with_prototype_chain ? ecma_get_object_prototype (prototype_chain_iter_p)
+                                                        : NULL)
+  {
+    if (prototype_chain_iter_p != obj_p)
+    {
+      if (items_p != NULL)
+      {
+        items_p[count].name_cp = JMEM_CP_NULL;
+        items_p[count].is_enumerable = false;
+      }
+      count++;
+    }
+
+    ecma_property_header_t *prop_iter_p = ecma_enum_cache_get_first_property_pair (prototype_chain_iter_p);
+
+    while (prop_iter_p != NULL)
+    {
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+      ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+      for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+      {
+        ecma_property_t *property_p = prop_iter_p->types + i;
+
+        if (ecma_enum_cache_is_named_property (property_p))
+        {
+          if (items_p != NULL)
+          {
+            ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[i]));
+            items_p[count].name_cp = prop_pair_p->names_cp[i];
+            items_p[count].is_enumerable = ecma_is_property_enumerable (property_p);
+          }
+          count++;
+        }
+      }
+
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+  }
+
+  return count;
+} /* ecma_enum_cache_record_layout */
+
+/**
+ * Check whether an object has the same layout as an enumeration cache entry
+ *
+ * @return true - if the layouts are the same,
+ *         false - otherwise
+ */
+static bool
+ecma_enum_cache_is_same_layout (ecma_enum_cache_entry_t *entry_p, /**< enumeration cache entry */
+                                ecma_object_t *obj_p) /**< object */
+{
+  ecma_enum_cache_layout_item_t *items_p = ecma_enum_cache_entry_get_layout (entry_p);
+  ecma_enum_cache_layout_item_t *items_end_p = items_p + entry_p->layout_count;
+
+  for (ecma_object_t *prototype_chain_iter_p = obj_p;
+       prototype_chain_iter_p != NULL;
+       prototype_chain_iter_p = entry_p->is_with_prototype_chain ? ecma_get_object_prototype (prototype_chain_iter_p)
+                                                                 : NULL)
+  {
+    if (prototype_chain_iter_p != obj_p)
+    {
+      if (items_p == items_end_p || items_p->name_cp != JMEM_CP_NULL)
+      {
+        return false;
+      }
+      items_p++;
+    }
+
+    ecma_property_header_t *prop_iter_p = ecma_enum_cache_get_first_property_pair (prototype_chain_iter_p);
+
+    while (prop_iter_p != NULL)
+    {
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+      ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+      for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+      {
+        ecma_property_t *property_p = prop_iter_p->types + i;
+
+        if (ecma_enum_cache_is_named_property (property_p))
+        {
+          if (items_p == items_end_p
+              || items_p->name_cp != prop_pair_p->names_cp[i]
+              || (items_p->is_enumerable != 0) != ecma_is_property_enumerable (property_p))
+          {
+            return false;
+          }
+          items_p++;
+        }
+      }
+
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+  }
+
+  return items_p == items_end_p;
+} /* ecma_enum_cache_is_same_layout */
+
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
+
+/**
+ * Get the enumerable property names of an object
+ *
+ * The names are taken from the enumeration cache if an entry has the same layout
+ * as the object, otherwise they are collected by ecma_op_object_get_property_names
+ * and the new entry is stored in the cache when the object is cacheable.
+ *
+ * @return pointer to the entry, which must be released with ecma_enum_cache_deref_entry
+ */
+ecma_enum_cache_entry_t *
+ecma_enum_cache_get_entry (ecma_object_t *obj_p, /**< object */
+                           bool is_with_prototype_chain) /**< true - list properties from prototype chain,
+                                                          *   false - list only own properties */
+{
+  JERRY_ASSERT (obj_p != NULL
+                && !ecma_is_lexical_environment (obj_p));
+
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+  bool is_cacheable = ecma_enum_cache_is_cacheable (obj_p);
+
+  if (is_cacheable)
+  {
+    uint32_t index = ecma_enum_cache_index (obj_p, is_with_prototype_chain);
+    jmem_cpointer_t entry_cp = JERRY_CONTEXT (ecma_enum_cache)[index];
+
+    if (entry_cp != JMEM_CP_NULL)
+    {
+      ecma_enum_cache_entry_t *entry_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_enum_cache_entry_t, entry_cp);
+
+      if (entry_p->is_with_prototype_chain == is_with_prototype_chain
+          && ecma_enum_cache_is_same_layout (entry_p, obj_p))
+      {
+#ifdef JMEM_STATS
+        JERRY_CONTEXT (ecma_enum_cache_stats).hits++;
+#endif /* JMEM_STATS */
+
+        entry_p->refs++;
+        return entry_p;
+      }
+    }
+
+#ifdef JMEM_STATS
+    JERRY_CONTEXT (ecma_enum_cache_stats).misses++;
+#endif /* JMEM_STATS */
+  }
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
+
+  ecma_collection_header_t *prop_names_p = ecma_op_object_get_property_names (obj_p,
+                                                                              false,
+                                                                              true,
+                                                                              is_with_prototype_chain);
+  uint32_t name_count = prop_names_p->unit_number;
+  uint32_t layout_count = 0;
+
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+  if (is_cacheable)
+  {
+    layout_count = ecma_enum_cache_record_layout (obj_p, is_with_prototype_chain, NULL);
+
+    if (layout_count > ECMA_ENUM_CACHE_MAX_LAYOUT_COUNT)
+    {
+      is_cacheable = false;
+      layout_count = 0;
+    }
+  }
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
+
+  ecma_enum_cache_entry_t *entry_p;
+  entry_p = (ecma_enum_cache_entry_t *) jmem_heap_alloc_block (ecma_enum_cache_entry_size (name_count, layout_count));
+
+  entry_p->refs = 1;
+  entry_p->name_count = name_count;
+  entry_p->layout_count = (uint16_t) layout_count;
+  entry_p->is_with_prototype_chain = is_with_prototype_chain;
+
+  ecma_value_t *names_p = ECMA_ENUM_CACHE_ENTRY_GET_NAMES (entry_p);
+
+  ecma_collection_iterator_t iter;
+  ecma_collection_iterator_init (&iter, prop_names_p);
+
+  while (ecma_collection_iterator_next (&iter))
+  {
+    *names_p++ = ecma_copy_value (*iter.current_value_p);
+  }
+
+  ecma_free_values_collection (prop_names_p, true);
+
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+  if (is_cacheable)
+  {
+    /* The allocation above may have released the cache, so the index is computed after it. */
+    uint32_t recorded_count = ecma_enum_cache_record_layout (obj_p,
+                                                             is_with_prototype_chain,
+                                                             ecma_enum_cache_entry_get_layout (entry_p));
+    JERRY_ASSERT (recorded_count == layout_count);
+    JERRY_UNUSED (recorded_count);
+
+    uint32_t index = ecma_enum_cache_index (obj_p, is_with_prototype_chain);
+    jmem_cpointer_t *entry_cp_p = JERRY_CONTEXT (ecma_enum_cache) + index;
+
+    if (*entry_cp_p != JMEM_CP_NULL)
+    {
+      ecma_enum_cache_entry_t *old_entry_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_enum_cache_entry_t, *entry_cp_p);
+      ecma_enum_cache_deref_entry (old_entry_p);
+    }
+
+    entry_p->refs++;
+    JMEM_CP_SET_NON_NULL_POINTER (*entry_cp_p, entry_p);
+  }
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
+
+  return entry_p;
+} /* ecma_enum_cache_get_entry */
+
+/**
+ * Decrease the reference counter of an enumeration cache entry,
+ * and free the entry when it is not referenced anymore.
+ */
+void
+ecma_enum_cache_deref_entry (ecma_enum_cache_entry_t *entry_p) /**< enumeration cache entry */
+{
+  JERRY_ASSERT (entry_p->refs > 0);
+
+  if (--entry_p->refs > 0)
+  {
+    return;
+  }
+
+  ecma_value_t *names_p = ECMA_ENUM_CACHE_ENTRY_GET_NAMES (entry_p);
+
+  for (uint32_t i = 0; i < entry_p->name_count; i++)
+  {
+    ecma_free_value (names_p[i]);
+  }
+
+  ecma_enum_cache_layout_item_t *items_p = (ecma_enum_cache_layout_item_t *) (names_p + entry_p->name_count);
+
+  for (uint32_t i = 0; i < entry_p->layout_count; i++)
+  {
+    if (items_p[i].name_cp != JMEM_CP_NULL)
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, items_p[i].name_cp));
+    }
+  }
+
+  jmem_heap_free_block (entry_p, ecma_enum_cache_entry_size (entry_p->name_count, entry_p->layout_count));
+} /* ecma_enum_cache_deref_entry */
+
+/**
+ * Release the entries of the enumeration cache.
+ */
+void
+ecma_enum_cache_free (void)
+{
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+  for (uint32_t i = 0; i < CONFIG_ECMA_ENUM_CACHE_SIZE; i++)
+  {
+    jmem_cpointer_t entry_cp = JERRY_CONTEXT (ecma_enum_cache)[i];
+
+    if (entry_cp != JMEM_CP_NULL)
+    {
+      ecma_enum_cache_entry_t *entry_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_enum_cache_entry_t, entry_cp);
+
+      JERRY_CONTEXT (ecma_enum_cache)[i] = JMEM_CP_NULL;
+      ecma_enum_cache_deref_entry (entry_p);
+    }
+  }
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
+} /* ecma_enum_cache_free */
+
+#ifdef JMEM_STATS
+
+/**
+ * Print the usage statistics of the enumeration cache
+ */
+void
+ecma_enum_cache_stats_print (void)
+{
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+  ecma_enum_cache_stats_t *stats_p = &JERRY_CONTEXT (ecma_enum_cache_stats);
+  uint32_t lookups = stats_p->hits + stats_p->misses;
+
+  JERRY_DEBUG_MSG ("Enumeration cache stats:\n"
+                   "  Hits = %u\n"
+                   "  Misses = %u\n"
+                   "  Hit ratio = %u%%\n"
+                   "\n",
+                   (unsigned int) stats_p->hits,
+                   (unsigned int) stats_p->misses,
+                   (unsigned int) (lookups > 0 ? (uint64_t) stats_p->hits * 100 / lookups : 0));
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
+} /* ecma_enum_cache_stats_print */
+
+#endif /* JMEM_STATS */
+
+/**
+ * @}
+ * @}
+ */
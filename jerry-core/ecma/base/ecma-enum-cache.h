@@ -0,0 +1,47 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_ENUM_CACHE_H
+#define ECMA_ENUM_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaenumcache Enumerable property names cache
+ * @{
+ */
+
+/**
+ * Get the property names of an enumeration cache entry
+ */
+#define ECMA_ENUM_CACHE_ENTRY_GET_NAMES(entry_p) ((ecma_value_t *) ((entry_p) + 1))
+
+extern ecma_enum_cache_entry_t *ecma_enum_cache_get_entry (ecma_object_t *, bool);
+extern void ecma_enum_cache_deref_entry (ecma_enum_cache_entry_t *);
+extern void ecma_enum_cache_free (void);
+
+#ifdef JMEM_STATS
+extern void ecma_enum_cache_stats_print (void);
+#endif /* JMEM_STATS */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_ENUM_CACHE_H */
@@ -19,16 +19,19 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-enum-cache.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "ecma-property-hashmap.h"
 #include "jcontext.h"
+#include "js-parser.h"
+#include "js-parser-cache.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
-#include "re-compiler.h"
+#include "re-cache.h"
 #include "vm-defines.h"
 #include "vm-stack.h"
 
@@ -603,6 +606,12 @@ ecma_free_unused_memory (jmem_free_unused_memory_severity_t severity) /**< sever
 
     /* Freeing as much memory as we currently can */
     ecma_gc_run (severity);
+
+    /* Drop the cached byte codes which are not used by any function */
+    parser_cache_free_unused ();
+    ecma_number_string_cache_free ();
+    ecma_enum_cache_free ();
+    parser_arena_free_unused ();
   }
 } /* ecma_free_unused_memory */
 
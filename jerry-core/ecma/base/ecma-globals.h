@@ -824,6 +824,8 @@ typedef enum
                                            *   maximum size is 2^16. */
   ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING, /**< actual data is on the heap as an utf-8 (cesu8) string
                                                 *   maximum size is 2^32. */
+  ECMA_STRING_CONTAINER_STATIC_UTF8_STRING, /**< actual data is an utf-8 (cesu8) string outside of the heap
+                                             *   (e.g. in a snapshot buffer), maximum size is 2^16. */
   ECMA_STRING_CONTAINER_UINT32_IN_DESC, /**< actual data is UInt32-represeneted Number
                                              stored locally in the string's descriptor */
   ECMA_STRING_CONTAINER_MAGIC_STRING, /**< the ecma-string is equal to one of ECMA magic strings */
@@ -912,6 +914,32 @@ typedef struct
   lit_utf8_size_t long_utf8_string_length; /**< length of this long utf-8 string in bytes */
 } ecma_long_string_t;
 
+/**
+ * Static ECMA string-value descriptor
+ *
+ * The characters are not copied, they must be available until the string is freed.
+ */
+typedef struct
+{
+  ecma_string_t header; /**< string header */
+  const lit_utf8_byte_t *chars_p; /**< characters of the string */
+} ecma_static_string_t;
+
+/**
+ * Initial size of the buffer of a string builder.
+ */
+#define ECMA_STRINGBUILDER_INITIAL_SIZE 32
+
+/**
+ * String builder, which collects the characters of a string into a growable buffer
+ */
+typedef struct
+{
+  lit_utf8_byte_t *buffer_p; /**< character buffer (NULL before the first append) */
+  lit_utf8_size_t size; /**< number of used bytes */
+  lit_utf8_size_t capacity; /**< size of the buffer */
+} ecma_stringbuilder_t;
+
 /**
  * Compiled byte code data.
  */
@@ -984,6 +1012,65 @@ typedef struct
 
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
+#if CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0
+
+/**
+ * Entry of the number to string conversion cache
+ */
+typedef struct
+{
+  ecma_number_t number; /**< cached number */
+  jmem_cpointer_t string_cp; /**< string representation of the number
+                              *   (ECMA_NULL_POINTER marks the entry empty) */
+} ecma_number_string_cache_entry_t;
+
+/**
+ * Usage statistics of the number to string conversion cache
+ */
+typedef struct
+{
+  uint32_t hits; /**< number of conversions found in the cache */
+  uint32_t misses; /**< number of conversions not found in the cache */
+} ecma_number_string_cache_stats_t;
+
+#endif /* CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0 */
+
+/**
+ * Enumerable property names of an object, which can be shared through the enumeration cache
+ *
+ * The header is followed by the property names (ecma_value_t) and the layout
+ * (ecma_enum_cache_layout_item_t) of the objects the names were collected from.
+ */
+typedef struct
+{
+  uint32_t refs; /**< reference counter */
+  uint32_t name_count; /**< number of property names */
+  uint16_t layout_count; /**< number of layout items */
+  uint16_t is_with_prototype_chain; /**< the names of the prototype chain are included */
+} ecma_enum_cache_entry_t;
+
+/**
+ * Named property of an object recorded in an enumeration cache entry
+ */
+typedef struct
+{
+  jmem_cpointer_t name_cp; /**< property name, JMEM_CP_NULL starts the properties of the next prototype */
+  uint8_t is_enumerable; /**< the property is enumerable */
+} ecma_enum_cache_layout_item_t;
+
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+
+/**
+ * Usage statistics of the enumeration cache
+ */
+typedef struct
+{
+  uint32_t hits; /**< number of enumerations found in the cache */
+  uint32_t misses; /**< number of enumerations not found in the cache */
+} ecma_enum_cache_stats_t;
+
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
+
 /**
  * @}
  * @}
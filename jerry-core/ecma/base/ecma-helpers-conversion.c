@@ -27,305 +27,241 @@
  *
  * \addtogroup ecmahelpers Helpers for operations with ECMA data types
  * @{
- *
- * \addtogroup ecmahelpersbigintegers Helpers for operations intermediate 128-bit integers
- * @{
  */
 
 /**
- * Check that parts of 128-bit integer are 32-bit.
+ * Maximum number of decimal digits which are collected into the significand
+ * of a decimal number (10^19 < 2^64)
  */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT(name) \
-{ \
-  JERRY_ASSERT (name[0] <= UINT32_MAX); \
-  JERRY_ASSERT (name[1] <= UINT32_MAX); \
-  JERRY_ASSERT (name[2] <= UINT32_MAX); \
-  JERRY_ASSERT (name[3] <= UINT32_MAX); \
-}
+#define ECMA_DECIMAL_SIGNIFICAND_DIGITS 19
 
 /**
- * Declare 128-bit integer.
+ * Limit of the exponent of a decimal number (greater exponents
+ * make the number zero or infinity anyway)
  */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER(name) uint64_t name[4] = { 0, 0, 0, 0 }
+#define ECMA_DECIMAL_EXPONENT_LIMIT 100000
 
 /**
- * Declare 128-bit in-out argument integer.
+ * Significand of a decimal number during parsing
  */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ARG(name) uint64_t name[4]
+typedef struct
+{
+  uint64_t significand; /**< first significant digits of the number */
+  uint32_t digits; /**< number of digits in the significand */
+  int32_t exponent; /**< decimal exponent of the last digit of the significand */
+  bool is_truncated; /**< true - if non-zero digits are dropped from the significand */
+  const lit_utf8_byte_t *digits_p; /**< first significant digit */
+} ecma_decimal_significand_t;
 
 /**
- * Initialize 128-bit integer with given 32-bit parts
+ * Load eight characters into a 64 bit integer, the first character is the lowest byte.
+ *
+ * Note:
+ *      the compiler merges the byte loads into a single load on little endian targets
+ *
+ * @return eight characters
  */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_INIT(name, high, mid_high, mid_low, low) \
-{ \
-  name[3] = high; \
-  name[2] = mid_high; \
-  name[1] = mid_low; \
-  name[0] = low; \
- \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-}
+static inline uint64_t __attr_always_inline___
+ecma_decimal_load_eight_chars (const lit_utf8_byte_t *str_p) /**< characters */
+{
+  return (((uint64_t) str_p[0])
+          | ((uint64_t) str_p[1] << 8)
+          | ((uint64_t) str_p[2] << 16)
+          | ((uint64_t) str_p[3] << 24)
+          | ((uint64_t) str_p[4] << 32)
+          | ((uint64_t) str_p[5] << 40)
+          | ((uint64_t) str_p[6] << 48)
+          | ((uint64_t) str_p[7] << 56));
+} /* ecma_decimal_load_eight_chars */
 
 /**
- * Copy specified 128-bit integer
+ * Check whether all eight characters loaded by ecma_decimal_load_eight_chars are decimal digits.
+ *
+ * Note:
+ *      the high nibble of every byte must be 3, and adding 6 to the low nibble must not overflow
+ *
+ * @return true - if all characters are decimal digits
+ *         false - otherwise
  */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_COPY(name_copy_to, name_copy_from) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name_copy_to); \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name_copy_from); \
-  \
-  name_copy_to[0] = name_copy_from[0]; \
-  name_copy_to[1] = name_copy_from[1]; \
-  name_copy_to[2] = name_copy_from[2]; \
-  name_copy_to[3] = name_copy_from[3]; \
-}
+static inline bool __attr_always_inline___
+ecma_decimal_are_eight_digits (uint64_t chunk) /**< eight characters */
+{
+  return (((chunk & 0xf0f0f0f0f0f0f0f0ull)
+           | (((chunk + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) == 0x3333333333333333ull);
+} /* ecma_decimal_are_eight_digits */
 
 /**
- * Copy high and middle parts of 128-bit integer to specified uint64_t variable
+ * Convert eight decimal digits loaded by ecma_decimal_load_eight_chars to their value
+ * with three multiplications (SIMD within a register).
+ *
+ * @return value of the digits
  */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ROUND_HIGH_AND_MIDDLE_TO_UINT64(name, uint64_var) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-  uint64_var = ((name[3] << 32u) | (name[2])) + (((name[1] >> 31u) != 0 ? 1 : 0)); \
-}
+static inline uint32_t __attr_always_inline___
+ecma_decimal_eight_digits_value (uint64_t chunk) /**< eight decimal digits */
+{
+  const uint64_t mask = 0x000000ff000000ffull;
+  const uint64_t mul1 = 100 + (1000000ull << 32);
+  const uint64_t mul2 = 1 + (10000ull << 32);
 
-/**
- * Copy middle and low parts of 128-bit integer to specified uint64_t variable
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ROUND_MIDDLE_AND_LOW_TO_UINT64(name, uint64_var) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-  uint64_var = (name[1] << 32u) | (name[0]); \
-}
+  chunk -= 0x3030303030303030ull;
 
-/**
- * Check if specified 128-bit integers are equal
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ARE_EQUAL(name1, name2) \
-  ((name1)[0] == (name2[0]) \
-   && (name1)[1] == (name2[1]) \
-   && (name1)[2] == (name2[2]) \
-   && (name1)[3] == (name2[3]))
+  /* Combine the adjacent digits into two digit values. */
+  chunk = (chunk * 10) + (chunk >> 8);
 
-/**
- * Check if bits [lowest_bit, 128) are zero
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO(name, lowest_bit) \
-  ((lowest_bit) >= 96 ? ((name[3] >> ((lowest_bit) - 96)) == 0) : \
-   ((lowest_bit) >= 64 ? (name[3] == 0 \
-                          && ((name[2] >> ((lowest_bit) - 64)) == 0)) : \
-   ((lowest_bit) >= 32 ? (name[3] == 0 \
-                          && name[2] == 0 && ((name[1] >> ((lowest_bit) - 32)) == 0)) : \
-   (name[3] == 0 && name[2] == 0 && name[1] == 0 && ((name[0] >> (lowest_bit)) == 0)))))
+  /* Combine the two digit values into the final value. */
+  chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+  return (uint32_t) chunk;
+} /* ecma_decimal_eight_digits_value */
 
 /**
- * Check if bits [0, highest_bit] are zero
+ * Append a run of decimal digits to the significand of a decimal number.
+ *
+ * @return pointer to the first character which is not a decimal digit
  */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_LOW_BIT_MASK_ZERO(name, highest_bit) \
-  ((highest_bit >= 96) ? (name[2] == 0 && name[1] == 0 && name[0] == 0 \
-                          && (((uint32_t) name[3] << (127 - (highest_bit))) == 0)) : \
-   ((highest_bit >= 64) ? (name[1] == 0 && name[0] == 0 \
-                           && (((uint32_t) name[2] << (95 - (highest_bit))) == 0)) : \
-   ((highest_bit >= 32) ? (name[0] == 0 \
-                           && (((uint32_t) name[1] << (63 - (highest_bit))) == 0)) : \
-    (((uint32_t) name[0] << (31 - (highest_bit))) == 0))))
+static const lit_utf8_byte_t *
+ecma_decimal_read_digits (ecma_decimal_significand_t *decimal_p, /**< [in, out] significand */
+                          const lit_utf8_byte_t *str_p, /**< first character */
+                          const lit_utf8_byte_t *str_end_p, /**< end of the string */
+                          bool is_fraction) /**< true - if the digits are after the decimal point */
+{
+  if (decimal_p->digits == 0)
+  {
+    /* Leading zeros are not significant. */
+    while (str_p < str_end_p && *str_p == LIT_CHAR_0)
+    {
+      if (is_fraction)
+      {
+        decimal_p->exponent--;
+      }
 
-/**
- * Check if 128-bit integer is zero
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_ZERO(name) \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (name, 0)
+      str_p++;
+    }
 
-/**
- * Shift 128-bit integer one bit left
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT(name) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-  \
-  name[3] = (uint32_t) (name[3] << 1u); \
-  name[3] |= name[2] >> 31u; \
-  name[2] = (uint32_t) (name[2] << 1u); \
-  name[2] |= name[1] >> 31u; \
-  name[1] = (uint32_t) (name[1] << 1u); \
-  name[1] |= name[0] >> 31u; \
-  name[0] = (uint32_t) (name[0] << 1u); \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-}
+    decimal_p->digits_p = str_p;
+  }
 
-/**
- * Shift 128-bit integer one bit right
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_RIGHT_SHIFT(name) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-  \
-  name[0] >>= 1u; \
-  name[0] |= (uint32_t) (name[1] << 31u); \
-  name[1] >>= 1u; \
-  name[1] |= (uint32_t) (name[2] << 31u); \
-  name[2] >>= 1u; \
-  name[2] |= (uint32_t) (name[3] << 31u); \
-  name[3] >>= 1u; \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-}
+  while (str_p < str_end_p)
+  {
+    if (decimal_p->digits + 8 <= ECMA_DECIMAL_SIGNIFICAND_DIGITS
+        && str_end_p - str_p >= 8
+        && (decimal_p->digits != 0 || *str_p != LIT_CHAR_0))
+    {
+      uint64_t chunk = ecma_decimal_load_eight_chars (str_p);
 
-/**
- * Increment 128-bit integer
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_INC(name) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-  \
-  name[0] += 1ull; \
-  name[1] += (name[0] >> 32u); \
-  name[0] = (uint32_t) name[0]; \
-  name[2] += (name[1] >> 32u); \
-  name[1] = (uint32_t) name[1]; \
-  name[3] += (name[2] >> 32u); \
-  name[2] = (uint32_t) name[2]; \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-}
+      if (ecma_decimal_are_eight_digits (chunk))
+      {
+        decimal_p->significand = decimal_p->significand * 100000000u + ecma_decimal_eight_digits_value (chunk);
+        decimal_p->digits += 8;
 
-/**
- * Add 128-bit integer
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ADD(name_add_to, name_to_add) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name_add_to); \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name_to_add); \
-  \
-  name_add_to[0] += name_to_add[0]; \
-  name_add_to[1] += name_to_add[1]; \
-  name_add_to[2] += name_to_add[2]; \
-  name_add_to[3] += name_to_add[3]; \
-  \
-  name_add_to[1] += (name_add_to[0] >> 32u); \
-  name_add_to[0] = (uint32_t) name_add_to[0]; \
-  name_add_to[2] += (name_add_to[1] >> 32u); \
-  name_add_to[1] = (uint32_t) name_add_to[1]; \
-  name_add_to[3] += (name_add_to[2] >> 32u); \
-  name_add_to[2] = (uint32_t) name_add_to[2]; \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name_add_to); \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name_to_add); \
-}
+        if (is_fraction)
+        {
+          decimal_p->exponent -= 8;
+        }
 
-/**
- * Multiply 128-bit integer by 10
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_MUL_10(name) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (name); \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER (name ## _tmp); \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_COPY (name ## _tmp, name); \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (name ## _tmp); \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (name ## _tmp); \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ADD (name, name ## _tmp); \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-}
+        str_p += 8;
+        continue;
+      }
+    }
 
-/**
- * Divide 128-bit integer by 10
- */
-#define ECMA_NUMBER_CONVERSION_128BIT_INTEGER_DIV_10(name) \
-{ \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-  \
-  /* estimation of reciprocal of 10 */ \
-  const uint64_t div10_p_low = 0x9999999aul; \
-  const uint64_t div10_p_mid = 0x99999999ul; \
-  const uint64_t div10_p_high = 0x19999999ul; \
-  \
-  uint64_t intermediate[8] = { 0, 0, 0, 0, 0, 0, 0, 0 }; \
-  uint64_t l0, l1, l2, l3, m0, m1, m2, m3, h0, h1, h2, h3; \
-  l0 = name[0] * div10_p_low; \
-  l1 = name[1] * div10_p_low; \
-  l2 = name[2] * div10_p_low; \
-  l3 = name[3] * div10_p_low; \
-  m0 = name[0] * div10_p_mid; \
-  m1 = name[1] * div10_p_mid; \
-  m2 = name[2] * div10_p_mid; \
-  m3 = name[3] * div10_p_mid; \
-  h0 = name[0] * div10_p_high; \
-  h1 = name[1] * div10_p_high; \
-  h2 = name[2] * div10_p_high; \
-  h3 = name[3] * div10_p_high; \
-  intermediate[0] += (uint32_t) l0; \
-  intermediate[1] += l0 >> 32u; \
-  \
-  intermediate[1] += (uint32_t) l1; \
-  intermediate[2] += l1 >> 32u; \
-  intermediate[1] += (uint32_t) m0; \
-  intermediate[2] += m0 >> 32u; \
-  \
-  intermediate[2] += (uint32_t) l2; \
-  intermediate[3] += l2 >> 32u; \
-  intermediate[2] += (uint32_t) m1; \
-  intermediate[3] += m1 >> 32u; \
-  intermediate[2] += (uint32_t) m0; \
-  intermediate[3] += m0 >> 32u; \
-  \
-  intermediate[3] += (uint32_t) l3; \
-  intermediate[4] += l3 >> 32u; \
-  intermediate[3] += (uint32_t) m2; \
-  intermediate[4] += m2 >> 32u; \
-  intermediate[3] += (uint32_t) m1; \
-  intermediate[4] += m1 >> 32u; \
-  intermediate[3] += (uint32_t) h0; \
-  intermediate[4] += h0 >> 32u; \
-  \
-  intermediate[4] += (uint32_t) m3; \
-  intermediate[5] += m3 >> 32u; \
-  intermediate[4] += (uint32_t) m2; \
-  intermediate[5] += m2 >> 32u; \
-  intermediate[4] += (uint32_t) h1; \
-  intermediate[5] += h1 >> 32u; \
-  \
-  intermediate[5] += (uint32_t) m3; \
-  intermediate[6] += m3 >> 32u; \
-  intermediate[5] += (uint32_t) h2; \
-  intermediate[6] += h2 >> 32u; \
-  \
-  intermediate[6] += (uint32_t) h3; \
-  intermediate[7] += h3 >> 32u; \
-  \
-  intermediate[1] += intermediate[0] >> 32u; \
-  intermediate[0] = (uint32_t) intermediate[0]; \
-  intermediate[2] += intermediate[1] >> 32u; \
-  intermediate[1] = (uint32_t) intermediate[1]; \
-  intermediate[3] += intermediate[2] >> 32u; \
-  intermediate[2] = (uint32_t) intermediate[2]; \
-  intermediate[4] += intermediate[3] >> 32u; \
-  intermediate[3] = (uint32_t) intermediate[3]; \
-  intermediate[5] += intermediate[4] >> 32u; \
-  intermediate[4] = (uint32_t) intermediate[4]; \
-  intermediate[6] += intermediate[5] >> 32u; \
-  intermediate[5] = (uint32_t) intermediate[5]; \
-  intermediate[7] += intermediate[6] >> 32u; \
-  intermediate[6] = (uint32_t) intermediate[6]; \
-  \
-  name[0] = intermediate[4]; \
-  name[1] = intermediate[5]; \
-  name[2] = intermediate[6]; \
-  name[3] = intermediate[7]; \
-  \
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_CHECK_PARTS_ARE_32BIT (name); \
-}
+    if (!lit_char_is_decimal_digit (*str_p))
+    {
+      break;
+    }
+
+    uint32_t digit = (uint32_t) (*str_p++ - LIT_CHAR_0);
+
+    if (decimal_p->digits < ECMA_DECIMAL_SIGNIFICAND_DIGITS)
+    {
+      decimal_p->significand = decimal_p->significand * 10 + digit;
+      decimal_p->digits++;
+
+      if (is_fraction)
+      {
+        decimal_p->exponent--;
+      }
+    }
+    else
+    {
+      if (!is_fraction && decimal_p->exponent < ECMA_DECIMAL_EXPONENT_LIMIT)
+      {
+        decimal_p->exponent++;
+      }
+
+      decimal_p->is_truncated |= (digit != 0);
+    }
+  }
+
+  return str_p;
+} /* ecma_decimal_read_digits */
 
 /**
- * @}
+ * Convert a sequence of decimal or hexadecimal digits to a number.
+ *
+ * Note:
+ *      the result is correctly rounded, parseInt and the string to number
+ *      conversion share this function
+ *
+ * @return ecma-number
  */
+ecma_number_t
+ecma_utf8_digits_to_number (const lit_utf8_byte_t *str_p, /**< first digit */
+                            const lit_utf8_byte_t *str_end_p, /**< end of the digits */
+                            uint32_t radix) /**< radix: 10 or 16 */
+{
+  JERRY_ASSERT (radix == 10 || radix == 16);
+
+  if (radix == 10)
+  {
+    ecma_decimal_significand_t decimal = { 0, 0, 0, false, NULL };
+
+    const lit_utf8_byte_t *digits_end_p = ecma_decimal_read_digits (&decimal, str_p, str_end_p, false);
+    JERRY_ASSERT (digits_end_p == str_end_p);
+
+    return (ecma_number_t) ecma_decimal_to_double (decimal.significand,
+                                                   decimal.exponent,
+                                                   decimal.is_truncated,
+                                                   decimal.digits_p,
+                                                   digits_end_p);
+  }
+
+  /* The digits are collected until the highest four bits of the significand are used,
+   * the remaining digits only increase the binary exponent. Non-zero dropped digits
+   * are represented by the lowest bit, which is far below the rounding position. */
+  uint64_t significand = 0;
+  uint32_t dropped_digits = 0;
+  bool is_truncated = false;
+
+  while (str_p < str_end_p)
+  {
+    JERRY_ASSERT (lit_char_is_hex_digit (*str_p));
+    uint32_t digit = lit_char_hex_to_int (*str_p++);
+
+    if ((significand >> 60) == 0)
+    {
+      significand = (significand << 4) | digit;
+    }
+    else
+    {
+      dropped_digits++;
+      is_truncated |= (digit != 0);
+    }
+  }
+
+  if (is_truncated)
+  {
+    significand |= 1;
+  }
+
+  double value = (double) significand;
+
+  while (dropped_digits > 0 && value != INFINITY)
+  {
+    value *= 16;
+    dropped_digits--;
+  }
+
+  return (ecma_number_t) value;
+} /* ecma_utf8_digits_to_number */
 
 /**
  * ECMA-defined conversion of string to Number.
@@ -339,8 +275,6 @@ ecma_number_t
 ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
                             lit_utf8_size_t str_size) /**< string size */
 {
-  /* TODO: Check license issues */
-
   if (str_size == 0)
   {
     return ECMA_NUMBER_ZERO;
@@ -379,14 +313,14 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
     }
   }
 
-  const lit_utf8_byte_t *end_p = str_curr_p - 1;
+  const lit_utf8_byte_t *end_p = str_curr_p;
 
-  if (begin_p > end_p)
+  if (begin_p >= end_p)
   {
     return ECMA_NUMBER_ZERO;
   }
 
-  if ((end_p >= begin_p + 2)
+  if ((end_p >= begin_p + 3)
       && begin_p[0] == LIT_CHAR_0
       && (begin_p[1] == LIT_CHAR_LOWERCASE_X
           || begin_p[1] == LIT_CHAR_UPPERCASE_X))
@@ -394,38 +328,15 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
     /* Hex literal handling */
     begin_p += 2;
 
-    ecma_number_t num = ECMA_NUMBER_ZERO;
-
-    for (const lit_utf8_byte_t * iter_p = begin_p;
-         iter_p <= end_p;
-         iter_p++)
+    for (const lit_utf8_byte_t *iter_p = begin_p; iter_p < end_p; iter_p++)
     {
-      int32_t digit_value;
-
-      if (*iter_p >= LIT_CHAR_0
-          && *iter_p <= LIT_CHAR_9)
-      {
-        digit_value = (*iter_p - LIT_CHAR_0);
-      }
-      else if (*iter_p >= LIT_CHAR_LOWERCASE_A
-               && *iter_p <= LIT_CHAR_LOWERCASE_F)
-      {
-        digit_value = 10 + (*iter_p - LIT_CHAR_LOWERCASE_A);
-      }
-      else if (*iter_p >= LIT_CHAR_UPPERCASE_A
-               && *iter_p <= LIT_CHAR_UPPERCASE_F)
-      {
-        digit_value = 10 + (*iter_p - LIT_CHAR_UPPERCASE_A);
-      }
-      else
+      if (!lit_char_is_hex_digit (*iter_p))
       {
         return ecma_number_make_nan ();
       }
-
-      num = num * 16 + (ecma_number_t) digit_value;
     }
 
-    return num;
+    return ecma_utf8_digits_to_number (begin_p, end_p, 16);
   }
 
   bool sign = false; /* positive */
@@ -441,324 +352,102 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
     begin_p++;
   }
 
-  if (begin_p > end_p)
+  if (begin_p >= end_p)
   {
     return ecma_number_make_nan ();
   }
 
   /* Checking if significant part of parse string is equal to "Infinity" */
   const lit_utf8_byte_t *infinity_zt_str_p = lit_get_magic_string_utf8 (LIT_MAGIC_STRING_INFINITY_UL);
+  lit_utf8_size_t infinity_str_size = lit_get_magic_string_size (LIT_MAGIC_STRING_INFINITY_UL);
 
-  for (const lit_utf8_byte_t *iter_p = begin_p, *iter_infinity_p = infinity_zt_str_p;
-       ;
-       iter_infinity_p++, iter_p++)
+  if ((lit_utf8_size_t) (end_p - begin_p) == infinity_str_size
+      && memcmp (begin_p, infinity_zt_str_p, infinity_str_size) == 0)
   {
-    if (*iter_p != *iter_infinity_p)
-    {
-      break;
-    }
-
-    if (iter_p == end_p)
-    {
-      return ecma_number_make_infinity (sign);
-    }
+    return ecma_number_make_infinity (sign);
   }
 
-  uint64_t fraction_uint64 = 0;
-  uint32_t digits = 0;
-  int32_t e = 0;
+  ecma_decimal_significand_t decimal = { 0, 0, 0, false, NULL };
+  const lit_utf8_byte_t *digits_begin_p = begin_p;
 
   /* Parsing digits before dot (or before end of digits part if there is no dot in number) */
-  while (begin_p <= end_p)
-  {
-    int32_t digit_value;
-
-    if (*begin_p >= LIT_CHAR_0
-        && *begin_p <= LIT_CHAR_9)
-    {
-      digit_value = (*begin_p - LIT_CHAR_0);
-    }
-    else
-    {
-      break;
-    }
-
-    if (digits != 0 || digit_value != 0)
-    {
-      if (digits < ECMA_NUMBER_MAX_DIGITS)
-      {
-        fraction_uint64 = fraction_uint64 * 10 + (uint32_t) digit_value;
-        digits++;
-      }
-      else if (e <= 100000) /* Some limit to not overflow exponent value
-                               (so big exponent anyway will make number
-                               rounded to infinity) */
-      {
-        e++;
-      }
-    }
+  begin_p = ecma_decimal_read_digits (&decimal, begin_p, end_p, false);
+  bool has_digits = (begin_p != digits_begin_p);
 
-    begin_p++;
-  }
-
-  if (begin_p <= end_p
+  if (begin_p < end_p
       && *begin_p == LIT_CHAR_DOT)
   {
     begin_p++;
 
     /* Parsing number's part that is placed after dot */
-    while (begin_p <= end_p)
-    {
-      int32_t digit_value;
-
-      if (*begin_p >= LIT_CHAR_0
-          && *begin_p <= LIT_CHAR_9)
-      {
-        digit_value = (*begin_p - LIT_CHAR_0);
-      }
-      else
-      {
-        break;
-      }
-
-      if (digits < ECMA_NUMBER_MAX_DIGITS)
-      {
-        if (digits != 0 || digit_value != 0)
-        {
-          fraction_uint64 = fraction_uint64 * 10 + (uint32_t) digit_value;
-          digits++;
-        }
-
-        e--;
-      }
+    const lit_utf8_byte_t *fraction_begin_p = begin_p;
+    begin_p = ecma_decimal_read_digits (&decimal, begin_p, end_p, true);
+    has_digits |= (begin_p != fraction_begin_p);
+  }
 
-      begin_p++;
-    }
+  if (!has_digits)
+  {
+    return ecma_number_make_nan ();
   }
 
+  const lit_utf8_byte_t *digits_end_p = begin_p;
+
   /* Parsing exponent literal */
   int32_t e_in_lit = 0;
   bool e_in_lit_sign = false;
 
-  if (begin_p <= end_p
+  if (begin_p < end_p
       && (*begin_p == LIT_CHAR_LOWERCASE_E
           || *begin_p == LIT_CHAR_UPPERCASE_E))
   {
     begin_p++;
 
-    if (*begin_p == LIT_CHAR_PLUS)
+    if (begin_p < end_p && *begin_p == LIT_CHAR_PLUS)
     {
       begin_p++;
     }
-    else if (*begin_p == LIT_CHAR_MINUS)
+    else if (begin_p < end_p && *begin_p == LIT_CHAR_MINUS)
     {
       e_in_lit_sign = true;
       begin_p++;
     }
 
-    if (begin_p > end_p)
+    if (begin_p >= end_p)
     {
       return ecma_number_make_nan ();
     }
 
-    while (begin_p <= end_p)
+    while (begin_p < end_p)
     {
-      int32_t digit_value;
-
-      if (*begin_p >= LIT_CHAR_0
-          && *begin_p <= LIT_CHAR_9)
-      {
-        digit_value = (*begin_p - LIT_CHAR_0);
-      }
-      else
+      if (!lit_char_is_decimal_digit (*begin_p))
       {
         return ecma_number_make_nan ();
       }
 
-      e_in_lit = e_in_lit * 10 + digit_value;
-
-      begin_p++;
-    }
-  }
-
-  /* Adding value of exponent literal to exponent value */
-  if (e_in_lit_sign)
-  {
-    e -= e_in_lit;
-  }
-  else
-  {
-    e += e_in_lit;
-  }
-
-  bool e_sign;
-
-  if (e < 0)
-  {
-    e_sign = true;
-    e = -e;
-  }
-  else
-  {
-    e_sign = false;
-  }
-
-  if (begin_p <= end_p)
-  {
-    return ecma_number_make_nan ();
-  }
-
-  JERRY_ASSERT (begin_p == end_p + 1);
-
-  if (fraction_uint64 == 0)
-  {
-    return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
-  }
-
-#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
-  int32_t binary_exponent = 33;
-
-  /*
-   * 128-bit mantissa storage
-   *
-   * Normalized: |4 bits zero|124-bit mantissa with highest bit set to 1 if mantissa is non-zero|
-   */
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER (fraction_uint128);
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_INIT (fraction_uint128,
-                                              0ull,
-                                              fraction_uint64 >> 32u,
-                                              (uint32_t) fraction_uint64,
-                                              0ull);
-
-  /* Normalizing mantissa */
-  JERRY_ASSERT (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 124));
-
-  while (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 123))
-  {
-    ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (fraction_uint128);
-    binary_exponent--;
-
-    JERRY_ASSERT (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_ZERO (fraction_uint128));
-  }
-
-  if (!e_sign)
-  {
-    /* positive or zero decimal exponent */
-    JERRY_ASSERT (e >= 0);
-
-    while (e > 0)
-    {
-      JERRY_ASSERT (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 124));
-
-      ECMA_NUMBER_CONVERSION_128BIT_INTEGER_MUL_10 (fraction_uint128);
-
-      e--;
-
-      /* Normalizing mantissa */
-      while (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 124))
-      {
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_RIGHT_SHIFT (fraction_uint128);
-
-        binary_exponent++;
-      }
-      while (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 123))
-      {
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (fraction_uint128);
-
-        binary_exponent--;
-
-        JERRY_ASSERT (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_ZERO (fraction_uint128));
-      }
-    }
-  }
-  else
-  {
-    /* negative decimal exponent */
-    JERRY_ASSERT (e != 0);
-
-    while (e > 0)
-    {
-      /* Denormalizing mantissa, moving highest 1 to 95-bit */
-      while (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 127))
+      if (e_in_lit < ECMA_DECIMAL_EXPONENT_LIMIT)
       {
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (fraction_uint128);
-
-        binary_exponent--;
-
-        JERRY_ASSERT (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_ZERO (fraction_uint128));
+        e_in_lit = e_in_lit * 10 + (*begin_p - LIT_CHAR_0);
       }
 
-      ECMA_NUMBER_CONVERSION_128BIT_INTEGER_DIV_10 (fraction_uint128);
-
-      e--;
-    }
-
-    /* Normalizing mantissa */
-    while (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 124))
-    {
-      ECMA_NUMBER_CONVERSION_128BIT_INTEGER_RIGHT_SHIFT (fraction_uint128);
-
-      binary_exponent++;
-    }
-    while (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 123))
-    {
-      ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (fraction_uint128);
-
-      binary_exponent--;
-
-      JERRY_ASSERT (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_ZERO (fraction_uint128));
+      begin_p++;
     }
   }
 
-  JERRY_ASSERT (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_ZERO (fraction_uint128));
-  JERRY_ASSERT (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 124));
-
-  /*
-   * Preparing mantissa for conversion to 52-bit representation, converting it to:
-   *
-   * |12 zero bits|116 mantissa bits|
-   */
-  while (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 116 + 1))
-  {
-    ECMA_NUMBER_CONVERSION_128BIT_INTEGER_RIGHT_SHIFT (fraction_uint128);
-
-    binary_exponent++;
-  }
-  while (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 116))
+  if (begin_p < end_p)
   {
-    ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (fraction_uint128);
-
-    binary_exponent--;
-
-    JERRY_ASSERT (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_ZERO (fraction_uint128));
+    return ecma_number_make_nan ();
   }
 
-  JERRY_ASSERT (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 116 + 1));
-
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ROUND_HIGH_AND_MIDDLE_TO_UINT64 (fraction_uint128, fraction_uint64);
-
-  return ecma_number_make_from_sign_mantissa_and_exponent (sign,
-                                                           fraction_uint64,
-                                                           binary_exponent);
-#elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
-  /* Less precise conversion */
-  ecma_number_t num = (ecma_number_t) (uint32_t) fraction_uint64;
-
-  ecma_number_t m = e_sign ? (ecma_number_t) 0.1 : (ecma_number_t) 10.0;
-
-  while (e)
-  {
-    if (e % 2)
-    {
-      num *= m;
-    }
+  /* Adding value of exponent literal to exponent value */
+  decimal.exponent += e_in_lit_sign ? -e_in_lit : e_in_lit;
 
-    m *= m;
-    e /= 2;
-  }
+  ecma_number_t num = (ecma_number_t) ecma_decimal_to_double (decimal.significand,
+                                                              decimal.exponent,
+                                                              decimal.is_truncated,
+                                                              decimal.digits_p,
+                                                              digits_end_p);
 
-  return num;
-#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+  return sign ? -num : num;
 } /* ecma_utf8_string_to_number */
 
 /**
@@ -774,28 +463,60 @@ ecma_uint32_to_utf8_string (uint32_t value, /**< value to convert */
                             lit_utf8_byte_t *out_buffer_p, /**< buffer for string */
                             lit_utf8_size_t buffer_size) /**< size of buffer */
 {
-  lit_utf8_byte_t *buf_p = out_buffer_p + buffer_size;
+  static const uint32_t powers_of_ten[] =
+  {
+    10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+  };
 
-  do
+  /* Two digits are converted at once. */
+  static const char digit_pairs[] =
   {
-    JERRY_ASSERT (buf_p >= out_buffer_p);
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899"
+  };
 
-    buf_p--;
-    *buf_p = (lit_utf8_byte_t) ((value % 10) + LIT_CHAR_0);
-    value /= 10;
+  lit_utf8_size_t length = 1;
+
+  while (length <= sizeof (powers_of_ten) / sizeof (powers_of_ten[0])
+         && value >= powers_of_ten[length - 1])
+  {
+    length++;
   }
-  while (value != 0);
 
-  JERRY_ASSERT (buf_p >= out_buffer_p);
+  JERRY_ASSERT (length <= buffer_size);
+  JERRY_UNUSED (buffer_size);
 
-  lit_utf8_size_t bytes_copied = (lit_utf8_size_t) (out_buffer_p + buffer_size - buf_p);
+  lit_utf8_byte_t *buf_p = out_buffer_p + length;
 
-  if (likely (buf_p != out_buffer_p))
+  while (value >= 100)
   {
-    memmove (out_buffer_p, buf_p, bytes_copied);
+    const char *pair_p = digit_pairs + (value % 100) * 2;
+    value /= 100;
+
+    *(--buf_p) = (lit_utf8_byte_t) pair_p[1];
+    *(--buf_p) = (lit_utf8_byte_t) pair_p[0];
   }
 
-  return bytes_copied;
+  if (value >= 10)
+  {
+    *(--buf_p) = (lit_utf8_byte_t) digit_pairs[value * 2 + 1];
+    *(--buf_p) = (lit_utf8_byte_t) digit_pairs[value * 2];
+  }
+  else
+  {
+    *(--buf_p) = (lit_utf8_byte_t) (LIT_CHAR_0 + value);
+  }
+
+  JERRY_ASSERT (buf_p == out_buffer_p);
+  return length;
 } /* ecma_uint32_to_utf8_string */
 
 /**
@@ -924,7 +645,16 @@ ecma_number_to_decimal (ecma_number_t num, /**< ecma-number */
   JERRY_ASSERT (!ecma_number_is_infinity (num));
   JERRY_ASSERT (!ecma_number_is_negative (num));
 
-  return ecma_errol0_dtoa ((double) num, out_digits_p, out_decimal_exp_p);
+  /* Grisu3 converts almost every number and reports the remaining
+   * ones, which are converted by the slower exact algorithm. */
+  lit_utf8_size_t num_digits = ecma_grisu3_dtoa ((double) num, out_digits_p, out_decimal_exp_p);
+
+  if (likely (num_digits != 0))
+  {
+    return num_digits;
+  }
+
+  return ecma_bignum_dtoa ((double) num, out_digits_p, out_decimal_exp_p);
 } /* ecma_number_to_decimal */
 
 /**
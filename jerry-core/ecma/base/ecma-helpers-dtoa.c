@@ -0,0 +1,1233 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This file is based on work under the following copyright and permission
+ * notice:
+ *
+ *   Copyright 2010 the V8 project authors. All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions are
+ *   met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *     * Neither the name of Google Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+
+#include "ecma-helpers.h"
+#include "lit-char-helpers.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmahelpers Helpers for operations with ECMA data types
+ * @{
+ */
+
+/**
+ * Printing Floating-Point Numbers Quickly and Accurately with Integers
+ *
+ * available at http://florian.loitsch.com/publications/dtoa-pldi2010.pdf
+ *
+ * How to Print Floating-Point Numbers Accurately (Steele and White, 1990)
+ */
+
+/**
+ * Width of the significand of a double
+ */
+#define ECMA_GRISU_DOUBLE_SIGNIFICAND_SIZE 52
+
+/**
+ * Hidden bit of the significand of a double
+ */
+#define ECMA_GRISU_DOUBLE_HIDDEN_BIT (1ull << ECMA_GRISU_DOUBLE_SIGNIFICAND_SIZE)
+
+/**
+ * Exponent of the denormal doubles
+ */
+#define ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT (-1074)
+
+/**
+ * Bias of the exponent of a double, including the width of the significand
+ */
+#define ECMA_GRISU_DOUBLE_EXPONENT_BIAS (1023 + ECMA_GRISU_DOUBLE_SIGNIFICAND_SIZE)
+
+/**
+ * Range of the binary exponents of the scaled numbers, so the integral
+ * part of the digit generation fits into 32 bits.
+ */
+#define ECMA_GRISU_MINIMAL_TARGET_EXPONENT (-60)
+#define ECMA_GRISU_MAXIMAL_TARGET_EXPONENT (-32)
+
+/**
+ * Decimal exponent of the first cached power of ten
+ */
+#define ECMA_GRISU_CACHED_POWERS_OFFSET 348
+
+/**
+ * Distance of the decimal exponents of the cached powers of ten
+ */
+#define ECMA_GRISU_CACHED_POWERS_DISTANCE 8
+
+/**
+ * Floating point number with a 64 bit significand: f * 2^e
+ */
+typedef struct
+{
+  uint64_t f; /**< significand */
+  int32_t e; /**< binary exponent */
+} ecma_grisu_fp_t;
+
+/**
+ * Cached power of ten
+ */
+typedef struct
+{
+  uint64_t f; /**< normalized significand */
+  int16_t e; /**< binary exponent */
+  int16_t k; /**< decimal exponent */
+} ecma_grisu_cached_power_t;
+
+/**
+ * Normalized powers of ten from 10^-348 to 10^340 with a step of 10^8
+ */
+static const ecma_grisu_cached_power_t ecma_grisu_cached_powers[] =
+{
+  { 0xfa8fd5a0081c0288ull, -1220, -348 },
+  { 0xbaaee17fa23ebf76ull, -1193, -340 },
+  { 0x8b16fb203055ac76ull, -1166, -332 },
+  { 0xcf42894a5dce35eaull, -1140, -324 },
+  { 0x9a6bb0aa55653b2dull, -1113, -316 },
+  { 0xe61acf033d1a45dfull, -1087, -308 },
+  { 0xab70fe17c79ac6caull, -1060, -300 },
+  { 0xff77b1fcbebcdc4full, -1034, -292 },
+  { 0xbe5691ef416bd60cull, -1007, -284 },
+  { 0x8dd01fad907ffc3cull, -980, -276 },
+  { 0xd3515c2831559a83ull, -954, -268 },
+  { 0x9d71ac8fada6c9b5ull, -927, -260 },
+  { 0xea9c227723ee8bcbull, -901, -252 },
+  { 0xaecc49914078536dull, -874, -244 },
+  { 0x823c12795db6ce57ull, -847, -236 },
+  { 0xc21094364dfb5637ull, -821, -228 },
+  { 0x9096ea6f3848984full, -794, -220 },
+  { 0xd77485cb25823ac7ull, -768, -212 },
+  { 0xa086cfcd97bf97f4ull, -741, -204 },
+  { 0xef340a98172aace5ull, -715, -196 },
+  { 0xb23867fb2a35b28eull, -688, -188 },
+  { 0x84c8d4dfd2c63f3bull, -661, -180 },
+  { 0xc5dd44271ad3cdbaull, -635, -172 },
+  { 0x936b9fcebb25c996ull, -608, -164 },
+  { 0xdbac6c247d62a584ull, -582, -156 },
+  { 0xa3ab66580d5fdaf6ull, -555, -148 },
+  { 0xf3e2f893dec3f126ull, -529, -140 },
+  { 0xb5b5ada8aaff80b8ull, -502, -132 },
+  { 0x87625f056c7c4a8bull, -475, -124 },
+  { 0xc9bcff6034c13053ull, -449, -116 },
+  { 0x964e858c91ba2655ull, -422, -108 },
+  { 0xdff9772470297ebdull, -396, -100 },
+  { 0xa6dfbd9fb8e5b88full, -369, -92 },
+  { 0xf8a95fcf88747d94ull, -343, -84 },
+  { 0xb94470938fa89bcfull, -316, -76 },
+  { 0x8a08f0f8bf0f156bull, -289, -68 },
+  { 0xcdb02555653131b6ull, -263, -60 },
+  { 0x993fe2c6d07b7facull, -236, -52 },
+  { 0xe45c10c42a2b3b06ull, -210, -44 },
+  { 0xaa242499697392d3ull, -183, -36 },
+  { 0xfd87b5f28300ca0eull, -157, -28 },
+  { 0xbce5086492111aebull, -130, -20 },
+  { 0x8cbccc096f5088ccull, -103, -12 },
+  { 0xd1b71758e219652cull, -77, -4 },
+  { 0x9c40000000000000ull, -50, 4 },
+  { 0xe8d4a51000000000ull, -24, 12 },
+  { 0xad78ebc5ac620000ull, 3, 20 },
+  { 0x813f3978f8940984ull, 30, 28 },
+  { 0xc097ce7bc90715b3ull, 56, 36 },
+  { 0x8f7e32ce7bea5c70ull, 83, 44 },
+  { 0xd5d238a4abe98068ull, 109, 52 },
+  { 0x9f4f2726179a2245ull, 136, 60 },
+  { 0xed63a231d4c4fb27ull, 162, 68 },
+  { 0xb0de65388cc8ada8ull, 189, 76 },
+  { 0x83c7088e1aab65dbull, 216, 84 },
+  { 0xc45d1df942711d9aull, 242, 92 },
+  { 0x924d692ca61be758ull, 269, 100 },
+  { 0xda01ee641a708deaull, 295, 108 },
+  { 0xa26da3999aef774aull, 322, 116 },
+  { 0xf209787bb47d6b85ull, 348, 124 },
+  { 0xb454e4a179dd1877ull, 375, 132 },
+  { 0x865b86925b9bc5c2ull, 402, 140 },
+  { 0xc83553c5c8965d3dull, 428, 148 },
+  { 0x952ab45cfa97a0b3ull, 455, 156 },
+  { 0xde469fbd99a05fe3ull, 481, 164 },
+  { 0xa59bc234db398c25ull, 508, 172 },
+  { 0xf6c69a72a3989f5cull, 534, 180 },
+  { 0xb7dcbf5354e9beceull, 561, 188 },
+  { 0x88fcf317f22241e2ull, 588, 196 },
+  { 0xcc20ce9bd35c78a5ull, 614, 204 },
+  { 0x98165af37b2153dfull, 641, 212 },
+  { 0xe2a0b5dc971f303aull, 667, 220 },
+  { 0xa8d9d1535ce3b396ull, 694, 228 },
+  { 0xfb9b7cd9a4a7443cull, 720, 236 },
+  { 0xbb764c4ca7a44410ull, 747, 244 },
+  { 0x8bab8eefb6409c1aull, 774, 252 },
+  { 0xd01fef10a657842cull, 800, 260 },
+  { 0x9b10a4e5e9913129ull, 827, 268 },
+  { 0xe7109bfba19c0c9dull, 853, 276 },
+  { 0xac2820d9623bf429ull, 880, 284 },
+  { 0x80444b5e7aa7cf85ull, 907, 292 },
+  { 0xbf21e44003acdd2dull, 933, 300 },
+  { 0x8e679c2f5e44ff8full, 960, 308 },
+  { 0xd433179d9c8cb841ull, 986, 316 },
+  { 0x9e19db92b4e31ba9ull, 1013, 324 },
+  { 0xeb96bf6ebadf77d9ull, 1039, 332 },
+  { 0xaf87023b9bf0ee6bull, 1066, 340 },
+};
+
+/**
+ * Number of 32 bit digits of a bignum, which is enough for the
+ * scaled values of any double (less than 1100 bits).
+ */
+#define ECMA_BIGNUM_SIZE 36
+
+/**
+ * Unsigned integer with arbitrary precision
+ */
+typedef struct
+{
+  uint32_t digits[ECMA_BIGNUM_SIZE]; /**< digits, the least significant digit is the first */
+  uint32_t length; /**< number of used digits */
+} ecma_bignum_t;
+
+/**
+ * Decompose a positive, finite double into a significand and a binary exponent.
+ *
+ * @return true - if the lower neighbour of the number is closer than the upper neighbour
+ *         false - otherwise
+ */
+static bool
+ecma_dtoa_decompose (double val, /**< positive, finite number */
+                     ecma_grisu_fp_t *fp_p) /**< [out] val == f * 2^e */
+{
+  JERRY_ASSERT (val > 0.0);
+
+  union
+  {
+    uint64_t u64_value;
+    double float_value;
+  } u;
+
+  u.float_value = val;
+
+  uint64_t significand = u.u64_value & (ECMA_GRISU_DOUBLE_HIDDEN_BIT - 1);
+  uint32_t biased_exponent = (uint32_t) (u.u64_value >> ECMA_GRISU_DOUBLE_SIGNIFICAND_SIZE);
+
+  if (biased_exponent == 0)
+  {
+    fp_p->f = significand;
+    fp_p->e = ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT;
+    return false;
+  }
+
+  fp_p->f = significand | ECMA_GRISU_DOUBLE_HIDDEN_BIT;
+  fp_p->e = (int32_t) biased_exponent - ECMA_GRISU_DOUBLE_EXPONENT_BIAS;
+
+  /* The lower neighbour is closer for powers of two. */
+  return significand == 0 && biased_exponent > 1;
+} /* ecma_dtoa_decompose */
+
+/**
+ * Multiply two numbers and round the result to 64 bits.
+ *
+ * @return product
+ */
+static ecma_grisu_fp_t
+ecma_grisu_multiply (ecma_grisu_fp_t x, /**< first operand */
+                     ecma_grisu_fp_t y) /**< second operand */
+{
+  const uint64_t mask_32 = 0xffffffffu;
+
+  uint64_t a = x.f >> 32;
+  uint64_t b = x.f & mask_32;
+  uint64_t c = y.f >> 32;
+  uint64_t d = y.f & mask_32;
+
+  uint64_t ac = a * c;
+  uint64_t bc = b * c;
+  uint64_t ad = a * d;
+  uint64_t bd = b * d;
+
+  uint64_t tmp = (bd >> 32) + (ad & mask_32) + (bc & mask_32);
+
+  /* Round the lower 64 bits of the product. */
+  tmp += 1u << 31;
+
+  ecma_grisu_fp_t result;
+  result.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+  result.e = x.e + y.e + 64;
+  return result;
+} /* ecma_grisu_multiply */
+
+/**
+ * Shift the significand left until its highest bit is set.
+ *
+ * @return normalized number
+ */
+static ecma_grisu_fp_t
+ecma_grisu_normalize (ecma_grisu_fp_t x) /**< non-zero number */
+{
+  JERRY_ASSERT (x.f != 0);
+
+  while ((x.f & (1ull << 63)) == 0)
+  {
+    x.f <<= 1;
+    x.e--;
+  }
+
+  return x;
+} /* ecma_grisu_normalize */
+
+/**
+ * Move the last digit towards the number as long as the result is closer
+ * to the number, and check whether the digits are guaranteed to be the
+ * shortest and closest representation.
+ *
+ * @return true - if the digits are correct
+ *         false - otherwise
+ */
+static bool
+ecma_grisu_round_weed (lit_utf8_byte_t *last_digit_p, /**< last generated digit */
+                       uint64_t distance_too_high_w, /**< distance of the number from the unsafe upper bound */
+                       uint64_t unsafe_interval, /**< size of the unsafe interval */
+                       uint64_t rest, /**< distance of the digits from the unsafe upper bound */
+                       uint64_t ten_kappa, /**< value of the last digit */
+                       uint64_t unit) /**< error of the computations */
+{
+  uint64_t small_distance = distance_too_high_w - unit;
+  uint64_t big_distance = distance_too_high_w + unit;
+
+  while (rest < small_distance
+         && unsafe_interval - rest >= ten_kappa
+         && (rest + ten_kappa < small_distance
+             || small_distance - rest >= rest + ten_kappa - small_distance))
+  {
+    (*last_digit_p)--;
+    rest += ten_kappa;
+  }
+
+  /* The closest representation cannot be determined. */
+  if (rest < big_distance
+      && unsafe_interval - rest >= ten_kappa
+      && (rest + ten_kappa < big_distance
+          || big_distance - rest > rest + ten_kappa - big_distance))
+  {
+    return false;
+  }
+
+  /* The digits must be safely inside the boundaries. */
+  return (2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit);
+} /* ecma_grisu_round_weed */
+
+/**
+ * Grisu3 double to ASCII conversion, which produces the shortest and
+ * closest digits, but fails for about 0.5% of the numbers.
+ *
+ * Note:
+ *      the digits and the exponent correspond to the s, n, k parameters
+ *      of ECMA-262 v5, 9.8.1, item 5
+ *
+ * @return number of generated digits - if the conversion is successful
+ *         0 - otherwise
+ */
+lit_utf8_size_t
+ecma_grisu3_dtoa (double val, /**< positive, finite number */
+                  lit_utf8_byte_t *buffer_p, /**< buffer to generate digits into */
+                  int32_t *exp_p) /**< [out] exponent */
+{
+  ecma_grisu_fp_t v;
+  bool is_lower_boundary_closer = ecma_dtoa_decompose (val, &v);
+
+  /* The boundaries are the midpoints between the number and its neighbours. */
+  ecma_grisu_fp_t boundary_plus;
+  boundary_plus.f = (v.f << 1) + 1;
+  boundary_plus.e = v.e - 1;
+  boundary_plus = ecma_grisu_normalize (boundary_plus);
+
+  ecma_grisu_fp_t boundary_minus;
+
+  if (is_lower_boundary_closer)
+  {
+    boundary_minus.f = (v.f << 2) - 1;
+    boundary_minus.e = v.e - 2;
+  }
+  else
+  {
+    boundary_minus.f = (v.f << 1) - 1;
+    boundary_minus.e = v.e - 1;
+  }
+
+  boundary_minus.f <<= boundary_minus.e - boundary_plus.e;
+  boundary_minus.e = boundary_plus.e;
+
+  ecma_grisu_fp_t w = ecma_grisu_normalize (v);
+  JERRY_ASSERT (w.e == boundary_plus.e);
+
+  /* Select a cached power of ten, which moves the exponent into the target range. */
+  int32_t min_exponent = ECMA_GRISU_MINIMAL_TARGET_EXPONENT - (w.e + 64);
+  int32_t k = (int32_t) ceil ((min_exponent + 63) * 0.30102999566398114);
+  int32_t index = (ECMA_GRISU_CACHED_POWERS_OFFSET + k - 1) / ECMA_GRISU_CACHED_POWERS_DISTANCE + 1;
+
+  JERRY_ASSERT (index >= 0
+                && index < (int32_t) (sizeof (ecma_grisu_cached_powers) / sizeof (ecma_grisu_cached_powers[0])));
+
+  ecma_grisu_fp_t ten_mk;
+  ten_mk.f = ecma_grisu_cached_powers[index].f;
+  ten_mk.e = ecma_grisu_cached_powers[index].e;
+  int32_t mk = ecma_grisu_cached_powers[index].k;
+
+  JERRY_ASSERT (w.e + ten_mk.e + 64 >= ECMA_GRISU_MINIMAL_TARGET_EXPONENT
+                && w.e + ten_mk.e + 64 <= ECMA_GRISU_MAXIMAL_TARGET_EXPONENT);
+
+  ecma_grisu_fp_t scaled_w = ecma_grisu_multiply (w, ten_mk);
+  ecma_grisu_fp_t low = ecma_grisu_multiply (boundary_minus, ten_mk);
+  ecma_grisu_fp_t high = ecma_grisu_multiply (boundary_plus, ten_mk);
+
+  /* Digit generation: the multiplications have an error of at most one unit,
+   * so the digits are generated from the widened (unsafe) interval. */
+  uint64_t unit = 1;
+  uint64_t too_low = low.f - unit;
+  uint64_t too_high = high.f + unit;
+  uint64_t unsafe_interval = too_high - too_low;
+
+  uint32_t one_shift = (uint32_t) -scaled_w.e;
+  uint64_t one_mask = (1ull << one_shift) - 1;
+
+  uint32_t integrals = (uint32_t) (too_high >> one_shift);
+  uint64_t fractionals = too_high & one_mask;
+
+  /* The divisor is the biggest power of ten, which is less than or equal to the integral part. */
+  uint32_t divisor = 1;
+  int32_t kappa = (integrals != 0) ? 1 : 0;
+
+  while (integrals / 10 >= divisor)
+  {
+    divisor *= 10;
+    kappa++;
+  }
+
+  lit_utf8_byte_t *dst_p = buffer_p;
+
+  while (kappa > 0)
+  {
+    *dst_p++ = (lit_utf8_byte_t) (LIT_CHAR_0 + integrals / divisor);
+    integrals %= divisor;
+    kappa--;
+
+    uint64_t rest = (((uint64_t) integrals) << one_shift) + fractionals;
+
+    if (rest < unsafe_interval)
+    {
+      *exp_p = -mk + kappa + (int32_t) (dst_p - buffer_p);
+
+      if (!ecma_grisu_round_weed (dst_p - 1,
+                                  too_high - scaled_w.f,
+                                  unsafe_interval,
+                                  rest,
+                                  ((uint64_t) divisor) << one_shift,
+                                  unit))
+      {
+        return 0;
+      }
+
+      return (lit_utf8_size_t) (dst_p - buffer_p);
+    }
+
+    divisor /= 10;
+  }
+
+  while (true)
+  {
+    fractionals *= 10;
+    unit *= 10;
+    unsafe_interval *= 10;
+
+    *dst_p++ = (lit_utf8_byte_t) (LIT_CHAR_0 + (fractionals >> one_shift));
+    fractionals &= one_mask;
+    kappa--;
+
+    if (fractionals < unsafe_interval)
+    {
+      *exp_p = -mk + kappa + (int32_t) (dst_p - buffer_p);
+
+      if (!ecma_grisu_round_weed (dst_p - 1,
+                                  (too_high - scaled_w.f) * unit,
+                                  unsafe_interval,
+                                  fractionals,
+                                  one_mask + 1,
+                                  unit))
+      {
+        return 0;
+      }
+
+      return (lit_utf8_size_t) (dst_p - buffer_p);
+    }
+  }
+} /* ecma_grisu3_dtoa */
+
+/**
+ * Set the value of a bignum.
+ */
+static void
+ecma_bignum_init (ecma_bignum_t *bignum_p, /**< [out] bignum */
+                  uint64_t value) /**< value */
+{
+  bignum_p->digits[0] = (uint32_t) value;
+  bignum_p->digits[1] = (uint32_t) (value >> 32);
+  bignum_p->length = (value >> 32) != 0 ? 2 : ((value != 0) ? 1 : 0);
+} /* ecma_bignum_init */
+
+/**
+ * Multiply a bignum by a 32 bit number.
+ */
+static void
+ecma_bignum_multiply (ecma_bignum_t *bignum_p, /**< [in, out] bignum */
+                      uint32_t factor) /**< factor */
+{
+  uint64_t carry = 0;
+
+  for (uint32_t i = 0; i < bignum_p->length; i++)
+  {
+    uint64_t product = (uint64_t) bignum_p->digits[i] * factor + carry;
+    bignum_p->digits[i] = (uint32_t) product;
+    carry = product >> 32;
+  }
+
+  if (carry != 0)
+  {
+    JERRY_ASSERT (bignum_p->length < ECMA_BIGNUM_SIZE);
+    bignum_p->digits[bignum_p->length++] = (uint32_t) carry;
+  }
+} /* ecma_bignum_multiply */
+
+/**
+ * Multiply a bignum by a power of ten.
+ */
+static void
+ecma_bignum_multiply_by_power_of_ten (ecma_bignum_t *bignum_p, /**< [in, out] bignum */
+                                      uint32_t exponent) /**< decimal exponent */
+{
+  static const uint32_t powers_of_ten[] =
+  {
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+  };
+
+  while (exponent >= 9)
+  {
+    ecma_bignum_multiply (bignum_p, powers_of_ten[9]);
+    exponent -= 9;
+  }
+
+  ecma_bignum_multiply (bignum_p, powers_of_ten[exponent]);
+} /* ecma_bignum_multiply_by_power_of_ten */
+
+/**
+ * Shift a bignum to the left.
+ */
+static void
+ecma_bignum_shift_left (ecma_bignum_t *bignum_p, /**< [in, out] bignum */
+                        uint32_t shift) /**< number of bits */
+{
+  if (bignum_p->length == 0)
+  {
+    return;
+  }
+
+  uint32_t digit_shift = shift >> 5;
+  uint32_t bit_shift = shift & 0x1f;
+
+  JERRY_ASSERT (bignum_p->length + digit_shift < ECMA_BIGNUM_SIZE);
+
+  bignum_p->digits[bignum_p->length + digit_shift] = 0;
+
+  for (int32_t i = (int32_t) bignum_p->length - 1; i >= 0; i--)
+  {
+    uint64_t digit = ((uint64_t) bignum_p->digits[i]) << bit_shift;
+    bignum_p->digits[(uint32_t) i + digit_shift + 1] |= (uint32_t) (digit >> 32);
+    bignum_p->digits[(uint32_t) i + digit_shift] = (uint32_t) digit;
+  }
+
+  memset (bignum_p->digits, 0, digit_shift * sizeof (uint32_t));
+
+  bignum_p->length += digit_shift + 1;
+
+  if (bignum_p->digits[bignum_p->length - 1] == 0)
+  {
+    bignum_p->length--;
+  }
+} /* ecma_bignum_shift_left */
+
+/**
+ * Compare two bignums.
+ *
+ * @return negative number - if left < right
+ *         0 - if left == right
+ *         positive number - if left > right
+ */
+static int
+ecma_bignum_compare (const ecma_bignum_t *left_p, /**< left operand */
+                     const ecma_bignum_t *right_p) /**< right operand */
+{
+  if (left_p->length != right_p->length)
+  {
+    return (left_p->length < right_p->length) ? -1 : 1;
+  }
+
+  for (int32_t i = (int32_t) left_p->length - 1; i >= 0; i--)
+  {
+    if (left_p->digits[i] != right_p->digits[i])
+    {
+      return (left_p->digits[i] < right_p->digits[i]) ? -1 : 1;
+    }
+  }
+
+  return 0;
+} /* ecma_bignum_compare */
+
+/**
+ * Compare the sum of two bignums with a third bignum.
+ *
+ * @return negative number - if left + right < other
+ *         0 - if left + right == other
+ *         positive number - if left + right > other
+ */
+static int
+ecma_bignum_compare_sum (const ecma_bignum_t *left_p, /**< left operand of the sum */
+                         const ecma_bignum_t *right_p, /**< right operand of the sum */
+                         const ecma_bignum_t *other_p) /**< other operand */
+{
+  ecma_bignum_t sum;
+  uint32_t length = (left_p->length > right_p->length) ? left_p->length : right_p->length;
+  uint64_t carry = 0;
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    uint64_t digit = carry;
+    digit += (i < left_p->length) ? left_p->digits[i] : 0;
+    digit += (i < right_p->length) ? right_p->digits[i] : 0;
+    sum.digits[i] = (uint32_t) digit;
+    carry = digit >> 32;
+  }
+
+  if (carry != 0)
+  {
+    JERRY_ASSERT (length < ECMA_BIGNUM_SIZE);
+    sum.digits[length++] = (uint32_t) carry;
+  }
+
+  sum.length = length;
+  return ecma_bignum_compare (&sum, other_p);
+} /* ecma_bignum_compare_sum */
+
+/**
+ * Subtract a bignum from another bignum, which is greater than or equal to it.
+ */
+static void
+ecma_bignum_subtract (ecma_bignum_t *left_p, /**< [in, out] left operand */
+                      const ecma_bignum_t *right_p) /**< right operand */
+{
+  JERRY_ASSERT (ecma_bignum_compare (left_p, right_p) >= 0);
+
+  uint32_t borrow = 0;
+
+  for (uint32_t i = 0; i < left_p->length; i++)
+  {
+    uint64_t subtrahend = (uint64_t) ((i < right_p->length) ? right_p->digits[i] : 0) + borrow;
+    borrow = (left_p->digits[i] < subtrahend) ? 1 : 0;
+    left_p->digits[i] = (uint32_t) ((uint64_t) left_p->digits[i] - subtrahend);
+  }
+
+  while (left_p->length > 0 && left_p->digits[left_p->length - 1] == 0)
+  {
+    left_p->length--;
+  }
+} /* ecma_bignum_subtract */
+
+/**
+ * Double to ASCII conversion with arbitrary precision arithmetic, which always
+ * produces the shortest and closest digits, but it is much slower than Grisu3.
+ *
+ * Note:
+ *      the digits and the exponent correspond to the s, n, k parameters
+ *      of ECMA-262 v5, 9.8.1, item 5
+ *
+ * @return number of generated digits
+ */
+lit_utf8_size_t
+ecma_bignum_dtoa (double val, /**< positive, finite number */
+                  lit_utf8_byte_t *buffer_p, /**< buffer to generate digits into */
+                  int32_t *exp_p) /**< [out] exponent */
+{
+  ecma_grisu_fp_t v;
+  bool is_lower_boundary_closer = ecma_dtoa_decompose (val, &v);
+
+  /* The boundaries are included if the significand is even (round half to even). */
+  bool is_even = (v.f & 0x1) == 0;
+
+  /* The number is r / s, the distances of the boundaries are m_plus / s and m_minus / s.
+   * Everything is multiplied by two, so the halved distances are integers. */
+  ecma_bignum_t r, s, m_plus, m_minus;
+  uint32_t shift = is_lower_boundary_closer ? 2 : 1;
+
+  ecma_bignum_init (&r, v.f);
+  ecma_bignum_init (&s, 1);
+  ecma_bignum_init (&m_plus, 1);
+  ecma_bignum_init (&m_minus, 1);
+
+  ecma_bignum_shift_left (&r, shift);
+  ecma_bignum_shift_left (&s, shift);
+  ecma_bignum_shift_left (&m_plus, shift - 1);
+
+  if (v.e >= 0)
+  {
+    ecma_bignum_shift_left (&r, (uint32_t) v.e);
+    ecma_bignum_shift_left (&m_plus, (uint32_t) v.e);
+    ecma_bignum_shift_left (&m_minus, (uint32_t) v.e);
+  }
+  else
+  {
+    ecma_bignum_shift_left (&s, (uint32_t) -v.e);
+  }
+
+  /* Estimate the decimal exponent, which is either correct or one less than the correct value. */
+  uint32_t bit_length = 0;
+
+  while ((v.f >> bit_length) != 0)
+  {
+    bit_length++;
+  }
+
+  int32_t k = (int32_t) ceil ((v.e + (int32_t) bit_length - 1) * 0.30102999566398114 - 1e-10);
+
+  if (k >= 0)
+  {
+    ecma_bignum_multiply_by_power_of_ten (&s, (uint32_t) k);
+  }
+  else
+  {
+    ecma_bignum_multiply_by_power_of_ten (&r, (uint32_t) -k);
+    ecma_bignum_multiply_by_power_of_ten (&m_plus, (uint32_t) -k);
+    ecma_bignum_multiply_by_power_of_ten (&m_minus, (uint32_t) -k);
+  }
+
+  int compare = ecma_bignum_compare_sum (&r, &m_plus, &s);
+
+  if (is_even ? (compare >= 0) : (compare > 0))
+  {
+    k++;
+    ecma_bignum_multiply (&s, 10);
+  }
+
+  *exp_p = k;
+
+  /* Digit generation: stop when the digits are inside the boundaries. */
+  lit_utf8_byte_t *dst_p = buffer_p;
+
+  while (true)
+  {
+    ecma_bignum_multiply (&r, 10);
+    ecma_bignum_multiply (&m_plus, 10);
+    ecma_bignum_multiply (&m_minus, 10);
+
+    lit_utf8_byte_t digit = 0;
+
+    while (ecma_bignum_compare (&r, &s) >= 0)
+    {
+      ecma_bignum_subtract (&r, &s);
+      digit++;
+    }
+
+    JERRY_ASSERT (digit <= 9);
+
+    compare = ecma_bignum_compare (&r, &m_minus);
+    bool is_low = is_even ? (compare <= 0) : (compare < 0);
+
+    compare = ecma_bignum_compare_sum (&r, &m_plus, &s);
+    bool is_high = is_even ? (compare >= 0) : (compare > 0);
+
+    if (!is_low && !is_high)
+    {
+      *dst_p++ = (lit_utf8_byte_t) (LIT_CHAR_0 + digit);
+      continue;
+    }
+
+    if (is_low && is_high)
+    {
+      /* Both the digit and the next digit are valid: select the closest one. */
+      compare = ecma_bignum_compare_sum (&r, &r, &s);
+
+      if (compare > 0 || (compare == 0 && (digit & 0x1) != 0))
+      {
+        digit++;
+      }
+    }
+    else if (is_high)
+    {
+      digit++;
+    }
+
+    JERRY_ASSERT (digit <= 9);
+    *dst_p++ = (lit_utf8_byte_t) (LIT_CHAR_0 + digit);
+    return (lit_utf8_size_t) (dst_p - buffer_p);
+  }
+} /* ecma_bignum_dtoa */
+
+/**
+ * Correctly rounded decimal to double conversion
+ *
+ * How to Read Floating Point Numbers Accurately (Clinger, 1990)
+ */
+
+/**
+ * Powers of ten which are exactly representable as 64 bit integers
+ */
+static const uint64_t ecma_strtod_integer_powers_of_ten[] =
+{
+  1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+  1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+  100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+  1000000000000000000ull, 10000000000000000000ull
+};
+
+/**
+ * Powers of ten which are exactly representable as doubles
+ */
+static const double ecma_strtod_exact_powers_of_ten[] =
+{
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * Greatest exponent in the exact powers of ten table
+ */
+#define ECMA_STRTOD_MAX_EXACT_POWER_OF_TEN 22
+
+/**
+ * Maximum number of decimal digits of an integer which is exactly representable as a double
+ */
+#define ECMA_STRTOD_MAX_EXACT_INTEGER_DIGITS 15
+
+/**
+ * The error of the approximation is measured in 1 / ECMA_STRTOD_DENOMINATOR units of the last bit
+ */
+#define ECMA_STRTOD_DENOMINATOR_LOG 3
+#define ECMA_STRTOD_DENOMINATOR (1u << ECMA_STRTOD_DENOMINATOR_LOG)
+
+/**
+ * Numbers less than 10^ECMA_STRTOD_MIN_DECIMAL_POWER are rounded to zero,
+ * and numbers greater than or equal to 10^ECMA_STRTOD_MAX_DECIMAL_POWER are
+ * rounded to infinity.
+ */
+#define ECMA_STRTOD_MIN_DECIMAL_POWER (-324)
+#define ECMA_STRTOD_MAX_DECIMAL_POWER 309
+
+/**
+ * Compose a double from a significand and a binary exponent.
+ *
+ * @return the double, which is rounded to zero or infinity when it is out of range
+ */
+static double
+ecma_strtod_compose (ecma_grisu_fp_t fp) /**< number with a significand of at most 54 bits */
+{
+  union
+  {
+    uint64_t u64_value;
+    double float_value;
+  } u;
+
+  while (fp.f > (ECMA_GRISU_DOUBLE_HIDDEN_BIT << 1) - 1)
+  {
+    fp.f >>= 1;
+    fp.e++;
+  }
+
+  if (fp.e >= 0x7ff - ECMA_GRISU_DOUBLE_EXPONENT_BIAS)
+  {
+    return INFINITY;
+  }
+
+  if (fp.e < ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT)
+  {
+    return 0.0;
+  }
+
+  while (fp.e > ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT && (fp.f & ECMA_GRISU_DOUBLE_HIDDEN_BIT) == 0)
+  {
+    fp.f <<= 1;
+    fp.e--;
+  }
+
+  uint64_t biased_exponent = 0;
+
+  if (fp.e != ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT || (fp.f & ECMA_GRISU_DOUBLE_HIDDEN_BIT) != 0)
+  {
+    biased_exponent = (uint64_t) (fp.e + ECMA_GRISU_DOUBLE_EXPONENT_BIAS);
+  }
+
+  u.u64_value = (fp.f & (ECMA_GRISU_DOUBLE_HIDDEN_BIT - 1)) | (biased_exponent << ECMA_GRISU_DOUBLE_SIGNIFICAND_SIZE);
+  return u.float_value;
+} /* ecma_strtod_compose */
+
+/**
+ * Approximate significand * 10^exponent with the cached powers of ten and
+ * track the error of the approximation.
+ *
+ * @return true - if the result is correctly rounded
+ *         false - otherwise, in this case the result is either the correctly
+ *                 rounded value or its lower neighbour
+ */
+static bool
+ecma_strtod_approximate (uint64_t significand, /**< significand of the number */
+                         uint32_t significand_digits, /**< number of decimal digits of the significand */
+                         int32_t exponent, /**< decimal exponent */
+                         bool is_truncated, /**< true - if non-zero digits follow the significand */
+                         double *result_p) /**< [out] result */
+{
+  ecma_grisu_fp_t input;
+  input.f = significand;
+  input.e = 0;
+
+  /* The dropped digits are less than one unit of the significand. */
+  uint64_t error = is_truncated ? ECMA_STRTOD_DENOMINATOR : 0;
+
+  int32_t old_e = input.e;
+  input = ecma_grisu_normalize (input);
+  error <<= old_e - input.e;
+
+  uint32_t index = (uint32_t) (exponent + ECMA_GRISU_CACHED_POWERS_OFFSET) / ECMA_GRISU_CACHED_POWERS_DISTANCE;
+  JERRY_ASSERT (index < sizeof (ecma_grisu_cached_powers) / sizeof (ecma_grisu_cached_powers[0]));
+
+  const ecma_grisu_cached_power_t *cached_power_p = ecma_grisu_cached_powers + index;
+  int32_t adjustment = exponent - cached_power_p->k;
+  JERRY_ASSERT (adjustment >= 0 && adjustment < ECMA_GRISU_CACHED_POWERS_DISTANCE);
+
+  if (adjustment != 0)
+  {
+    ecma_grisu_fp_t adjustment_power;
+    adjustment_power.f = ecma_strtod_integer_powers_of_ten[adjustment];
+    adjustment_power.e = 0;
+
+    input = ecma_grisu_multiply (input, ecma_grisu_normalize (adjustment_power));
+
+    /* The product is exact if it fits into 64 bits. */
+    if (significand_digits + (uint32_t) adjustment > 19)
+    {
+      error += ECMA_STRTOD_DENOMINATOR / 2;
+    }
+  }
+
+  ecma_grisu_fp_t power;
+  power.f = cached_power_p->f;
+  power.e = cached_power_p->e;
+
+  /* The cached power and the rounding of the product both have an error of at most
+   * half unit, and the error of the input is multiplied by less than one unit. */
+  error += ECMA_STRTOD_DENOMINATOR / 2 + ((error != 0) ? 1 : 0) + ECMA_STRTOD_DENOMINATOR / 2;
+  input = ecma_grisu_multiply (input, power);
+
+  old_e = input.e;
+  input = ecma_grisu_normalize (input);
+  error <<= old_e - input.e;
+
+  /* Number of bits which are dropped when the number is rounded to a double. */
+  int32_t order_of_magnitude = 64 + input.e;
+  int32_t precision_bits_count;
+
+  if (order_of_magnitude >= ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT + ECMA_GRISU_DOUBLE_SIGNIFICAND_SIZE + 1)
+  {
+    precision_bits_count = 64 - (ECMA_GRISU_DOUBLE_SIGNIFICAND_SIZE + 1);
+  }
+  else if (order_of_magnitude <= ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT)
+  {
+    precision_bits_count = 64;
+  }
+  else
+  {
+    precision_bits_count = 64 - (order_of_magnitude - ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT);
+  }
+
+  if (precision_bits_count + ECMA_STRTOD_DENOMINATOR_LOG >= 64)
+  {
+    /* Very small denormals: the half way point multiplied by the denominator
+     * would not fit into 64 bits, so everything is shifted to the right. */
+    int32_t shift = (precision_bits_count + ECMA_STRTOD_DENOMINATOR_LOG) - 64 + 1;
+
+    input.f >>= shift;
+    input.e += shift;
+    error = (error >> shift) + 1 + ECMA_STRTOD_DENOMINATOR;
+    precision_bits_count -= shift;
+  }
+
+  uint64_t precision_bits = input.f & ((1ull << precision_bits_count) - 1);
+  uint64_t half_way = 1ull << (precision_bits_count - 1);
+
+  precision_bits *= ECMA_STRTOD_DENOMINATOR;
+  half_way *= ECMA_STRTOD_DENOMINATOR;
+
+  ecma_grisu_fp_t rounded;
+  rounded.f = input.f >> precision_bits_count;
+  rounded.e = input.e + precision_bits_count;
+
+  if (precision_bits >= half_way + error)
+  {
+    rounded.f++;
+  }
+
+  *result_p = ecma_strtod_compose (rounded);
+
+  /* When the dropped bits are too close to the half way point, the number is rounded down. */
+  return (precision_bits <= half_way - error || precision_bits >= half_way + error);
+} /* ecma_strtod_approximate */
+
+/**
+ * Compare a decimal number with the half way point between a double and its upper neighbour.
+ *
+ * The digits of the half way point are generated with arbitrary precision arithmetic,
+ * and compared with the digits of the decimal number one by one, so the memory usage
+ * does not depend on the number of digits.
+ *
+ * @return negative number - if the decimal number is less than the half way point
+ *         0 - if the decimal number is equal to the half way point
+ *         positive number - if the decimal number is greater than the half way point
+ */
+static int
+ecma_strtod_compare_half_way (double guess, /**< non-negative, finite number */
+                              const lit_utf8_byte_t *digits_p, /**< first significant digit */
+                              const lit_utf8_byte_t *digits_end_p, /**< end of the digits */
+                              int32_t decimal_exponent) /**< the decimal number is 0.d1d2... * 10^exponent */
+{
+  ecma_grisu_fp_t v;
+
+  if (guess == 0.0)
+  {
+    v.f = 0;
+    v.e = ECMA_GRISU_DOUBLE_DENORMAL_EXPONENT;
+  }
+  else
+  {
+    ecma_dtoa_decompose (guess, &v);
+  }
+
+  /* The half way point is h = (2 * f + 1) * 2^(e - 1) = r / s * 10^k */
+  uint64_t half_way_f = (v.f << 1) + 1;
+  int32_t half_way_e = v.e - 1;
+
+  ecma_bignum_t r, s;
+  ecma_bignum_init (&r, half_way_f);
+  ecma_bignum_init (&s, 1);
+
+  if (half_way_e >= 0)
+  {
+    ecma_bignum_shift_left (&r, (uint32_t) half_way_e);
+  }
+  else
+  {
+    ecma_bignum_shift_left (&s, (uint32_t) -half_way_e);
+  }
+
+  /* Estimate the decimal exponent, which is either correct or one less than the correct value. */
+  uint32_t bit_length = 0;
+
+  while ((half_way_f >> bit_length) != 0)
+  {
+    bit_length++;
+  }
+
+  int32_t k = (int32_t) ceil ((half_way_e + (int32_t) bit_length - 1) * 0.30102999566398114 - 1e-10);
+
+  if (k >= 0)
+  {
+    ecma_bignum_multiply_by_power_of_ten (&s, (uint32_t) k);
+  }
+  else
+  {
+    ecma_bignum_multiply_by_power_of_ten (&r, (uint32_t) -k);
+  }
+
+  if (ecma_bignum_compare (&r, &s) >= 0)
+  {
+    k++;
+    ecma_bignum_multiply (&s, 10);
+  }
+
+  if (decimal_exponent != k)
+  {
+    return (decimal_exponent < k) ? -1 : 1;
+  }
+
+  for (const lit_utf8_byte_t *iter_p = digits_p; iter_p < digits_end_p; iter_p++)
+  {
+    if (*iter_p == LIT_CHAR_DOT)
+    {
+      continue;
+    }
+
+    lit_utf8_byte_t digit = 0;
+
+    if (r.length != 0)
+    {
+      ecma_bignum_multiply (&r, 10);
+
+      while (ecma_bignum_compare (&r, &s) >= 0)
+      {
+        ecma_bignum_subtract (&r, &s);
+        digit++;
+      }
+    }
+
+    if (*iter_p != LIT_CHAR_0 + digit)
+    {
+      return (*iter_p < LIT_CHAR_0 + digit) ? -1 : 1;
+    }
+  }
+
+  /* All digits are equal: the half way point may have more digits. */
+  return (r.length != 0) ? -1 : 0;
+} /* ecma_strtod_compare_half_way */
+
+/**
+ * Convert a decimal number to the nearest double (round half to even).
+ *
+ * Most numbers are converted by exact floating point operations or by
+ * an approximation with 64 bit integers, and only the hard cases fall
+ * back to the digit by digit comparison with arbitrary precision arithmetic.
+ *
+ * @return non-negative double
+ */
+double
+ecma_decimal_to_double (uint64_t significand, /**< first (at most 19) significant digits */
+                        int32_t exponent, /**< decimal exponent of the last digit of the significand */
+                        bool is_truncated, /**< true - if non-zero digits follow the significand */
+                        const lit_utf8_byte_t *digits_p, /**< first significant digit (digits and at most
+                                                          *   one decimal point) */
+                        const lit_utf8_byte_t *digits_end_p) /**< end of the digits */
+{
+  if (significand == 0)
+  {
+    return 0.0;
+  }
+
+  uint32_t significand_digits = 1;
+
+  while (significand_digits < 20 && significand >= ecma_strtod_integer_powers_of_ten[significand_digits])
+  {
+    significand_digits++;
+  }
+
+  JERRY_ASSERT (significand_digits <= 19);
+
+  /* The number is in the [10^(decimal_exponent - 1), 10^decimal_exponent) range. */
+  int32_t decimal_exponent = exponent + (int32_t) significand_digits;
+
+  if (decimal_exponent > ECMA_STRTOD_MAX_DECIMAL_POWER)
+  {
+    return INFINITY;
+  }
+
+  if (decimal_exponent <= ECMA_STRTOD_MIN_DECIMAL_POWER)
+  {
+    return 0.0;
+  }
+
+  /* Both the significand and the power of ten are exact doubles, so a single
+   * floating point operation produces the correctly rounded result. */
+  if (!is_truncated && significand_digits <= ECMA_STRTOD_MAX_EXACT_INTEGER_DIGITS)
+  {
+    double value = (double) significand;
+
+    if (exponent >= -ECMA_STRTOD_MAX_EXACT_POWER_OF_TEN && exponent < 0)
+    {
+      return value / ecma_strtod_exact_powers_of_ten[-exponent];
+    }
+
+    if (exponent >= 0 && exponent <= ECMA_STRTOD_MAX_EXACT_POWER_OF_TEN)
+    {
+      return value * ecma_strtod_exact_powers_of_ten[exponent];
+    }
+
+    int32_t remaining_digits = ECMA_STRTOD_MAX_EXACT_INTEGER_DIGITS - (int32_t) significand_digits;
+
+    if (exponent > 0 && exponent - remaining_digits <= ECMA_STRTOD_MAX_EXACT_POWER_OF_TEN)
+    {
+      value *= ecma_strtod_exact_powers_of_ten[remaining_digits];
+      return value * ecma_strtod_exact_powers_of_ten[exponent - remaining_digits];
+    }
+  }
+
+  double guess;
+
+  if (likely (ecma_strtod_approximate (significand, significand_digits, exponent, is_truncated, &guess)))
+  {
+    return guess;
+  }
+
+  if (guess == INFINITY)
+  {
+    return guess;
+  }
+
+  /* The guess is either correct or the lower neighbour of the correct value. */
+  int compare = ecma_strtod_compare_half_way (guess, digits_p, digits_end_p, decimal_exponent);
+
+  union
+  {
+    uint64_t u64_value;
+    double float_value;
+  } u;
+
+  u.float_value = guess;
+
+  if (compare > 0 || (compare == 0 && (u.u64_value & 0x1) != 0))
+  {
+    /* The upper neighbour of a positive double: the carry of the significand increases the exponent. */
+    u.u64_value++;
+  }
+
+  return u.float_value;
+} /* ecma_decimal_to_double */
+
+/**
+ * @}
+ * @}
+ */
@@ -19,6 +19,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -90,16 +91,22 @@ ecma_init_ecma_string_from_magic_string_ex_id (ecma_string_t *string_p, /**< des
 } /* ecma_init_ecma_string_from_magic_string_ex_id */
 
 /**
- * Allocate new ecma-string and fill it with characters from the utf8 string
+ * Allocate new ecma-string and fill it with characters from the utf8 string whose length is already known
+ *
+ * Note:
+ *      the descriptor records both the size and the length, so strings whose size
+ *      is equal to their length are known to be ascii without scanning them again
  *
  * @return pointer to ecma-string descriptor
  */
-ecma_string_t *
-ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
-                                lit_utf8_size_t string_size) /**< string size */
+static ecma_string_t *
+ecma_new_ecma_string_from_utf8_with_length (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                                            lit_utf8_size_t string_size, /**< string size */
+                                            ecma_length_t string_length) /**< string length */
 {
   JERRY_ASSERT (string_p != NULL || string_size == 0);
   JERRY_ASSERT (lit_is_cesu8_string_valid (string_p, string_size));
+  JERRY_ASSERT (lit_utf8_string_length (string_p, string_size) == string_length);
 
   lit_magic_string_id_t magic_string_id;
   if (lit_is_utf8_string_magic (string_p, string_size, &magic_string_id))
@@ -125,7 +132,7 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
     string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_UTF8_STRING | ECMA_STRING_REF_ONE;
     string_desc_p->u.common_field = 0;
     string_desc_p->u.utf8_string.size = (uint16_t) string_size;
-    string_desc_p->u.utf8_string.length = (uint16_t) lit_utf8_string_length (string_p, string_size);
+    string_desc_p->u.utf8_string.length = (uint16_t) string_length;
 
     data_p = (lit_utf8_byte_t *) (string_desc_p + 1);
   }
@@ -138,7 +145,7 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
     string_desc_p->u.long_utf8_string_size = string_size;
 
     ecma_long_string_t *long_string_desc_p = (ecma_long_string_t *) string_desc_p;
-    long_string_desc_p->long_utf8_string_length = lit_utf8_string_length (string_p, string_size);
+    long_string_desc_p->long_utf8_string_length = string_length;
 
     data_p = (lit_utf8_byte_t *) (long_string_desc_p + 1);
   }
@@ -146,8 +153,71 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
   memcpy (data_p, string_p, string_size);
   return string_desc_p;
+} /* ecma_new_ecma_string_from_utf8_with_length */
+
+/**
+ * Allocate new ecma-string and fill it with characters from the utf8 string
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                                lit_utf8_size_t string_size) /**< string size */
+{
+  return ecma_new_ecma_string_from_utf8_with_length (string_p,
+                                                     string_size,
+                                                     lit_utf8_string_length (string_p, string_size));
 } /* ecma_new_ecma_string_from_utf8 */
 
+/**
+ * Allocate new ecma-string which refers to the characters of the utf8 string instead of copying them
+ *
+ * Note:
+ *      the characters must not be changed or freed until the returned string is freed,
+ *      short and long strings are still copied to the heap
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_static_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                                       lit_utf8_size_t string_size) /**< string size */
+{
+  ecma_length_t string_length = lit_utf8_string_length (string_p, string_size);
+
+  /* The descriptor of a static string is not smaller than a heap string with this many bytes. */
+  if (string_size <= sizeof (const lit_utf8_byte_t *)
+      || string_size > UINT16_MAX)
+  {
+    return ecma_new_ecma_string_from_utf8_with_length (string_p, string_size, string_length);
+  }
+
+  JERRY_ASSERT (lit_is_cesu8_string_valid (string_p, string_size));
+
+  lit_magic_string_id_t magic_string_id;
+  if (lit_is_utf8_string_magic (string_p, string_size, &magic_string_id))
+  {
+    return ecma_get_magic_string (magic_string_id);
+  }
+
+  lit_magic_string_ex_id_t magic_string_ex_id;
+  if (lit_is_ex_utf8_string_magic (string_p, string_size, &magic_string_ex_id))
+  {
+    return ecma_get_magic_string_ex (magic_string_ex_id);
+  }
+
+  ecma_static_string_t *static_string_desc_p = jmem_heap_alloc_block (sizeof (ecma_static_string_t));
+  ecma_string_t *string_desc_p = &static_string_desc_p->header;
+
+  string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_STATIC_UTF8_STRING | ECMA_STRING_REF_ONE;
+  string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
+  string_desc_p->u.common_field = 0;
+  string_desc_p->u.utf8_string.size = (uint16_t) string_size;
+  string_desc_p->u.utf8_string.length = (uint16_t) string_length;
+
+  static_string_desc_p->chars_p = string_p;
+  return string_desc_p;
+} /* ecma_new_ecma_static_string_from_utf8 */
+
 /**
  * Allocate new ecma-string and fill it with cesu-8 character which represents specified code unit
  *
@@ -272,6 +342,157 @@ ecma_new_ecma_string_from_number (ecma_number_t num) /**< ecma-number */
   return string_desc_p;
 } /* ecma_new_ecma_string_from_number */
 
+#if CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0
+
+/**
+ * A cached string is not shared further after this many references,
+ * so the reference counter of the string cannot overflow.
+ */
+#define ECMA_NUMBER_STRING_CACHE_MAX_REF (ECMA_STRING_MAX_REF >> 1)
+
+/**
+ * Calculate the index of a number in the number to string cache.
+ *
+ * @return index of the cache entry
+ */
+static inline uint32_t __attr_always_inline___
+ecma_number_string_cache_index (ecma_number_t num) /**< ecma-number */
+{
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+  union
+  {
+    uint64_t u64_value;
+    ecma_number_t float_value;
+  } u;
+
+  u.float_value = num;
+
+  uint32_t hash = (uint32_t) (u.u64_value ^ (u.u64_value >> 32));
+#elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
+  union
+  {
+    uint32_t u32_value;
+    ecma_number_t float_value;
+  } u;
+
+  u.float_value = num;
+
+  uint32_t hash = u.u32_value;
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+
+  /* The low bits of the significand are often zero, so the index is taken
+   * from the high bits of a multiplicative (Fibonacci) hash. */
+  hash *= 0x9e3779b1u;
+  return ((hash >> 16) * CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE) >> 16;
+} /* ecma_number_string_cache_index */
+
+#endif /* CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0 */
+
+/**
+ * Convert a number to a string like ecma_new_ecma_string_from_number, but the strings
+ * of numbers which are not array indices (negative, fractional or large numbers) are
+ * kept in a small direct mapped cache, so repeated property accesses with the same
+ * number key do not format the number again.
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_string_from_number_cached (ecma_number_t num) /**< ecma-number */
+{
+#if CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0
+  uint32_t uint32_num = ecma_number_to_uint32 (num);
+
+  /* Array indices and special values are converted without formatting digits. */
+  if (num == ((ecma_number_t) uint32_num)
+      || ecma_number_is_nan (num)
+      || ecma_number_is_infinity (num))
+  {
+    return ecma_new_ecma_string_from_number (num);
+  }
+
+  uint32_t index = ecma_number_string_cache_index (num);
+  ecma_number_string_cache_entry_t *entry_p = JERRY_CONTEXT (ecma_number_string_cache) + index;
+
+  if (entry_p->string_cp != ECMA_NULL_POINTER && entry_p->number == num)
+  {
+    ecma_string_t *string_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, entry_p->string_cp);
+
+    if (string_p->refs_and_container < ECMA_NUMBER_STRING_CACHE_MAX_REF)
+    {
+#ifdef JMEM_STATS
+      JERRY_CONTEXT (ecma_number_string_cache_stats).hits++;
+#endif /* JMEM_STATS */
+
+      ecma_ref_ecma_string (string_p);
+      return string_p;
+    }
+  }
+
+#ifdef JMEM_STATS
+  JERRY_CONTEXT (ecma_number_string_cache_stats).misses++;
+#endif /* JMEM_STATS */
+
+  ecma_string_t *string_p = ecma_new_ecma_string_from_number (num);
+
+  if (entry_p->string_cp != ECMA_NULL_POINTER)
+  {
+    ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, entry_p->string_cp));
+  }
+
+  ecma_ref_ecma_string (string_p);
+  entry_p->number = num;
+  ECMA_SET_NON_NULL_POINTER (entry_p->string_cp, string_p);
+  return string_p;
+#else /* CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE == 0 */
+  return ecma_new_ecma_string_from_number (num);
+#endif /* CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0 */
+} /* ecma_new_ecma_string_from_number_cached */
+
+/**
+ * Release the strings of the number to string cache.
+ */
+void
+ecma_number_string_cache_free (void)
+{
+#if CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0
+  for (uint32_t i = 0; i < CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE; i++)
+  {
+    ecma_number_string_cache_entry_t *entry_p = JERRY_CONTEXT (ecma_number_string_cache) + i;
+
+    if (entry_p->string_cp != ECMA_NULL_POINTER)
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, entry_p->string_cp));
+      entry_p->string_cp = ECMA_NULL_POINTER;
+    }
+  }
+#endif /* CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0 */
+} /* ecma_number_string_cache_free */
+
+#ifdef JMEM_STATS
+
+/**
+ * Print the usage statistics of the number to string cache
+ */
+void
+ecma_number_string_cache_stats_print (void)
+{
+#if CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0
+  ecma_number_string_cache_stats_t *stats_p = &JERRY_CONTEXT (ecma_number_string_cache_stats);
+  uint32_t lookups = stats_p->hits + stats_p->misses;
+
+  JERRY_DEBUG_MSG ("Number to string cache stats:\n"
+                   "  Hits = %u\n"
+                   "  Misses = %u\n"
+                   "  Hit ratio = %u%%\n"
+                   "\n",
+                   (unsigned int) stats_p->hits,
+                   (unsigned int) stats_p->misses,
+                   (unsigned int) (lookups > 0 ? (uint64_t) stats_p->hits * 100 / lookups : 0));
+#endif /* CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0 */
+} /* ecma_number_string_cache_stats_print */
+
+#endif /* JMEM_STATS */
+
 /**
  * Allocate new ecma-string and fill it with reference to ECMA magic string
  *
@@ -366,6 +587,13 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
       utf8_string1_length = long_string_desc_p->long_utf8_string_length;
       break;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      utf8_string1_p = ((ecma_static_string_t *) string1_p)->chars_p;
+      utf8_string1_size = string1_p->u.utf8_string.size;
+      utf8_string1_length = string1_p->u.utf8_string.length;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string1_size = ecma_uint32_to_utf8_string (string1_p->u.uint32_number,
@@ -411,6 +639,13 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
       utf8_string2_length = long_string_desc_p->long_utf8_string_length;
       break;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      utf8_string2_p = ((ecma_static_string_t *) string2_p)->chars_p;
+      utf8_string2_size = string2_p->u.utf8_string.size;
+      utf8_string2_length = string2_p->u.utf8_string.length;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string2_size = ecma_uint32_to_utf8_string (string2_p->u.uint32_number,
@@ -538,6 +773,11 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       jmem_heap_free_block (string_p, string_p->u.long_utf8_string_size + sizeof (ecma_long_string_t));
       return;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      jmem_heap_free_block (string_p, sizeof (ecma_static_string_t));
+      return;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
@@ -577,6 +817,7 @@ ecma_string_to_number (const ecma_string_t *str_p) /**< ecma-string */
 
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
     case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
     {
@@ -636,6 +877,11 @@ ecma_string_get_array_index (const ecma_string_t *str_p, /**< ecma-string */
       size = lit_get_magic_string_ex_size (str_p->u.magic_string_ex_id);
       raw_str_p = lit_get_magic_string_ex_utf8 (str_p->u.magic_string_ex_id);
     }
+    else if (type == ECMA_STRING_CONTAINER_STATIC_UTF8_STRING)
+    {
+      size = str_p->u.utf8_string.size;
+      raw_str_p = ((const ecma_static_string_t *) str_p)->chars_p;
+    }
     else
     {
       JERRY_ASSERT (type == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING);
@@ -726,6 +972,12 @@ ecma_string_copy_to_utf8_buffer (const ecma_string_t *string_desc_p, /**< ecma-s
       memcpy (buffer_p, ((ecma_long_string_t *) string_desc_p) + 1, size);
       break;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      size = string_desc_p->u.utf8_string.size;
+      memcpy (buffer_p, ((ecma_static_string_t *) string_desc_p)->chars_p, size);
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       const uint32_t uint32_number = string_desc_p->u.uint32_number;
@@ -849,6 +1101,13 @@ ecma_string_raw_chars (const ecma_string_t *string_p, /**< ecma-string */
       result_p = (const lit_utf8_byte_t *) (long_string_p + 1);
       break;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      size = string_p->u.utf8_string.size;
+      length = string_p->u.utf8_string.length;
+      result_p = ((const ecma_static_string_t *) string_p)->chars_p;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       size = (lit_utf8_size_t) ecma_string_get_number_in_desc_size (string_p->u.uint32_number);
@@ -965,7 +1224,8 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
       default:
       {
         JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING
-                      || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING);
+                      || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING
+                      || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_STATIC_UTF8_STRING);
         break;
       }
     }
@@ -991,6 +1251,12 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
       utf8_string1_size = string1_p->u.long_utf8_string_size;
       break;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      utf8_string1_p = ((ecma_static_string_t *) string1_p)->chars_p;
+      utf8_string1_size = string1_p->u.utf8_string.size;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string1_size = ecma_uint32_to_utf8_string (string1_p->u.uint32_number,
@@ -1029,6 +1295,12 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
       utf8_string2_size = string2_p->u.long_utf8_string_size;
       break;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      utf8_string2_p = ((ecma_static_string_t *) string2_p)->chars_p;
+      utf8_string2_size = string2_p->u.utf8_string.size;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string2_size = ecma_uint32_to_utf8_string (string2_p->u.uint32_number,
@@ -1086,7 +1358,7 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /* ecma-string */
 
   ecma_string_container_t string1_container = ECMA_STRING_GET_CONTAINER (string1_p);
 
-  if (string1_container > ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING
+  if (string1_container > ECMA_STRING_CONTAINER_STATIC_UTF8_STRING
       && string1_container == ECMA_STRING_GET_CONTAINER (string2_p))
   {
     return string1_p->u.common_field == string2_p->u.common_field;
@@ -1135,6 +1407,12 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
       utf8_string1_size = string1_p->u.long_utf8_string_size;
       break;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      utf8_string1_p = ((ecma_static_string_t *) string1_p)->chars_p;
+      utf8_string1_size = string1_p->u.utf8_string.size;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string1_size = ecma_uint32_to_utf8_string (string1_p->u.uint32_number,
@@ -1173,6 +1451,12 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
       utf8_string2_size = string2_p->u.long_utf8_string_size;
       break;
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      utf8_string2_p = ((ecma_static_string_t *) string2_p)->chars_p;
+      utf8_string2_size = string2_p->u.utf8_string.size;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string2_size = ecma_uint32_to_utf8_string (string2_p->u.uint32_number,
@@ -1221,6 +1505,10 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     {
       return (ecma_length_t) (((ecma_long_string_t *) string_p)->long_utf8_string_length);
     }
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
+    {
+      return (ecma_length_t) (string_p->u.utf8_string.length);
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       return ecma_string_get_number_in_desc_size (string_p->u.uint32_number);
@@ -1253,6 +1541,7 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
   switch (ECMA_STRING_GET_CONTAINER (string_p))
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    case ECMA_STRING_CONTAINER_STATIC_UTF8_STRING:
     {
       return (lit_utf8_size_t) string_p->u.utf8_string.size;
     }
@@ -1437,12 +1726,16 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
 
     end_pos -= start_pos;
 
+    /* The length of the substring is known, so it does not need to be recounted. */
+    const ecma_length_t substr_length = end_pos;
+
     if (start_p != NULL)
     {
       if (is_ascii)
       {
-        return ecma_new_ecma_string_from_utf8 (start_p + start_pos,
-                                               (lit_utf8_size_t) end_pos);
+        return ecma_new_ecma_string_from_utf8_with_length (start_p + start_pos,
+                                                           (lit_utf8_size_t) end_pos,
+                                                           substr_length);
       }
 
       while (start_pos--)
@@ -1456,7 +1749,9 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
         end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
       }
 
-      return ecma_new_ecma_string_from_utf8 (start_p, (lit_utf8_size_t) (end_p - start_p));
+      return ecma_new_ecma_string_from_utf8_with_length (start_p,
+                                                         (lit_utf8_size_t) (end_p - start_p),
+                                                         substr_length);
     }
 
     /**
@@ -1475,8 +1770,9 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
 
     if (is_ascii)
     {
-      ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p + start_pos,
-                                                      (lit_utf8_size_t) end_pos);
+      ecma_string_p = ecma_new_ecma_string_from_utf8_with_length (start_p + start_pos,
+                                                                  (lit_utf8_size_t) end_pos,
+                                                                  substr_length);
     }
     else
     {
@@ -1491,7 +1787,9 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
         end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
       }
 
-      ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p, (lit_utf8_size_t) (end_p - start_p));
+      ecma_string_p = ecma_new_ecma_string_from_utf8_with_length (start_p,
+                                                                  (lit_utf8_size_t) (end_p - start_p),
+                                                                  substr_length);
     }
 
     JMEM_FINALIZE_LOCAL_ARRAY (utf8_str_p);
@@ -1577,6 +1875,154 @@ ecma_string_trim (const ecma_string_t *string_p) /**< pointer to an ecma string
   return ret_string_p;
 } /* ecma_string_trim */
 
+/**
+ * Initialize a string builder with an empty buffer.
+ */
+void
+ecma_stringbuilder_init (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  builder_p->buffer_p = NULL;
+  builder_p->size = 0;
+  builder_p->capacity = 0;
+} /* ecma_stringbuilder_init */
+
+/**
+ * Reserve space for the given number of bytes at the end of the buffer of a string builder.
+ *
+ * The buffer grows geometrically, so appending n bytes in any number of steps copies O(n) bytes.
+ *
+ * @return pointer to the reserved space
+ */
+static lit_utf8_byte_t *
+ecma_stringbuilder_reserve (ecma_stringbuilder_t *builder_p, /**< string builder */
+                            lit_utf8_size_t size) /**< number of bytes */
+{
+  lit_utf8_size_t new_size = builder_p->size + size;
+
+  /* It is impossible to allocate this large string. */
+  if (new_size < builder_p->size)
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  if (new_size > builder_p->capacity)
+  {
+    lit_utf8_size_t new_capacity = JERRY_MAX (builder_p->capacity, ECMA_STRINGBUILDER_INITIAL_SIZE);
+
+    while (new_capacity < new_size)
+    {
+      if (new_capacity > (UINT32_MAX >> 1))
+      {
+        new_capacity = new_size;
+        break;
+      }
+      new_capacity <<= 1;
+    }
+
+    lit_utf8_byte_t *new_buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block (new_capacity);
+
+    if (builder_p->buffer_p != NULL)
+    {
+      memcpy (new_buffer_p, builder_p->buffer_p, builder_p->size);
+      jmem_heap_free_block (builder_p->buffer_p, builder_p->capacity);
+    }
+
+    builder_p->buffer_p = new_buffer_p;
+    builder_p->capacity = new_capacity;
+  }
+
+  lit_utf8_byte_t *result_p = builder_p->buffer_p + builder_p->size;
+  builder_p->size = new_size;
+  return result_p;
+} /* ecma_stringbuilder_reserve */
+
+/**
+ * Append the characters of an ecma-string to a string builder.
+ */
+void
+ecma_stringbuilder_append (ecma_stringbuilder_t *builder_p, /**< string builder */
+                           const ecma_string_t *string_p) /**< ecma-string */
+{
+  lit_utf8_size_t string_size = ecma_string_get_size (string_p);
+
+  if (string_size > 0)
+  {
+    lit_utf8_byte_t *data_p = ecma_stringbuilder_reserve (builder_p, string_size);
+    ecma_string_to_utf8_bytes (string_p, data_p, string_size);
+  }
+} /* ecma_stringbuilder_append */
+
+/**
+ * Append the characters of a magic string to a string builder.
+ */
+void
+ecma_stringbuilder_append_magic (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                 lit_magic_string_id_t id) /**< magic string id */
+{
+  ecma_stringbuilder_append_raw (builder_p, lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+} /* ecma_stringbuilder_append_magic */
+
+/**
+ * Append a cesu-8 byte sequence to a string builder.
+ */
+void
+ecma_stringbuilder_append_raw (ecma_stringbuilder_t *builder_p, /**< string builder */
+                               const lit_utf8_byte_t *data_p, /**< cesu-8 bytes */
+                               lit_utf8_size_t data_size) /**< number of bytes */
+{
+  if (data_size > 0)
+  {
+    memcpy (ecma_stringbuilder_reserve (builder_p, data_size), data_p, data_size);
+  }
+} /* ecma_stringbuilder_append_raw */
+
+/**
+ * Append an ascii character to a string builder.
+ */
+void
+ecma_stringbuilder_append_byte (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                lit_utf8_byte_t byte) /**< ascii character */
+{
+  JERRY_ASSERT (byte <= LIT_UTF8_1_BYTE_CODE_POINT_MAX);
+
+  *ecma_stringbuilder_reserve (builder_p, 1) = byte;
+} /* ecma_stringbuilder_append_byte */
+
+/**
+ * Create an ecma-string from the characters collected by a string builder
+ * and release the buffer of the builder.
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_stringbuilder_finalize (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  if (builder_p->size == 0)
+  {
+    ecma_stringbuilder_destroy (builder_p);
+    return ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+  }
+
+  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (builder_p->buffer_p, builder_p->size);
+
+  ecma_stringbuilder_destroy (builder_p);
+  return string_p;
+} /* ecma_stringbuilder_finalize */
+
+/**
+ * Release the buffer of a string builder without creating a string.
+ */
+void
+ecma_stringbuilder_destroy (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  if (builder_p->buffer_p != NULL)
+  {
+    jmem_heap_free_block (builder_p->buffer_p, builder_p->capacity);
+  }
+
+  ecma_stringbuilder_init (builder_p);
+} /* ecma_stringbuilder_destroy */
+
 /**
  * @}
  * @}
@@ -20,6 +20,7 @@
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "ecma-property-hashmap.h"
+#include "jerry-snapshot.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
 #include "re-compiler.h"
@@ -1430,8 +1431,27 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
     return;
   }
 
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_SNAPSHOT_FUNCTION_STUB)
+  {
+    jerry_snapshot_free_function_stub (bytecode_p);
+    return;
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
   if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
   {
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+    {
+      cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+
+      if (lazy_function_p->bytecode_cp != JMEM_CP_NULL)
+      {
+        ecma_bytecode_deref (ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
+                                                        lazy_function_p->bytecode_cp));
+      }
+    }
+
     jmem_cpointer_t *literal_start_p = NULL;
     uint32_t literal_end;
     uint32_t const_literal_end;
@@ -163,9 +163,15 @@ extern void ecma_free_value_if_not_object (ecma_value_t);
 
 /* ecma-helpers-string.c */
 extern ecma_string_t *ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t);
+extern ecma_string_t *ecma_new_ecma_static_string_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t);
 extern ecma_string_t *ecma_new_ecma_string_from_code_unit (ecma_char_t);
 extern ecma_string_t *ecma_new_ecma_string_from_uint32 (uint32_t);
 extern ecma_string_t *ecma_new_ecma_string_from_number (ecma_number_t);
+extern ecma_string_t *ecma_new_ecma_string_from_number_cached (ecma_number_t);
+extern void ecma_number_string_cache_free (void);
+#ifdef JMEM_STATS
+extern void ecma_number_string_cache_stats_print (void);
+#endif /* JMEM_STATS */
 extern ecma_string_t *ecma_new_ecma_string_from_magic_string_id (lit_magic_string_id_t);
 extern ecma_string_t *ecma_new_ecma_string_from_magic_string_ex_id (lit_magic_string_ex_id_t);
 extern ecma_string_t *ecma_new_ecma_length_string ();
@@ -199,6 +205,14 @@ extern lit_string_hash_t ecma_string_hash (const ecma_string_t *);
 extern ecma_string_t *ecma_string_substr (const ecma_string_t *, ecma_length_t, ecma_length_t);
 extern ecma_string_t *ecma_string_trim (const ecma_string_t *);
 
+extern void ecma_stringbuilder_init (ecma_stringbuilder_t *);
+extern void ecma_stringbuilder_append (ecma_stringbuilder_t *, const ecma_string_t *);
+extern void ecma_stringbuilder_append_magic (ecma_stringbuilder_t *, lit_magic_string_id_t);
+extern void ecma_stringbuilder_append_raw (ecma_stringbuilder_t *, const lit_utf8_byte_t *, lit_utf8_size_t);
+extern void ecma_stringbuilder_append_byte (ecma_stringbuilder_t *, lit_utf8_byte_t);
+extern ecma_string_t *ecma_stringbuilder_finalize (ecma_stringbuilder_t *);
+extern void ecma_stringbuilder_destroy (ecma_stringbuilder_t *);
+
 /* ecma-helpers-number.c */
 extern ecma_number_t ecma_number_make_nan (void);
 extern ecma_number_t ecma_number_make_infinity (bool);
@@ -321,14 +335,17 @@ extern void
 ecma_free_external_pointer_in_property (ecma_property_t *);
 
 /* ecma-helpers-conversion.c */
+extern ecma_number_t ecma_utf8_digits_to_number (const lit_utf8_byte_t *, const lit_utf8_byte_t *, uint32_t);
 extern ecma_number_t ecma_utf8_string_to_number (const lit_utf8_byte_t *, lit_utf8_size_t);
 extern lit_utf8_size_t ecma_uint32_to_utf8_string (uint32_t, lit_utf8_byte_t *, lit_utf8_size_t);
 extern uint32_t ecma_number_to_uint32 (ecma_number_t);
 extern int32_t ecma_number_to_int32 (ecma_number_t);
 extern lit_utf8_size_t ecma_number_to_utf8_string (ecma_number_t, lit_utf8_byte_t *, lit_utf8_size_t);
 
-/* ecma-helpers-errol.c */
-extern lit_utf8_size_t ecma_errol0_dtoa (double, lit_utf8_byte_t *, int32_t *);
+/* ecma-helpers-dtoa.c */
+extern lit_utf8_size_t ecma_grisu3_dtoa (double, lit_utf8_byte_t *, int32_t *);
+extern lit_utf8_size_t ecma_bignum_dtoa (double, lit_utf8_byte_t *, int32_t *);
+extern double ecma_decimal_to_double (uint64_t, int32_t, bool, const lit_utf8_byte_t *, const lit_utf8_byte_t *);
 
 /**
  * @}
@@ -14,13 +14,18 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-enum-cache.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
 #include "ecma-literal-storage.h"
+#include "jcontext.h"
 #include "jmem-allocator.h"
+#include "js-parser.h"
+#include "js-parser-cache.h"
+#include "re-cache.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -37,6 +42,10 @@ ecma_init (void)
 {
   ecma_lcache_init ();
   ecma_init_global_lex_env ();
+  parser_cache_init ();
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  re_cache_init ();
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 
   jmem_register_free_unused_memory_callback (ecma_free_unused_memory);
 } /* ecma_init */
@@ -49,9 +58,25 @@ ecma_finalize (void)
 {
   jmem_unregister_free_unused_memory_callback (ecma_free_unused_memory);
 
+#ifdef JMEM_STATS
+  if (JERRY_CONTEXT (jerry_init_flags) & JERRY_INIT_MEM_STATS)
+  {
+    ecma_number_string_cache_stats_print ();
+    ecma_enum_cache_stats_print ();
+  }
+#endif /* JMEM_STATS */
+
+  ecma_number_string_cache_free ();
+  ecma_enum_cache_free ();
+  parser_cache_finalize ();
+  parser_arena_free_unused ();
+
   ecma_finalize_global_lex_env ();
   ecma_finalize_builtins ();
   ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  re_cache_finalize ();
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
   ecma_finalize_lit_storage ();
 } /* ecma_finalize */
 
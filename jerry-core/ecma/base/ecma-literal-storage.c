@@ -62,16 +62,15 @@ ecma_finalize_lit_storage (void)
 } /* ecma_finalize_lit_storage */
 
 /**
- * Find or create a literal string.
+ * Find a literal string which is equal to the passed string or store the passed string.
+ *
+ * Note: the reference of the passed string is taken over
  *
  * @return ecma_string_t compressed pointer
  */
-jmem_cpointer_t
-ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
-                                    lit_utf8_size_t size) /**< size of the string */
+static jmem_cpointer_t
+ecma_find_or_store_literal_string (ecma_string_t *string_p) /**< string to be searched */
 {
-  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
-
   ecma_lit_storage_item_t *string_list_p = JERRY_CONTEXT (string_list_first_p);
   jmem_cpointer_t *empty_cpointer_p = NULL;
 
@@ -125,6 +124,18 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
   JERRY_CONTEXT (string_list_first_p) = new_item_p;
 
   return result;
+} /* ecma_find_or_store_literal_string */
+
+/**
+ * Find or create a literal string.
+ *
+ * @return ecma_string_t compressed pointer
+ */
+jmem_cpointer_t
+ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
+                                    lit_utf8_size_t size) /**< size of the string */
+{
+  return ecma_find_or_store_literal_string (ecma_new_ecma_string_from_utf8 (chars_p, size));
 } /* ecma_find_or_create_literal_string */
 
 /**
@@ -393,7 +404,9 @@ ecma_load_literals_from_buffer (const uint8_t *buffer_p, /**< buffer with litera
                                 uint32_t lit_table_size, /**< size of literal table in snapshot */
                                 lit_mem_to_snapshot_id_map_entry_t *map_p, /**< literal map */
                                 uint32_t string_count, /**< number of strings */
-                                uint32_t number_count) /**< number of numbers */
+                                uint32_t number_count, /**< number of numbers */
+                                bool is_static) /**< true - string literals refer to the buffer
+                                                 *   false - string literals are copied to the heap */
 {
   /* The zero value is reserved for NULL (no literal)
    * constant so the first literal must have offset one. */
@@ -418,7 +431,19 @@ ecma_load_literals_from_buffer (const uint8_t *buffer_p, /**< buffer with litera
       return false;
     }
 
-    map_p->literal_id = ecma_find_or_create_literal_string (buffer_p + sizeof (uint16_t), length);
+    const lit_utf8_byte_t *chars_p = buffer_p + sizeof (uint16_t);
+    ecma_string_t *string_p;
+
+    if (is_static)
+    {
+      string_p = ecma_new_ecma_static_string_from_utf8 (chars_p, length);
+    }
+    else
+    {
+      string_p = ecma_new_ecma_string_from_utf8 (chars_p, length);
+    }
+
+    map_p->literal_id = ecma_find_or_store_literal_string (string_p);
     map_p->literal_offset = (jmem_cpointer_t) (literal_offset >> JERRY_SNAPSHOT_LITERAL_ALIGNMENT_LOG);
     map_p++;
 
@@ -459,6 +484,10 @@ ecma_load_literals_from_buffer (const uint8_t *buffer_p, /**< buffer with litera
 /**
  * Load literals from snapshot.
  *
+ * Note:
+ *      when is_static is true, the string literals refer to the characters in the buffer,
+ *      so the buffer must be kept alive until the engine is cleaned up
+ *
  * @return true, if load was performed successfully (i.e. literals saved in the snapshot are consistent),
  *         false - otherwise (i.e. snapshot is incorrect).
  */
@@ -469,7 +498,9 @@ ecma_load_literals_from_snapshot (const uint8_t *buffer_p, /**< buffer with lite
                                                                                    *   in snapshot to identifiers
                                                                                    *   of loaded literals in literal
                                                                                    *   storage */
-                                  uint32_t *out_map_len_p) /**< [out] literals number */
+                                  uint32_t *out_map_len_p, /**< [out] literals number */
+                                  bool is_static) /**< true - string literals refer to the buffer
+                                                   *   false - string literals are copied to the heap */
 {
   *out_map_p = NULL;
 
@@ -496,7 +527,7 @@ ecma_load_literals_from_snapshot (const uint8_t *buffer_p, /**< buffer with lite
   map_p = jmem_heap_alloc_block (total_count * sizeof (lit_mem_to_snapshot_id_map_entry_t));
   *out_map_p = map_p;
 
-  if (ecma_load_literals_from_buffer (buffer_p, lit_table_size, map_p, string_count, number_count))
+  if (ecma_load_literals_from_buffer (buffer_p, lit_table_size, map_p, string_count, number_count, is_static))
   {
     return true;
   }
@@ -51,7 +51,7 @@ ecma_save_literals_for_snapshot (uint8_t *, size_t, size_t *,
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 extern bool
 ecma_load_literals_from_snapshot (const uint8_t *, uint32_t,
-                                  lit_mem_to_snapshot_id_map_entry_t **, uint32_t *);
+                                  lit_mem_to_snapshot_id_map_entry_t **, uint32_t *, bool);
 #endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
 
 /**
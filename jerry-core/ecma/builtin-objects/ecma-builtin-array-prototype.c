@@ -175,36 +175,31 @@ ecma_builtin_array_prototype_object_to_locale_string (const ecma_value_t this_ar
                     ecma_builtin_helper_get_to_locale_string_at_index (obj_p, 0),
                     ret_value);
 
-    ecma_string_t *return_string_p = ecma_get_string_from_value (first_value);
-    ecma_ref_ecma_string (return_string_p);
+    ecma_stringbuilder_t builder;
+    ecma_stringbuilder_init (&builder);
+    ecma_stringbuilder_append (&builder, ecma_get_string_from_value (first_value));
 
     /* 9-10. */
     for (uint32_t k = 1; ecma_is_value_empty (ret_value) && (k < length); k++)
     {
-      ecma_string_t *part_string_p = ecma_concat_ecma_strings (return_string_p, separator_string_p);
+      ecma_stringbuilder_append (&builder, separator_string_p);
 
       ECMA_TRY_CATCH (next_string_value,
                       ecma_builtin_helper_get_to_locale_string_at_index (obj_p, k),
                       ret_value);
 
-      ecma_string_t *next_string_p = ecma_get_string_from_value (next_string_value);
-
-      ecma_deref_ecma_string (return_string_p);
-
-      return_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+      ecma_stringbuilder_append (&builder, ecma_get_string_from_value (next_string_value));
 
       ECMA_FINALIZE (next_string_value);
-
-      ecma_deref_ecma_string (part_string_p);
     }
 
     if (ecma_is_value_empty (ret_value))
     {
-      ret_value = ecma_make_string_value (return_string_p);
+      ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
     }
     else
     {
-      ecma_deref_ecma_string (return_string_p);
+      ecma_stringbuilder_destroy (&builder);
     }
 
     ECMA_FINALIZE (first_value);
@@ -403,39 +398,34 @@ ecma_builtin_array_prototype_join (const ecma_value_t this_arg, /**< this argume
                     ecma_op_array_get_to_string_at_index (obj_p, 0),
                     ret_value);
 
-    ecma_string_t *return_string_p = ecma_get_string_from_value (first_value);
-    ecma_ref_ecma_string (return_string_p);
+    ecma_stringbuilder_t builder;
+    ecma_stringbuilder_init (&builder);
+    ecma_stringbuilder_append (&builder, ecma_get_string_from_value (first_value));
 
     /* 9-10. */
     for (uint32_t k = 1; ecma_is_value_empty (ret_value) && (k < length); k++)
     {
       /* 10.a */
-      ecma_string_t *part_string_p = ecma_concat_ecma_strings (return_string_p, separator_string_p);
+      ecma_stringbuilder_append (&builder, separator_string_p);
 
       /* 10.b, 10.c */
       ECMA_TRY_CATCH (next_string_value,
                       ecma_op_array_get_to_string_at_index (obj_p, k),
                       ret_value);
 
-      ecma_string_t *next_string_p = ecma_get_string_from_value (next_string_value);
-
-      ecma_deref_ecma_string (return_string_p);
-
       /* 10.d */
-      return_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+      ecma_stringbuilder_append (&builder, ecma_get_string_from_value (next_string_value));
 
       ECMA_FINALIZE (next_string_value);
-
-      ecma_deref_ecma_string (part_string_p);
     }
 
     if (ecma_is_value_empty (ret_value))
     {
-      ret_value = ecma_make_string_value (return_string_p);
+      ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
     }
     else
     {
-      ecma_deref_ecma_string (return_string_p);
+      ecma_stringbuilder_destroy (&builder);
     }
 
     ECMA_FINALIZE (first_value);
@@ -750,6 +740,12 @@ ecma_builtin_array_prototype_object_shift (ecma_value_t this_arg) /**< this argu
     /* 5. */
     ECMA_TRY_CATCH (first_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
 
+    if (ecma_op_array_object_relocate_elements (obj_p, len, 0, 1, NULL, 0))
+    {
+      /* 6. - 9. are done in bulk. */
+      ret_value = ecma_copy_value (first_value);
+    }
+
     /* 6. and 7. */
     for (uint32_t k = 1; k < len && ecma_is_value_empty (ret_value); k++)
     {
@@ -929,255 +925,565 @@ ecma_builtin_array_prototype_object_slice (ecma_value_t this_arg, /**< 'this' ar
   return ret_value;
 } /* ecma_builtin_array_prototype_object_slice */
 
+/**
+ * Comparison modes of Array.prototype.sort
+ */
+typedef enum
+{
+  ECMA_ARRAY_SORT_INTEGERS, /**< default comparison of direct integer values */
+  ECMA_ARRAY_SORT_STRINGS, /**< default comparison of the precomputed string keys */
+  ECMA_ARRAY_SORT_COMPAREFN /**< comparison with the user provided compare function */
+} ecma_array_sort_mode_t;
+
+/**
+ * Element of the array being sorted
+ */
+typedef struct
+{
+  ecma_value_t value; /**< element value */
+  ecma_value_t key; /**< string form of the value in ECMA_ARRAY_SORT_STRINGS mode, empty value otherwise */
+} ecma_array_sort_entry_t;
+
+/**
+ * Maximum number of pending runs
+ *
+ * Note:
+ *      run lengths on the stack grow at least as fast as the Fibonacci numbers,
+ *      so this limit is enough for any array which fits into the address space
+ */
+#define ECMA_ARRAY_SORT_MAX_RUNS 48
+
+/**
+ * Minimum length of a merged run is between ECMA_ARRAY_SORT_MIN_MERGE / 2 and ECMA_ARRAY_SORT_MIN_MERGE
+ */
+#define ECMA_ARRAY_SORT_MIN_MERGE 32
+
+/**
+ * State of the merge sort
+ */
+typedef struct
+{
+  ecma_value_t comparefn; /**< compare function */
+  ecma_array_sort_mode_t mode; /**< comparison mode */
+  ecma_array_sort_entry_t *temp_p; /**< temporary buffer of the merges (allocated on first use) */
+  uint32_t temp_size; /**< number of entries in the temporary buffer */
+  uint32_t run_count; /**< number of pending runs */
+  uint32_t run_base[ECMA_ARRAY_SORT_MAX_RUNS]; /**< start index of pending runs */
+  uint32_t run_length[ECMA_ARRAY_SORT_MAX_RUNS]; /**< length of pending runs */
+} ecma_array_sort_context_t;
+
+/**
+ * Count the decimal digits of an unsigned integer
+ *
+ * @return number of digits
+ */
+static uint32_t
+ecma_builtin_array_prototype_object_sort_digits (uint32_t value) /**< value */
+{
+  uint32_t digits = 1;
+
+  while (value >= 10)
+  {
+    value /= 10;
+    digits++;
+  }
+
+  return digits;
+} /* ecma_builtin_array_prototype_object_sort_digits */
+
+/**
+ * Compare the decimal string forms of two integers without creating the strings
+ *
+ * @return true - if the string form of left is less than the string form of right
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_array_prototype_object_sort_integer_less (ecma_integer_value_t left, /**< left value */
+                                                       ecma_integer_value_t right) /**< right value */
+{
+  /* The '-' sign is less than any decimal digit. */
+  if ((left < 0) != (right < 0))
+  {
+    return left < 0;
+  }
+
+  uint64_t left_abs = (uint64_t) (left < 0 ? -(int64_t) left : left);
+  uint64_t right_abs = (uint64_t) (right < 0 ? -(int64_t) right : right);
+
+  if (left_abs == right_abs)
+  {
+    return false;
+  }
+
+  uint32_t left_digits = ecma_builtin_array_prototype_object_sort_digits ((uint32_t) left_abs);
+  uint32_t right_digits = ecma_builtin_array_prototype_object_sort_digits ((uint32_t) right_abs);
+  bool is_left_shorter = left_digits < right_digits;
+
+  /* Align the first digits of the two numbers. */
+  while (left_digits < right_digits)
+  {
+    left_abs *= 10;
+    left_digits++;
+  }
+
+  while (right_digits < left_digits)
+  {
+    right_abs *= 10;
+    right_digits++;
+  }
+
+  if (left_abs == right_abs)
+  {
+    /* One string is a proper prefix of the other one, the shorter is less. */
+    return is_left_shorter;
+  }
+
+  return left_abs < right_abs;
+} /* ecma_builtin_array_prototype_object_sort_integer_less */
+
 /**
  * SortCompare abstract method
  *
  * See also:
  *          ECMA-262 v5, 15.4.4.11
  *
- * @return ecma value
+ * Note:
+ *      undefined values are never passed to this function, they are moved to the
+ *      end of the result before the sort starts
+ *
+ * @return true or false simple value - whether left is ordered before right
+ *         error - if the compare function or a type conversion throws
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
-ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< left value */
-                                                         ecma_value_t k, /**< right value */
-                                                         ecma_value_t comparefn) /**< compare function */
+ecma_builtin_array_prototype_object_sort_compare_helper (ecma_array_sort_context_t *context_p, /**< sort context */
+                                                         const ecma_array_sort_entry_t *left_p, /**< left entry */
+                                                         const ecma_array_sort_entry_t *right_p) /**< right entry */
 {
+  if (context_p->mode == ECMA_ARRAY_SORT_INTEGERS)
+  {
+    bool is_less = ecma_builtin_array_prototype_object_sort_integer_less (ecma_get_integer_from_value (left_p->value),
+                                                                          ecma_get_integer_from_value (right_p->value));
+    return ecma_make_boolean_value (is_less);
+  }
+
+  if (context_p->mode == ECMA_ARRAY_SORT_STRINGS)
+  {
+    ecma_string_t *left_str_p = ecma_get_string_from_value (left_p->key);
+    ecma_string_t *right_str_p = ecma_get_string_from_value (right_p->key);
+
+    return ecma_make_boolean_value (left_str_p != right_str_p
+                                    && ecma_compare_ecma_strings_relational (left_str_p, right_str_p));
+  }
+
   /*
-   * ECMA-262 v5, 15.4.4.11 NOTE1: Because non-existent property values always
-   * compare greater than undefined property values, and undefined always
-   * compares greater than any other value, undefined property values always
-   * sort to the end of the result, followed by non-existent property values.
+   * comparefn, if not undefined, will always contain a callable function object.
+   * We checked this previously, before this function was called.
    */
+  JERRY_ASSERT (ecma_op_is_callable (context_p->comparefn));
+  ecma_object_t *comparefn_obj_p = ecma_get_object_from_value (context_p->comparefn);
+
+  ecma_value_t compare_args[] = { left_p->value, right_p->value };
+
+  ecma_value_t call_value = ecma_op_function_call (comparefn_obj_p,
+                                                   ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
+                                                   compare_args,
+                                                   2);
+
+  if (ECMA_IS_VALUE_ERROR (call_value))
+  {
+    return call_value;
+  }
+
+  /* Numeric comparators usually return integers, which need no conversion. */
+  if (ecma_is_value_integer_number (call_value))
+  {
+    return ecma_make_boolean_value (ecma_get_integer_from_value (call_value) < 0);
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
-  ecma_number_t result = ECMA_NUMBER_ZERO;
 
-  bool j_is_undef = ecma_is_value_undefined (j);
-  bool k_is_undef = ecma_is_value_undefined (k);
+  ECMA_OP_TO_NUMBER_TRY_CATCH (ret_num, call_value, ret_value);
+
+  /* NaN compares as equal. */
+  ret_value = ecma_make_boolean_value (ret_num < ECMA_NUMBER_ZERO);
+
+  ECMA_OP_TO_NUMBER_FINALIZE (ret_num);
+
+  ecma_free_value (call_value);
+  return ret_value;
+} /* ecma_builtin_array_prototype_object_sort_compare_helper */
+
+/**
+ * Find the run starting at 'start' and make it ascending.
+ *
+ * Strictly descending runs are reversed, which keeps the sort stable.
+ *
+ * @return empty value - if successful, the length of the run is stored into run_length_p
+ *         error - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_array_prototype_object_sort_count_run (ecma_array_sort_context_t *context_p, /**< sort context */
+                                                    ecma_array_sort_entry_t *array_p, /**< entries */
+                                                    uint32_t start, /**< start index of the run */
+                                                    uint32_t end, /**< end index of the entries */
+                                                    uint32_t *run_length_p) /**< [out] length of the run */
+{
+  uint32_t index = start + 1;
+
+  if (index >= end)
+  {
+    *run_length_p = end - start;
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  }
+
+  ecma_value_t less_value = ecma_builtin_array_prototype_object_sort_compare_helper (context_p,
+                                                                                     array_p + index,
+                                                                                     array_p + index - 1);
 
-  if (j_is_undef)
+  if (ECMA_IS_VALUE_ERROR (less_value))
   {
-    if (k_is_undef)
+    return less_value;
+  }
+
+  bool is_descending = ecma_is_value_true (less_value);
+
+  for (index++; index < end; index++)
+  {
+    less_value = ecma_builtin_array_prototype_object_sort_compare_helper (context_p,
+                                                                          array_p + index,
+                                                                          array_p + index - 1);
+
+    if (ECMA_IS_VALUE_ERROR (less_value))
     {
-      result = ECMA_NUMBER_ZERO;
+      return less_value;
     }
-    else
+
+    if (ecma_is_value_true (less_value) != is_descending)
     {
-      result = ECMA_NUMBER_ONE;
+      break;
     }
   }
-  else
+
+  if (is_descending)
   {
-    if (k_is_undef)
+    ecma_array_sort_entry_t *low_p = array_p + start;
+    ecma_array_sort_entry_t *high_p = array_p + index - 1;
+
+    while (low_p < high_p)
     {
-      result = ECMA_NUMBER_MINUS_ONE;
+      ecma_array_sort_entry_t swap = *low_p;
+      *low_p++ = *high_p;
+      *high_p-- = swap;
     }
-    else
+  }
+
+  *run_length_p = index - start;
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+} /* ecma_builtin_array_prototype_object_sort_count_run */
+
+/**
+ * Extend the sorted range [start, sorted_end) to [start, end) with binary insertion.
+ *
+ * @return empty value - if successful
+ *         error - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_array_prototype_object_sort_insertion (ecma_array_sort_context_t *context_p, /**< sort context */
+                                                    ecma_array_sort_entry_t *array_p, /**< entries */
+                                                    uint32_t start, /**< start index of the range */
+                                                    uint32_t sorted_end, /**< end of the already sorted part */
+                                                    uint32_t end) /**< end index of the range */
+{
+  for (uint32_t index = sorted_end; index < end; index++)
+  {
+    uint32_t low = start;
+    uint32_t high = index;
+
+    /* Find the position after the last element which is not greater than the pivot. */
+    while (low < high)
     {
-      if (ecma_is_value_undefined (comparefn))
-      {
-        /* Default comparison when no comparefn is passed. */
-        ECMA_TRY_CATCH (j_value, ecma_op_to_string (j), ret_value);
-        ECMA_TRY_CATCH (k_value, ecma_op_to_string (k), ret_value);
-        ecma_string_t *j_str_p = ecma_get_string_from_value (j_value);
-        ecma_string_t *k_str_p = ecma_get_string_from_value (k_value);
+      uint32_t middle = low + ((high - low) >> 1);
 
-        if (ecma_compare_ecma_strings_relational (j_str_p, k_str_p))
-        {
-          result = ECMA_NUMBER_MINUS_ONE;
-        }
-        else if (!ecma_compare_ecma_strings (j_str_p, k_str_p))
-        {
-          result = ECMA_NUMBER_ONE;
-        }
-        else
-        {
-          result = ECMA_NUMBER_ZERO;
-        }
+      ecma_value_t less_value = ecma_builtin_array_prototype_object_sort_compare_helper (context_p,
+                                                                                         array_p + index,
+                                                                                         array_p + middle);
 
-        ECMA_FINALIZE (k_value);
-        ECMA_FINALIZE (j_value);
+      if (ECMA_IS_VALUE_ERROR (less_value))
+      {
+        return less_value;
+      }
+
+      if (ecma_is_value_true (less_value))
+      {
+        high = middle;
       }
       else
       {
-        /*
-         * comparefn, if not undefined, will always contain a callable function object.
-         * We checked this previously, before this function was called.
-         */
-        JERRY_ASSERT (ecma_op_is_callable (comparefn));
-        ecma_object_t *comparefn_obj_p = ecma_get_object_from_value (comparefn);
-
-        ecma_value_t compare_args[] = {j, k};
-
-        ECMA_TRY_CATCH (call_value,
-                        ecma_op_function_call (comparefn_obj_p,
-                                               ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
-                                               compare_args,
-                                               2),
-                        ret_value);
-
-        if (!ecma_is_value_number (call_value))
-        {
-          ECMA_OP_TO_NUMBER_TRY_CATCH (ret_num, call_value, ret_value);
-          result = ret_num;
-          ECMA_OP_TO_NUMBER_FINALIZE (ret_num);
-        }
-        else
-        {
-          result = ecma_get_number_from_value (call_value);
-        }
-
-        ECMA_FINALIZE (call_value);
+        low = middle + 1;
       }
     }
-  }
 
-  if (ecma_is_value_empty (ret_value))
-  {
-    ret_value = ecma_make_number_value (result);
+    ecma_array_sort_entry_t pivot = array_p[index];
+    memmove (array_p + low + 1, array_p + low, (index - low) * sizeof (ecma_array_sort_entry_t));
+    array_p[low] = pivot;
   }
 
-  return ret_value;
-} /* ecma_builtin_array_prototype_object_sort_compare_helper */
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+} /* ecma_builtin_array_prototype_object_sort_insertion */
 
 /**
- * Function used to reconstruct the ordered binary tree.
- * Shifts 'index' down in the tree until it is in the correct position.
+ * Merge the pending runs at 'run_index' and 'run_index + 1'.
  *
- * @return ecma value
+ * The shorter run is moved into the temporary buffer, so the buffer never needs
+ * to be larger than half of the entries. When a comparison throws, the entries
+ * still in the buffer are moved back, so every value remains in the array.
+ *
+ * @return empty value - if successful
+ *         error - otherwise
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
-ecma_builtin_array_prototype_object_array_to_heap_helper (ecma_value_t array[], /**< heap data array */
-                                                          int index, /**< current item index */
-                                                          int right, /**< right index is a maximum index */
-                                                          ecma_value_t comparefn) /**< compare function */
+ecma_builtin_array_prototype_object_sort_merge_at (ecma_array_sort_context_t *context_p, /**< sort context */
+                                                   ecma_array_sort_entry_t *array_p, /**< entries */
+                                                   uint32_t run_index) /**< index of the first run */
 {
-  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t left_base = context_p->run_base[run_index];
+  uint32_t left_length = context_p->run_length[run_index];
+  uint32_t right_base = context_p->run_base[run_index + 1];
+  uint32_t right_length = context_p->run_length[run_index + 1];
 
-  /* Left child of the current index. */
-  int child = index * 2 + 1;
-  ecma_value_t swap = array[index];
-  bool should_break = false;
+  JERRY_ASSERT (left_base + left_length == right_base);
 
-  while (child <= right && ecma_is_value_empty (ret_value) && !should_break)
+  context_p->run_length[run_index] = left_length + right_length;
+
+  if (run_index + 3 == context_p->run_count)
   {
-    if (child < right)
-    {
-      /* Compare the two child nodes. */
-      ECMA_TRY_CATCH (child_compare_value,
-                      ecma_builtin_array_prototype_object_sort_compare_helper (array[child],
-                                                                               array[child + 1],
-                                                                               comparefn),
-                      ret_value);
+    context_p->run_base[run_index + 1] = context_p->run_base[run_index + 2];
+    context_p->run_length[run_index + 1] = context_p->run_length[run_index + 2];
+  }
 
-      JERRY_ASSERT (ecma_is_value_number (child_compare_value));
+  context_p->run_count--;
 
-      /* Use the child that is greater. */
-      if (ecma_get_number_from_value (child_compare_value) < ECMA_NUMBER_ZERO)
+  /* The runs are already in order when the last left entry is not greater than the first right entry. */
+  ecma_value_t less_value = ecma_builtin_array_prototype_object_sort_compare_helper (context_p,
+                                                                                     array_p + right_base,
+                                                                                     array_p + right_base - 1);
+
+  if (ECMA_IS_VALUE_ERROR (less_value))
+  {
+    return less_value;
+  }
+
+  if (!ecma_is_value_true (less_value))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  }
+
+  if (context_p->temp_p == NULL)
+  {
+    JERRY_ASSERT (context_p->temp_size > 0);
+    context_p->temp_p = jmem_heap_alloc_block (context_p->temp_size * sizeof (ecma_array_sort_entry_t));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_array_sort_entry_t *temp_p = context_p->temp_p;
+
+  if (left_length <= right_length)
+  {
+    JERRY_ASSERT (left_length <= context_p->temp_size);
+    memcpy (temp_p, array_p + left_base, left_length * sizeof (ecma_array_sort_entry_t));
+
+    ecma_array_sort_entry_t *dest_p = array_p + left_base;
+    ecma_array_sort_entry_t *left_p = temp_p;
+    ecma_array_sort_entry_t *left_end_p = temp_p + left_length;
+    ecma_array_sort_entry_t *right_p = array_p + right_base;
+    ecma_array_sort_entry_t *right_end_p = right_p + right_length;
+
+    /* Merge from the front: the right entry is taken only when it is less, which keeps equal entries in order. */
+    while (left_p < left_end_p && right_p < right_end_p)
+    {
+      less_value = ecma_builtin_array_prototype_object_sort_compare_helper (context_p, right_p, left_p);
+
+      if (ECMA_IS_VALUE_ERROR (less_value))
       {
-        child++;
+        ret_value = less_value;
+        break;
       }
 
-      ECMA_FINALIZE (child_compare_value);
+      *dest_p++ = ecma_is_value_true (less_value) ? *right_p++ : *left_p++;
     }
 
-    if (ecma_is_value_empty (ret_value))
-    {
-      JERRY_ASSERT (child <= right);
+    memcpy (dest_p, left_p, (size_t) (left_end_p - left_p) * sizeof (ecma_array_sort_entry_t));
+  }
+  else
+  {
+    JERRY_ASSERT (right_length <= context_p->temp_size);
+    memcpy (temp_p, array_p + right_base, right_length * sizeof (ecma_array_sort_entry_t));
 
-      /* Compare current child node with the swap (tree top). */
-      ECMA_TRY_CATCH (swap_compare_value,
-                      ecma_builtin_array_prototype_object_sort_compare_helper (array[child],
-                                                                               swap,
-                                                                               comparefn),
-                      ret_value);
-      JERRY_ASSERT (ecma_is_value_number (swap_compare_value));
+    ecma_array_sort_entry_t *dest_p = array_p + right_base + right_length;
+    ecma_array_sort_entry_t *left_p = array_p + right_base;
+    ecma_array_sort_entry_t *left_start_p = array_p + left_base;
+    ecma_array_sort_entry_t *right_p = temp_p + right_length;
 
-      if (ecma_get_number_from_value (swap_compare_value) <= ECMA_NUMBER_ZERO)
-      {
-        /* Break from loop if current child is less than swap (tree top) */
-        should_break = true;
-      }
-      else
-      {
-        /* We have to move 'swap' lower in the tree, so shift current child up in the hierarchy. */
-        int parent = (child - 1) / 2;
-        JERRY_ASSERT (parent >= 0 && parent <= right);
-        array[parent] = array[child];
+    /* Merge from the back: the left entry is taken only when the right one is less. */
+    while (left_p > left_start_p && right_p > temp_p)
+    {
+      less_value = ecma_builtin_array_prototype_object_sort_compare_helper (context_p, right_p - 1, left_p - 1);
 
-        /* Update child to be the left child of the current node. */
-        child = child * 2 + 1;
+      if (ECMA_IS_VALUE_ERROR (less_value))
+      {
+        ret_value = less_value;
+        break;
       }
 
-      ECMA_FINALIZE (swap_compare_value);
+      *(--dest_p) = ecma_is_value_true (less_value) ? *(--left_p) : *(--right_p);
     }
+
+    size_t remaining = (size_t) (right_p - temp_p);
+    memcpy (dest_p - remaining, temp_p, remaining * sizeof (ecma_array_sort_entry_t));
   }
 
-  if (ecma_is_value_empty (ret_value))
+  return ret_value;
+} /* ecma_builtin_array_prototype_object_sort_merge_at */
+
+/**
+ * Merge the pending runs until the run lengths satisfy the invariants
+ *     run_length[i - 2] > run_length[i - 1] + run_length[i] and run_length[i - 1] > run_length[i]
+ *
+ * @return empty value - if successful
+ *         error - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_array_prototype_object_sort_merge_collapse (ecma_array_sort_context_t *context_p, /**< sort context */
+                                                         ecma_array_sort_entry_t *array_p, /**< entries */
+                                                         bool force) /**< merge all runs */
+{
+  uint32_t *run_length_p = context_p->run_length;
+
+  while (context_p->run_count > 1)
   {
-    /*
-     * Loop ended, either current child does not exist, or is less than swap.
-     * This means that 'swap' should be placed in the parent node.
-     */
-    int parent = (child - 1) / 2;
-    JERRY_ASSERT (parent >= 0 && parent <= right);
-    array[parent] = swap;
+    uint32_t index = context_p->run_count - 2;
 
-    ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    if (!force)
+    {
+      if ((index > 0 && run_length_p[index - 1] <= run_length_p[index] + run_length_p[index + 1])
+          || (index > 1 && run_length_p[index - 2] <= run_length_p[index - 1] + run_length_p[index]))
+      {
+        if (run_length_p[index - 1] < run_length_p[index + 1])
+        {
+          index--;
+        }
+      }
+      else if (run_length_p[index] > run_length_p[index + 1])
+      {
+        break;
+      }
+    }
+    else if (index > 0 && run_length_p[index - 1] < run_length_p[index + 1])
+    {
+      index--;
+    }
+
+    ecma_value_t merge_value = ecma_builtin_array_prototype_object_sort_merge_at (context_p, array_p, index);
+
+    if (ECMA_IS_VALUE_ERROR (merge_value))
+    {
+      return merge_value;
+    }
   }
 
-  return ret_value;
-} /* ecma_builtin_array_prototype_object_array_to_heap_helper */
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+} /* ecma_builtin_array_prototype_object_sort_merge_collapse */
 
 /**
- * Heapsort function
+ * Stable merge sort which exploits the already ordered runs of the input (TimSort without galloping)
  *
- * @return ecma value
+ * @return empty value - if successful
+ *         error - otherwise, the entries are in unspecified order in this case
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
-ecma_builtin_array_prototype_object_array_heap_sort_helper (ecma_value_t array[], /**< array to sort */
-                                                            int right, /**< right index */
-                                                            ecma_value_t comparefn) /**< compare function */
+ecma_builtin_array_prototype_object_merge_sort_helper (ecma_array_sort_entry_t array[], /**< entries to sort */
+                                                       uint32_t length, /**< number of entries */
+                                                       ecma_array_sort_mode_t mode, /**< comparison mode */
+                                                       ecma_value_t comparefn) /**< compare function */
 {
+  ecma_array_sort_context_t context;
+  context.comparefn = comparefn;
+  context.mode = mode;
+  context.temp_p = NULL;
+  context.temp_size = length / 2;
+  context.run_count = 0;
+
+  /* Runs shorter than min_run are extended with insertion sort, so the number of runs is close to a power of 2. */
+  uint32_t min_run = length;
+  uint32_t min_run_round = 0;
+
+  while (min_run >= ECMA_ARRAY_SORT_MIN_MERGE)
+  {
+    min_run_round |= min_run & 0x1;
+    min_run >>= 1;
+  }
+
+  min_run += min_run_round;
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t start = 0;
 
-  /* First, construct the ordered binary tree from the array. */
-  for (int i = right / 2; i >= 0 && ecma_is_value_empty (ret_value); i--)
+  while (start < length)
   {
-    ECMA_TRY_CATCH (value,
-                    ecma_builtin_array_prototype_object_array_to_heap_helper (array,
-                                                                              i,
-                                                                              right,
-                                                                              comparefn),
-                    ret_value);
-    ECMA_FINALIZE (value);
+    uint32_t run_length = 0;
+    ret_value = ecma_builtin_array_prototype_object_sort_count_run (&context, array, start, length, &run_length);
+
+    if (ECMA_IS_VALUE_ERROR (ret_value))
+    {
+      break;
+    }
+
+    if (run_length < min_run)
+    {
+      uint32_t extended_length = JERRY_MIN (min_run, length - start);
+
+      ret_value = ecma_builtin_array_prototype_object_sort_insertion (&context,
+                                                                      array,
+                                                                      start,
+                                                                      start + run_length,
+                                                                      start + extended_length);
+
+      if (ECMA_IS_VALUE_ERROR (ret_value))
+      {
+        break;
+      }
+
+      run_length = extended_length;
+    }
+
+    JERRY_ASSERT (context.run_count < ECMA_ARRAY_SORT_MAX_RUNS);
+    context.run_base[context.run_count] = start;
+    context.run_length[context.run_count] = run_length;
+    context.run_count++;
+
+    start += run_length;
+
+    ret_value = ecma_builtin_array_prototype_object_sort_merge_collapse (&context, array, start == length);
+
+    if (ECMA_IS_VALUE_ERROR (ret_value))
+    {
+      break;
+    }
   }
 
-  /* Sorting elements. */
-  for (int i = right; i > 0 && ecma_is_value_empty (ret_value); i--)
+  if (context.temp_p != NULL)
   {
-    /*
-     * The top element will always contain the largest value.
-     * Move top to the end, and remove it from the tree.
-     */
-    ecma_value_t swap = array[0];
-    array[0] = array[i];
-    array[i] = swap;
-
-    /* Rebuild binary tree from the remaining elements. */
-    ECMA_TRY_CATCH (value,
-                    ecma_builtin_array_prototype_object_array_to_heap_helper (array,
-                                                                              0,
-                                                                              i - 1,
-                                                                              comparefn),
-                    ret_value);
-    ECMA_FINALIZE (value);
+    jmem_heap_free_block (context.temp_p, context.temp_size * sizeof (ecma_array_sort_entry_t));
   }
 
   return ret_value;
-} /* ecma_builtin_array_prototype_object_array_heap_sort_helper */
+} /* ecma_builtin_array_prototype_object_merge_sort_helper */
 
 /**
  * The Array.prototype object's 'sort' routine
@@ -1215,112 +1521,173 @@ ecma_builtin_array_prototype_object_sort (ecma_value_t this_arg, /**< this argum
 
   uint32_t len = ecma_number_to_uint32 (len_number);
 
-  ecma_collection_header_t *array_index_props_p = ecma_op_object_get_property_names (obj_p, true, false, false);
-
-  uint32_t defined_prop_count = 0;
+  /* Dense arrays are read by index, without listing their property names. */
+  ecma_collection_header_t *array_index_props_p = NULL;
+  uint32_t defined_prop_count = len;
   uint32_t copied_num = 0;
+  uint32_t undefined_count = 0;
 
   ecma_collection_iterator_t iter;
-  ecma_collection_iterator_init (&iter, array_index_props_p);
 
-  /* Count properties with name that is array index less than len */
-  while (ecma_collection_iterator_next (&iter)
-         && ecma_is_value_empty (ret_value))
+  if (!ecma_op_object_has_dense_array_indices (obj_p, len))
   {
-    ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+    array_index_props_p = ecma_op_object_get_property_names (obj_p, true, false, false);
+    defined_prop_count = 0;
 
-    uint32_t index;
-    bool is_index = ecma_string_get_array_index (property_name_p, &index);
-    JERRY_ASSERT (is_index);
+    ecma_collection_iterator_init (&iter, array_index_props_p);
 
-    if (index < len)
+    /* Count properties with name that is array index less than len */
+    while (ecma_collection_iterator_next (&iter)
+           && ecma_is_value_empty (ret_value))
     {
-      defined_prop_count++;
+      ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+
+      uint32_t index;
+      bool is_index = ecma_string_get_array_index (property_name_p, &index);
+      JERRY_ASSERT (is_index);
+
+      if (index < len)
+      {
+        defined_prop_count++;
+      }
     }
+
+    ecma_collection_iterator_init (&iter, array_index_props_p);
   }
 
-  JMEM_DEFINE_LOCAL_ARRAY (values_buffer, defined_prop_count, ecma_value_t);
+  JMEM_DEFINE_LOCAL_ARRAY (values_buffer, defined_prop_count, ecma_array_sort_entry_t);
 
-  ecma_collection_iterator_init (&iter, array_index_props_p);
+  /* Copy unsorted array into a native c array, undefined values are only counted. */
+  bool is_integer_array = true;
 
-  /* Copy unsorted array into a native c array. */
-  while (ecma_collection_iterator_next (&iter)
-         && ecma_is_value_empty (ret_value))
+  for (uint32_t index = 0;
+       index < defined_prop_count && ecma_is_value_empty (ret_value);
+       index++)
   {
-    ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+    ecma_string_t *property_name_p;
 
-    uint32_t index;
-    bool is_index = ecma_string_get_array_index (property_name_p, &index);
-    JERRY_ASSERT (is_index);
-
-    if (index >= len)
+    if (array_index_props_p == NULL)
     {
-      break;
+      property_name_p = ecma_new_ecma_string_from_uint32 (index);
+    }
+    else
+    {
+      /* The names are listed in ascending order, so the first ones are less than len. */
+      bool has_next = ecma_collection_iterator_next (&iter);
+      JERRY_ASSERT (has_next);
+
+      property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+      ecma_ref_ecma_string (property_name_p);
     }
 
     ECMA_TRY_CATCH (index_value, ecma_op_object_get (obj_p, property_name_p), ret_value);
 
-    values_buffer[copied_num++] = ecma_copy_value (index_value);
+    if (ecma_is_value_undefined (index_value))
+    {
+      undefined_count++;
+    }
+    else
+    {
+      is_integer_array = is_integer_array && ecma_is_value_integer_number (index_value);
+
+      values_buffer[copied_num].value = ecma_copy_value (index_value);
+      values_buffer[copied_num].key = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+      copied_num++;
+    }
 
     ECMA_FINALIZE (index_value);
+
+    ecma_deref_ecma_string (property_name_p);
   }
 
-  JERRY_ASSERT (copied_num == defined_prop_count
+  JERRY_ASSERT (copied_num + undefined_count == defined_prop_count
                 || !ecma_is_value_empty (ret_value));
 
+  ecma_array_sort_mode_t sort_mode = ECMA_ARRAY_SORT_COMPAREFN;
+
+  if (ecma_is_value_undefined (arg1))
+  {
+    sort_mode = is_integer_array ? ECMA_ARRAY_SORT_INTEGERS : ECMA_ARRAY_SORT_STRINGS;
+  }
+
+  /* Convert every value to string only once, instead of converting them before each comparison. */
+  for (uint32_t index = 0;
+       index < copied_num && sort_mode == ECMA_ARRAY_SORT_STRINGS && ecma_is_value_empty (ret_value);
+       index++)
+  {
+    ecma_value_t key = ecma_op_to_string (values_buffer[index].value);
+
+    if (ECMA_IS_VALUE_ERROR (key))
+    {
+      ret_value = key;
+    }
+    else
+    {
+      values_buffer[index].key = key;
+    }
+  }
+
   /* Sorting. */
   if (copied_num > 1 && ecma_is_value_empty (ret_value))
   {
-    ECMA_TRY_CATCH (sort_value,
-                    ecma_builtin_array_prototype_object_array_heap_sort_helper (values_buffer,
-                                                                                (int)(copied_num - 1),
-                                                                                arg1),
-                    ret_value);
-    ECMA_FINALIZE (sort_value);
+    ret_value = ecma_builtin_array_prototype_object_merge_sort_helper (values_buffer,
+                                                                       copied_num,
+                                                                       sort_mode,
+                                                                       arg1);
   }
 
-  /* Put sorted values to the front of the array. */
+  /* Put sorted values to the front of the array, followed by the undefined values. */
   for (uint32_t index = 0;
-       index < copied_num && ecma_is_value_empty (ret_value);
+       index < copied_num + undefined_count && ecma_is_value_empty (ret_value);
        index++)
   {
+    ecma_value_t value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+    if (index < copied_num)
+    {
+      value = values_buffer[index].value;
+    }
+
     ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
     ECMA_TRY_CATCH (put_value,
-                    ecma_op_object_put (obj_p, index_string_p, values_buffer[index], true),
+                    ecma_op_object_put (obj_p, index_string_p, value, true),
                     ret_value);
     ECMA_FINALIZE (put_value);
     ecma_deref_ecma_string (index_string_p);
   }
 
-  /* Free values that were copied to the local array. */
+  /* Free values and keys that were copied to the local array. */
   for (uint32_t index = 0; index < copied_num; index++)
   {
-    ecma_free_value (values_buffer[index]);
+    ecma_free_value (values_buffer[index].value);
+    ecma_free_value (values_buffer[index].key);
   }
 
   JMEM_FINALIZE_LOCAL_ARRAY (values_buffer);
 
-  /* Undefined properties should be in the back of the array. */
-
-  ecma_collection_iterator_init (&iter, array_index_props_p);
-
-  while (ecma_collection_iterator_next (&iter)
-         && ecma_is_value_empty (ret_value))
+  /* Undefined properties should be in the back of the array. Dense arrays have no such properties. */
+  if (array_index_props_p != NULL)
   {
-    ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+    ecma_collection_iterator_init (&iter, array_index_props_p);
 
-    uint32_t index;
-    bool is_index = ecma_string_get_array_index (property_name_p, &index);
-    JERRY_ASSERT (is_index);
-
-    if (index >= copied_num && index < len)
+    while (ecma_collection_iterator_next (&iter)
+           && ecma_is_value_empty (ret_value))
     {
-      ECMA_TRY_CATCH (del_value, ecma_op_object_delete (obj_p, property_name_p, true), ret_value);
-      ECMA_FINALIZE (del_value);
+      ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+
+      uint32_t index;
+      bool is_index = ecma_string_get_array_index (property_name_p, &index);
+      JERRY_ASSERT (is_index);
+
+      if (index >= copied_num + undefined_count && index < len)
+      {
+        ECMA_TRY_CATCH (del_value, ecma_op_object_delete (obj_p, property_name_p, true), ret_value);
+        ECMA_FINALIZE (del_value);
+      }
     }
-  }
 
-  ecma_free_values_collection (array_index_props_p, true);
+    ecma_free_values_collection (array_index_props_p, true);
+  }
 
   if (ecma_is_value_empty (ret_value))
   {
@@ -1481,8 +1848,20 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
   }
 
   const uint32_t new_len = len - delete_count + item_count;
+  bool is_relocated = false;
 
-  if (item_count != delete_count)
+  if (ecma_is_value_empty (ret_value))
+  {
+    /* 12. - 16. are done in bulk. */
+    is_relocated = ecma_op_array_object_relocate_elements (obj_p,
+                                                           len,
+                                                           start,
+                                                           delete_count,
+                                                           item_count > 0 ? args + 2 : NULL,
+                                                           (uint32_t) item_count);
+  }
+
+  if (item_count != delete_count && !is_relocated)
   {
     uint32_t from, to;
 
@@ -1585,7 +1964,7 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
   /* 15. */
   ecma_length_t idx = 0;
   for (ecma_length_t arg_index = 2;
-       arg_index < args_number && ecma_is_value_empty (ret_value);
+       arg_index < args_number && ecma_is_value_empty (ret_value) && !is_relocated;
        arg_index++, idx++)
   {
     ecma_string_t *str_idx_p = ecma_new_ecma_string_from_uint32 ((uint32_t) (start + idx));
@@ -1598,7 +1977,7 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
   }
 
   /* 16. */
-  if (ecma_is_value_empty (ret_value))
+  if (ecma_is_value_empty (ret_value) && !is_relocated)
   {
     ECMA_TRY_CATCH (set_length_value,
                     ecma_builtin_array_prototype_helper_set_length (obj_p, ((ecma_number_t) new_len)),
@@ -1658,6 +2037,14 @@ ecma_builtin_array_prototype_object_unshift (ecma_value_t this_arg, /**< this ar
   /* 3. */
   uint32_t len = ecma_number_to_uint32 (len_number);
 
+  if (args_number > 0
+      && args_number <= UINT32_MAX
+      && ecma_op_array_object_relocate_elements (obj_p, len, 0, 0, args, (uint32_t) args_number))
+  {
+    /* 5. - 10. are done in bulk. */
+    ret_value = ecma_make_uint32_value (len + (uint32_t) args_number);
+  }
+
   /* 5. and 6. */
   for (uint32_t k = len; k > 0 && ecma_is_value_empty (ret_value); k--)
   {
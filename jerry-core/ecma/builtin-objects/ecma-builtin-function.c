@@ -21,6 +21,7 @@
 #include "ecma-function-object.h"
 #include "ecma-lex-env.h"
 #include "ecma-try-catch-macro.h"
+#include "lit-char-helpers.h"
 #include "lit-magic-strings.h"
 #include "js-parser.h"
 
@@ -72,31 +73,15 @@ ecma_builtin_function_helper_get_function_expression (const ecma_value_t *argume
 
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
-  ecma_string_t *left_parenthesis_str_p, *right_parenthesis_str_p;
-  ecma_string_t *left_brace_str_p, *right_brace_str_p;
-  ecma_string_t *comma_str_p;
-  ecma_string_t *function_kw_str_p, *empty_str_p;
-  ecma_string_t *expr_str_p, *concated_str_p;
-
-  left_parenthesis_str_p = ecma_new_ecma_string_from_magic_string_id (LIT_MAGIC_STRING_LEFT_PARENTHESIS_CHAR);
-  right_parenthesis_str_p = ecma_new_ecma_string_from_magic_string_id (LIT_MAGIC_STRING_RIGHT_PARENTHESIS_CHAR);
-
-  left_brace_str_p = ecma_new_ecma_string_from_magic_string_id (LIT_MAGIC_STRING_LEFT_BRACE_CHAR);
-  right_brace_str_p = ecma_new_ecma_string_from_magic_string_id (LIT_MAGIC_STRING_RIGHT_BRACE_CHAR);
-
-  comma_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_COMMA_CHAR);
-
-  function_kw_str_p = ecma_new_ecma_string_from_magic_string_id (LIT_MAGIC_STRING_FUNCTION);
-  empty_str_p = ecma_new_ecma_string_from_magic_string_id (LIT_MAGIC_STRING__EMPTY);
+  ecma_stringbuilder_t builder;
+  ecma_stringbuilder_init (&builder);
 
   /* First, we only process the function arguments skipping the function body */
   ecma_length_t number_of_function_args = (arguments_list_len == 0 ? 0 : arguments_list_len - 1);
 
-  expr_str_p = ecma_concat_ecma_strings (left_parenthesis_str_p, function_kw_str_p);
-
-  concated_str_p = ecma_concat_ecma_strings (expr_str_p, left_parenthesis_str_p);
-  ecma_deref_ecma_string (expr_str_p);
-  expr_str_p = concated_str_p;
+  ecma_stringbuilder_append_byte (&builder, LIT_CHAR_LEFT_PAREN);
+  ecma_stringbuilder_append_magic (&builder, LIT_MAGIC_STRING_FUNCTION);
+  ecma_stringbuilder_append_byte (&builder, LIT_CHAR_LEFT_PAREN);
 
   for (ecma_length_t idx = 0;
        idx < number_of_function_args && ecma_is_value_empty (ret_value);
@@ -106,17 +91,11 @@ ecma_builtin_function_helper_get_function_expression (const ecma_value_t *argume
                     ecma_op_to_string (arguments_list_p[idx]),
                     ret_value);
 
-    ecma_string_t *str_p = ecma_get_string_from_value (str_arg_value);
-
-    concated_str_p = ecma_concat_ecma_strings (expr_str_p, str_p);
-    ecma_deref_ecma_string (expr_str_p);
-    expr_str_p = concated_str_p;
+    ecma_stringbuilder_append (&builder, ecma_get_string_from_value (str_arg_value));
 
     if (idx < number_of_function_args - 1)
     {
-      concated_str_p = ecma_concat_ecma_strings (expr_str_p, comma_str_p);
-      ecma_deref_ecma_string (expr_str_p);
-      expr_str_p = concated_str_p;
+      ecma_stringbuilder_append_byte (&builder, LIT_CHAR_COMMA);
     }
 
     ECMA_FINALIZE (str_arg_value);
@@ -124,13 +103,8 @@ ecma_builtin_function_helper_get_function_expression (const ecma_value_t *argume
 
   if (ecma_is_value_empty (ret_value))
   {
-    concated_str_p = ecma_concat_ecma_strings (expr_str_p, right_parenthesis_str_p);
-    ecma_deref_ecma_string (expr_str_p);
-    expr_str_p = concated_str_p;
-
-    concated_str_p = ecma_concat_ecma_strings (expr_str_p, left_brace_str_p);
-    ecma_deref_ecma_string (expr_str_p);
-    expr_str_p = concated_str_p;
+    ecma_stringbuilder_append_byte (&builder, LIT_CHAR_RIGHT_PAREN);
+    ecma_stringbuilder_append_byte (&builder, LIT_CHAR_LEFT_BRACE);
 
     if (arguments_list_len != 0)
     {
@@ -138,39 +112,22 @@ ecma_builtin_function_helper_get_function_expression (const ecma_value_t *argume
                       ecma_op_to_string (arguments_list_p[arguments_list_len - 1]),
                       ret_value);
 
-      ecma_string_t *body_str_p = ecma_get_string_from_value (str_arg_value);
-
-      concated_str_p = ecma_concat_ecma_strings (expr_str_p, body_str_p);
-      ecma_deref_ecma_string (expr_str_p);
-      expr_str_p = concated_str_p;
+      ecma_stringbuilder_append (&builder, ecma_get_string_from_value (str_arg_value));
 
       ECMA_FINALIZE (str_arg_value);
     }
 
-    concated_str_p = ecma_concat_ecma_strings (expr_str_p, right_brace_str_p);
-    ecma_deref_ecma_string (expr_str_p);
-    expr_str_p = concated_str_p;
-
-    concated_str_p = ecma_concat_ecma_strings (expr_str_p, right_parenthesis_str_p);
-    ecma_deref_ecma_string (expr_str_p);
-    expr_str_p = concated_str_p;
+    ecma_stringbuilder_append_byte (&builder, LIT_CHAR_RIGHT_BRACE);
+    ecma_stringbuilder_append_byte (&builder, LIT_CHAR_RIGHT_PAREN);
   }
 
-  ecma_deref_ecma_string (left_parenthesis_str_p);
-  ecma_deref_ecma_string (right_parenthesis_str_p);
-  ecma_deref_ecma_string (left_brace_str_p);
-  ecma_deref_ecma_string (right_brace_str_p);
-  ecma_deref_ecma_string (comma_str_p);
-  ecma_deref_ecma_string (function_kw_str_p);
-  ecma_deref_ecma_string (empty_str_p);
-
   if (ecma_is_value_empty (ret_value))
   {
-    ret_value = ecma_make_string_value (expr_str_p);
+    ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
   }
   else
   {
-    ecma_deref_ecma_string (expr_str_p);
+    ecma_stringbuilder_destroy (&builder);
   }
 
   return ret_value;
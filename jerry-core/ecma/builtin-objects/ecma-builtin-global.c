@@ -341,6 +341,13 @@ ecma_builtin_global_object_parse_int (ecma_value_t this_arg, /**< this argument
         /* 13. and 14. */
         string_curr_p = end_p;
 
+        if (rad == 10 || rad == 16)
+        {
+          /* Correctly rounded conversion of the common radixes. */
+          value = ecma_utf8_digits_to_number (start_p, end_p, (uint32_t) rad);
+          string_curr_p = start_p;
+        }
+
         while (string_curr_p > start_p)
         {
           ecma_char_t current_char = *(--string_curr_p);
@@ -20,6 +20,7 @@
 #include "ecma-array-object.h"
 #include "ecma-builtins.h"
 #include "ecma-conversion.h"
+#include "ecma-enum-cache.h"
 #include "ecma-function-object.h"
 #include "ecma-exceptions.h"
 #include "ecma-helpers.h"
@@ -199,6 +200,19 @@ ecma_builtin_helper_object_get_properties (ecma_object_t *obj_p, /**< object */
 {
   JERRY_ASSERT (obj_p != NULL);
 
+  if (only_enumerable_properties)
+  {
+    ecma_enum_cache_entry_t *entry_p = ecma_enum_cache_get_entry (obj_p, false);
+
+    ecma_value_t names_array = ecma_op_create_array_object (ECMA_ENUM_CACHE_ENTRY_GET_NAMES (entry_p),
+                                                            entry_p->name_count,
+                                                            false);
+    JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (names_array));
+
+    ecma_enum_cache_deref_entry (entry_p);
+    return names_array;
+  }
+
   ecma_value_t new_array = ecma_op_create_array_object (NULL, 0, false);
   JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (new_array));
   ecma_object_t *new_array_p = ecma_get_object_from_value (new_array);
@@ -542,10 +556,9 @@ ecma_builtin_helper_string_prototype_object_index_of (ecma_value_t this_arg, /**
 /**
  * Helper function for finding index of a search string
  *
- * This function clamps the given index to the [0, length] range.
- * If the index is negative, 0 value is used.
- * If the index is greater than the length of the string, the normalized index will be the length of the string.
- * NaN is mapped to zero or length depending on the nan_to_zero parameter.
+ * The search is performed on the cesu-8 representation of the strings,
+ * and the byte offset of the match is converted back to a character
+ * index afterwards. This conversion is free for ascii strings.
  *
  * See also:
  *          ECMA-262 v5, 15.5.4.7,8,11
@@ -553,98 +566,94 @@ ecma_builtin_helper_string_prototype_object_index_of (ecma_value_t this_arg, /**
  * Used by:
  *         - The ecma_builtin_helper_string_prototype_object_index_of helper routine.
  *         - The ecma_builtin_string_prototype_object_replace_match helper routine.
+ *         - The ecma_builtin_helper_split_match helper routine.
+ *         - The String.prototype.split routine.
  *
- * @return uint32_t - the normalized value of the index
+ * @return true - if the search string is found
+ *         false - otherwise
  */
 bool
-ecma_builtin_helper_string_find_index (ecma_string_t *original_str_p, /**< index */
-                                       ecma_string_t *search_str_p, /**< string's length */
+ecma_builtin_helper_string_find_index (const ecma_string_t *original_str_p, /**< original string */
+                                       const ecma_string_t *search_str_p, /**< search string */
                                        bool first_index, /**< whether search for first (t) or last (f) index */
                                        ecma_length_t start_pos, /**< start position */
-                                       ecma_length_t *ret_index_p) /**< position found in original string */
+                                       ecma_length_t *ret_index_p) /**< [out] position found in original string */
 {
   bool match_found = false;
   const ecma_length_t original_len = ecma_string_get_length (original_str_p);
   const ecma_length_t search_len = ecma_string_get_length (search_str_p);
 
+  JERRY_ASSERT (start_pos <= original_len);
+
   if (search_len <= original_len)
   {
     if (!search_len)
     {
       match_found = true;
-      *ret_index_p = first_index ? 0 : original_len;
+      *ret_index_p = start_pos;
     }
     else
     {
-      /* create utf8 string from original string and advance to position */
       ECMA_STRING_TO_UTF8_STRING (original_str_p, original_str_utf8_p, original_str_size);
+      ECMA_STRING_TO_UTF8_STRING (search_str_p, search_str_utf8_p, search_str_size);
 
-      ecma_length_t index = start_pos;
+      const bool is_ascii = (original_str_size == original_len);
 
-      const lit_utf8_byte_t *original_str_curr_p = original_str_utf8_p;
-      for (ecma_length_t idx = 0; idx < index; idx++)
+      /* advance to the start position */
+      const lit_utf8_byte_t *start_p = original_str_utf8_p;
+
+      if (is_ascii)
       {
-        lit_utf8_incr (&original_str_curr_p);
+        start_p += start_pos;
+      }
+      else
+      {
+        for (ecma_length_t idx = 0; idx < start_pos; idx++)
+        {
+          lit_utf8_incr (&start_p);
+        }
       }
 
-      /* create utf8 string from search string */
-      ECMA_STRING_TO_UTF8_STRING (search_str_p, search_str_utf8_p, search_str_size);
+      const lit_utf8_byte_t *match_p;
 
-      const lit_utf8_byte_t *search_str_curr_p = search_str_utf8_p;
+      if (first_index)
+      {
+        lit_utf8_size_t remaining_size = (lit_utf8_size_t) (original_str_size - (start_p - original_str_utf8_p));
 
-      /* iterate original string and try to match at each position */
-      bool searching = true;
-      ecma_char_t first_char = lit_utf8_read_next (&search_str_curr_p);
-      while (searching)
+        match_p = lit_utf8_string_find (start_p, remaining_size, search_str_utf8_p, search_str_size);
+      }
+      else
       {
-        /* match as long as possible */
-        ecma_length_t match_len = 0;
-        const lit_utf8_byte_t *stored_original_str_curr_p = original_str_curr_p;
+        /* the last match can start at the start position */
+        lit_utf8_size_t search_area_size = (lit_utf8_size_t) (start_p - original_str_utf8_p) + search_str_size;
 
-        if (match_len < search_len &&
-            index + match_len < original_len &&
-            lit_utf8_read_next (&original_str_curr_p) == first_char)
+        if (search_area_size > original_str_size)
         {
-          const lit_utf8_byte_t *nested_search_str_curr_p = search_str_curr_p;
-          match_len++;
-
-          while (match_len < search_len &&
-                 index + match_len < original_len &&
-                 lit_utf8_read_next (&original_str_curr_p) == lit_utf8_read_next (&nested_search_str_curr_p))
-          {
-            match_len++;
-          }
+          search_area_size = original_str_size;
         }
 
-        /* check for match */
-        if (match_len == search_len)
-        {
-          match_found = true;
-          *ret_index_p = index;
+        match_p = lit_utf8_string_find_last (original_str_utf8_p,
+                                             search_area_size,
+                                             search_str_utf8_p,
+                                             search_str_size);
+      }
+
+      if (match_p != NULL)
+      {
+        match_found = true;
 
-          break;
+        if (is_ascii)
+        {
+          *ret_index_p = (ecma_length_t) (match_p - original_str_utf8_p);
+        }
+        else if (first_index)
+        {
+          *ret_index_p = start_pos + lit_utf8_string_length (start_p, (lit_utf8_size_t) (match_p - start_p));
         }
         else
         {
-          /* inc/dec index and update iterators and search condition */
-          original_str_curr_p = stored_original_str_curr_p;
-
-          if (first_index)
-          {
-            if ((searching = (index <= original_len - search_len)))
-            {
-              lit_utf8_incr (&original_str_curr_p);
-              index++;
-            }
-          }
-          else
-          {
-            if ((searching = (index > 0)))
-            {
-              lit_utf8_decr (&original_str_curr_p);
-              index--;
-            }
-          }
+          *ret_index_p = lit_utf8_string_length (original_str_utf8_p,
+                                                 (lit_utf8_size_t) (match_p - original_str_utf8_p));
         }
       }
 
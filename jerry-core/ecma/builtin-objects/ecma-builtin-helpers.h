@@ -43,7 +43,8 @@ extern ecma_value_t
 ecma_builtin_helper_string_prototype_object_index_of (ecma_value_t, ecma_value_t,
                                                       ecma_value_t, bool);
 extern bool
-ecma_builtin_helper_string_find_index (ecma_string_t *, ecma_string_t *, bool, ecma_length_t, ecma_length_t *);
+ecma_builtin_helper_string_find_index (const ecma_string_t *, const ecma_string_t *, bool,
+                                       ecma_length_t, ecma_length_t *);
 extern ecma_value_t
 ecma_builtin_helper_def_prop (ecma_object_t *, ecma_string_t *, ecma_value_t,
                               bool, bool, bool, bool);
@@ -156,16 +157,26 @@ typedef struct
 extern bool ecma_has_object_value_in_collection (ecma_collection_header_t *, ecma_value_t);
 extern bool ecma_has_string_value_in_collection (ecma_collection_header_t *, ecma_value_t);
 
-extern ecma_string_t *
-ecma_builtin_helper_json_create_hex_digit_ecma_string (uint8_t);
-extern ecma_string_t *
-ecma_builtin_helper_json_create_separated_properties (ecma_collection_header_t *, ecma_string_t *);
+extern void
+ecma_builtin_helper_json_append_hex_digits (ecma_stringbuilder_t *, uint16_t);
+extern void
+ecma_builtin_helper_json_append_separated_properties (ecma_stringbuilder_t *, ecma_collection_header_t *,
+                                                      ecma_string_t *);
 extern ecma_value_t
 ecma_builtin_helper_json_create_formatted_json (ecma_string_t *, ecma_string_t *, ecma_string_t *,
                                                 ecma_collection_header_t *, ecma_json_stringify_context_t *);
 extern ecma_value_t
 ecma_builtin_helper_json_create_non_formatted_json (ecma_string_t *, ecma_string_t *, ecma_collection_header_t *);
 
+/* ecma-builtin-json.c */
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+extern ecma_value_t
+ecma_builtin_json_parse_buffer (const lit_utf8_byte_t *, lit_utf8_size_t);
+extern ecma_value_t
+ecma_builtin_json_stringify_to_builder (ecma_value_t, ecma_stringbuilder_t *);
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+
 /* ecma-builtin-helper-error.c */
 
 extern ecma_value_t
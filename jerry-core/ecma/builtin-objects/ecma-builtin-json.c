@@ -69,6 +69,17 @@ typedef enum
   colon_token /**< JSON colon */
 } ecma_json_token_type_t;
 
+/**
+ * Number of recently created property names reused by the JSON parser (must be a power of 2)
+ */
+#define ECMA_JSON_KEY_CACHE_SIZE 32
+
+/**
+ * A cached property name is not shared further after this many references,
+ * so the reference counter of the string cannot overflow.
+ */
+#define ECMA_JSON_KEY_CACHE_MAX_REF (ECMA_STRING_MAX_REF >> 1)
+
 /**
  * JSON token
  */
@@ -86,6 +97,7 @@ typedef struct
     } string;
     ecma_number_t number; /**< when type is number_token, it contains the value of the number */
   } u;
+  ecma_string_t *key_cache[ECMA_JSON_KEY_CACHE_SIZE]; /**< recently created property names */
 } ecma_json_token_t;
 
 /**
@@ -203,6 +215,86 @@ ecma_builtin_json_parse_string (ecma_json_token_t *token_p) /**< token argument
   token_p->type = string_token;
 } /* ecma_builtin_json_parse_string */
 
+/**
+ * Maximum number of significant digits which are converted exactly by the fast path.
+ */
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+#define ECMA_JSON_FAST_NUMBER_DIGITS 15
+#else /* CONFIG_ECMA_NUMBER_TYPE != CONFIG_ECMA_NUMBER_FLOAT64 */
+#define ECMA_JSON_FAST_NUMBER_DIGITS 7
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+
+/**
+ * Convert a valid JSON number to an ecma number.
+ *
+ * Numbers without exponent, whose digits and power of ten are exactly
+ * representable, are converted by a single division, which is correctly
+ * rounded. Other numbers are converted by the generic converter.
+ *
+ * @return the converted number
+ */
+static ecma_number_t
+ecma_builtin_json_convert_number (const lit_utf8_byte_t *start_p, /**< start of the number */
+                                  const lit_utf8_byte_t *end_p) /**< end of the number */
+{
+  static const ecma_number_t powers_of_ten[] =
+  {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10
+  };
+
+  const lit_utf8_byte_t *current_p = start_p;
+  bool is_negative = false;
+  uint64_t digits = 0;
+  uint32_t digit_count = 0;
+  uint32_t fraction_count = 0;
+  bool is_fraction = false;
+
+  if (*current_p == LIT_CHAR_MINUS)
+  {
+    is_negative = true;
+    current_p++;
+  }
+
+  while (current_p < end_p)
+  {
+    if (*current_p == LIT_CHAR_DOT)
+    {
+      is_fraction = true;
+      current_p++;
+      continue;
+    }
+
+    if (!lit_char_is_decimal_digit (*current_p) || digit_count >= ECMA_JSON_FAST_NUMBER_DIGITS)
+    {
+      return ecma_utf8_string_to_number (start_p, (lit_utf8_size_t) (end_p - start_p));
+    }
+
+    digits = digits * 10 + (uint32_t) (*current_p - LIT_CHAR_0);
+
+    /* Leading zeros are not significant. */
+    if (digits != 0)
+    {
+      digit_count++;
+    }
+
+    if (is_fraction)
+    {
+      fraction_count++;
+    }
+
+    current_p++;
+  }
+
+  if (fraction_count >= sizeof (powers_of_ten) / sizeof (powers_of_ten[0]))
+  {
+    return ecma_utf8_string_to_number (start_p, (lit_utf8_size_t) (end_p - start_p));
+  }
+
+  ecma_number_t number = ((ecma_number_t) digits) / powers_of_ten[fraction_count];
+
+  return is_negative ? -number : number;
+} /* ecma_builtin_json_convert_number */
+
 /**
  * Parse and extract string token.
  */
@@ -269,7 +361,7 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
     while (lit_char_is_decimal_digit (*current_p));
   }
   token_p->type = number_token;
-  token_p->u.number = ecma_utf8_string_to_number (start_p, (lit_utf8_size_t) (current_p - start_p));
+  token_p->u.number = ecma_builtin_json_convert_number (start_p, current_p);
 
   token_p->current_p = current_p;
 } /* ecma_builtin_json_parse_number */
@@ -434,6 +526,86 @@ ecma_builtin_json_define_value_property (ecma_object_t *obj_p, /**< this object
   JERRY_ASSERT (ecma_is_value_boolean (completion_value));
 } /* ecma_builtin_json_define_value_property */
 
+/**
+ * Get the property name described by the current string token.
+ *
+ * Objects often repeat the same property names, so recently created
+ * names are reused instead of creating a new string for each of them.
+ *
+ * @return property name
+ *         Returned value must be freed with ecma_deref_ecma_string.
+ */
+static ecma_string_t *
+ecma_builtin_json_get_property_name (ecma_json_token_t *token_p) /**< token argument */
+{
+  JERRY_ASSERT (token_p->type == string_token);
+
+  const lit_utf8_byte_t *name_start_p = token_p->u.string.start_p;
+  lit_utf8_size_t name_size = token_p->u.string.size;
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (name_start_p, name_size);
+  ecma_string_t **entry_p = token_p->key_cache + (hash & (ECMA_JSON_KEY_CACHE_SIZE - 1));
+
+  if (*entry_p != NULL
+      && (*entry_p)->hash == hash
+      && (*entry_p)->refs_and_container < ECMA_JSON_KEY_CACHE_MAX_REF)
+  {
+    lit_utf8_size_t cached_size;
+    bool is_ascii;
+    const lit_utf8_byte_t *cached_start_p = ecma_string_raw_chars (*entry_p, &cached_size, &is_ascii);
+
+    if (cached_start_p != NULL
+        && cached_size == name_size
+        && memcmp (cached_start_p, name_start_p, name_size) == 0)
+    {
+      ecma_ref_ecma_string (*entry_p);
+      return *entry_p;
+    }
+  }
+
+  ecma_string_t *name_p = ecma_new_ecma_string_from_utf8 (name_start_p, name_size);
+
+  if (*entry_p != NULL)
+  {
+    ecma_deref_ecma_string (*entry_p);
+  }
+
+  ecma_ref_ecma_string (name_p);
+  *entry_p = name_p;
+  return name_p;
+} /* ecma_builtin_json_get_property_name */
+
+/**
+ * Store a parsed value in a property of an object created by the parser.
+ *
+ * The objects created by the parser are not visible to user code until
+ * the parsing is completed, so the properties are inserted directly
+ * instead of using the generic [[DefineOwnProperty]] operation.
+ */
+static void
+ecma_builtin_json_store_value (ecma_object_t *object_p, /**< object created by the parser */
+                               ecma_string_t *name_p, /**< property name */
+                               ecma_value_t value) /**< parsed value, ownership is transferred */
+{
+  ecma_property_t *property_p = ecma_find_named_property (object_p, name_p);
+
+  /* The last value of duplicated property names is kept. */
+  if (property_p != NULL)
+  {
+    ecma_named_data_property_assign_value (object_p, property_p, value);
+    ecma_free_value (value);
+    return;
+  }
+
+  property_p = ecma_create_named_data_property (object_p, name_p, ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
+  ecma_set_named_data_property_value (property_p, value);
+
+  /* Properties do not hold references to objects. */
+  if (ecma_is_value_object (value))
+  {
+    ecma_deref_object (ecma_get_object_from_value (value));
+  }
+} /* ecma_builtin_json_store_value */
+
 /**
  * Parse next value.
  *
@@ -498,12 +670,12 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
           break;
         }
 
-        const lit_utf8_byte_t *string_start_p = token_p->u.string.start_p;
-        lit_utf8_size_t string_size = token_p->u.string.size;
+        ecma_string_t *name_p = ecma_builtin_json_get_property_name (token_p);
         ecma_builtin_json_parse_next_token (token_p);
 
         if (token_p->type != colon_token)
         {
+          ecma_deref_ecma_string (name_p);
           break;
         }
 
@@ -511,13 +683,12 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
 
         if (ecma_is_value_undefined (value))
         {
+          ecma_deref_ecma_string (name_p);
           break;
         }
 
-        ecma_string_t *name_p = ecma_new_ecma_string_from_utf8 (string_start_p, string_size);
-        ecma_builtin_json_define_value_property (object_p, name_p, value);
+        ecma_builtin_json_store_value (object_p, name_p, value);
         ecma_deref_ecma_string (name_p);
-        ecma_free_value (value);
         parse_comma = true;
       }
 
@@ -541,6 +712,14 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
       {
         if (ecma_builtin_json_check_right_square_token (token_p))
         {
+          /* The elements are inserted directly, so the length is updated once. */
+          ecma_string_t *length_str_p = ecma_new_ecma_length_string ();
+          ecma_property_t *length_prop_p = ecma_find_named_property (array_p, length_str_p);
+          ecma_deref_ecma_string (length_str_p);
+
+          JERRY_ASSERT (length_prop_p != NULL);
+
+          ecma_value_assign_uint32 (&ECMA_PROPERTY_VALUE_PTR (length_prop_p)->value, length);
           return ecma_make_object_value (array_p);
         }
 
@@ -561,21 +740,9 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
         }
 
         ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (length);
-
-        ecma_value_t completion = ecma_builtin_helper_def_prop (array_p,
-                                                                index_str_p,
-                                                                value,
-                                                                true, /* Writable */
-                                                                true, /* Enumerable */
-                                                                true, /* Configurable */
-                                                                false); /* Failure handling */
-
-        JERRY_ASSERT (ecma_is_value_true (completion));
-
+        ecma_builtin_json_store_value (array_p, index_str_p, value);
         ecma_deref_ecma_string (index_str_p);
 
-        ecma_free_value (value);
-
         length++;
         parse_comma = true;
       }
@@ -687,42 +854,44 @@ ecma_builtin_json_walk (ecma_object_t *reviver_p, /**< reviver function */
 } /* ecma_builtin_json_walk */
 
 /**
- * The JSON object's 'parse' routine
+ * Parse a JSON text stored in a cesu-8 buffer.
+ *
+ * The parser unescapes the strings in place, so the text is copied
+ * into a temporary buffer once.
  *
  * See also:
- *          ECMA-262 v5, 15.12.2
+ *          ECMA-262 v5, 15.12.2 (steps 1-2)
  *
- * @return ecma value
+ * @return parsed value - if the text is a valid JSON text
+ *         syntax error - otherwise
  *         Returned value must be freed with ecma_free_value.
  */
-static ecma_value_t
-ecma_builtin_json_parse (ecma_value_t this_arg, /**< 'this' argument */
-                         ecma_value_t arg1, /**< string argument */
-                         ecma_value_t arg2) /**< reviver argument */
+ecma_value_t
+ecma_builtin_json_parse_buffer (const lit_utf8_byte_t *string_p, /**< JSON text */
+                                lit_utf8_size_t string_size) /**< size of the JSON text */
 {
-  JERRY_UNUSED (this_arg);
-  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
-
-  ECMA_TRY_CATCH (string,
-                  ecma_op_to_string (arg1),
-                  ret_value);
-
-  const ecma_string_t *string_p = ecma_get_string_from_value (string);
-  const ecma_length_t string_size = (ecma_length_t) ecma_string_get_size (string_p);
   const lit_utf8_size_t buffer_size = sizeof (lit_utf8_byte_t) * (string_size + 1);
+  ecma_value_t final_result;
 
   JMEM_DEFINE_LOCAL_ARRAY (str_start_p, buffer_size, lit_utf8_byte_t);
 
-  const lit_utf8_size_t sz = ecma_string_copy_to_utf8_buffer (string_p, str_start_p, buffer_size);
-  JERRY_ASSERT (sz == string_size);
-
+  memcpy (str_start_p, string_p, string_size);
   str_start_p[string_size] = LIT_BYTE_NULL;
 
   ecma_json_token_t token;
   token.current_p = str_start_p;
   token.end_p = str_start_p + string_size;
+  memset (token.key_cache, 0, sizeof (token.key_cache));
+
+  final_result = ecma_builtin_json_parse_value (&token);
 
-  ecma_value_t final_result = ecma_builtin_json_parse_value (&token);
+  for (uint32_t i = 0; i < ECMA_JSON_KEY_CACHE_SIZE; i++)
+  {
+    if (token.key_cache[i] != NULL)
+    {
+      ecma_deref_ecma_string (token.key_cache[i]);
+    }
+  }
 
   if (!ecma_is_value_undefined (final_result))
   {
@@ -735,38 +904,72 @@ ecma_builtin_json_parse (ecma_value_t this_arg, /**< 'this' argument */
     }
   }
 
+  JMEM_FINALIZE_LOCAL_ARRAY (str_start_p);
+
   if (ecma_is_value_undefined (final_result))
   {
-    ret_value = ecma_raise_syntax_error (ECMA_ERR_MSG (""));
+    return ecma_raise_syntax_error (ECMA_ERR_MSG (""));
   }
-  else
-  {
-    if (ecma_op_is_callable (arg2))
-    {
-      ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
-      ecma_string_t *name_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
 
-      ecma_property_t *property_p;
-      property_p = ecma_create_named_data_property (object_p,
-                                                    name_p,
-                                                    ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
+  return final_result;
+} /* ecma_builtin_json_parse_buffer */
 
-      ecma_named_data_property_assign_value (object_p, property_p, final_result);
-      ecma_free_value (final_result);
+/**
+ * The JSON object's 'parse' routine
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_parse (ecma_value_t this_arg, /**< 'this' argument */
+                         ecma_value_t arg1, /**< string argument */
+                         ecma_value_t arg2) /**< reviver argument */
+{
+  JERRY_UNUSED (this_arg);
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
-      ret_value = ecma_builtin_json_walk (ecma_get_object_from_value (arg2),
-                                          object_p,
-                                          name_p);
-      ecma_deref_object (object_p);
-      ecma_deref_ecma_string (name_p);
-    }
-    else
-    {
-      ret_value = final_result;
-    }
-  }
+  ECMA_TRY_CATCH (string,
+                  ecma_op_to_string (arg1),
+                  ret_value);
 
-  JMEM_FINALIZE_LOCAL_ARRAY (str_start_p);
+  ecma_string_t *string_p = ecma_get_string_from_value (string);
+
+  ECMA_STRING_TO_UTF8_STRING (string_p, str_start_p, string_size);
+
+  ecma_value_t final_result = ecma_builtin_json_parse_buffer (str_start_p, string_size);
+
+  ECMA_FINALIZE_UTF8_STRING (str_start_p, string_size);
+
+  if (ECMA_IS_VALUE_ERROR (final_result))
+  {
+    ret_value = final_result;
+  }
+  else if (ecma_op_is_callable (arg2))
+  {
+    ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
+    ecma_string_t *name_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+
+    ecma_property_t *property_p;
+    property_p = ecma_create_named_data_property (object_p,
+                                                  name_p,
+                                                  ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
+
+    ecma_named_data_property_assign_value (object_p, property_p, final_result);
+    ecma_free_value (final_result);
+
+    ret_value = ecma_builtin_json_walk (ecma_get_object_from_value (arg2),
+                                        object_p,
+                                        name_p);
+    ecma_deref_object (object_p);
+    ecma_deref_ecma_string (name_p);
+  }
+  else
+  {
+    ret_value = final_result;
+  }
 
   ECMA_FINALIZE (string);
   return ret_value;
@@ -781,6 +984,74 @@ ecma_builtin_json_object (ecma_object_t *obj_p, ecma_json_stringify_context_t *c
 static ecma_value_t
 ecma_builtin_json_array (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p);
 
+static bool
+ecma_builtin_json_serialize_fast (ecma_stringbuilder_t *builder_p, ecma_value_t value,
+                                  ecma_json_stringify_context_t *context_p);
+
+/**
+ * Serialize a value without replacer function and gap, and append the result to a string builder.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3 (steps 9-11)
+ *
+ * @return true - if the value is serialized
+ *         undefined - if the value has no JSON representation (e.g. undefined or function)
+ *         error - if the serialization throws an exception
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_builtin_json_stringify_to_builder (ecma_value_t value, /**< value to serialize */
+                                        ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  ecma_json_stringify_context_t context;
+  context.occurence_stack_p = ecma_new_values_collection (NULL, 0, false);
+  context.indent_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+  context.property_list_p = ecma_new_values_collection (NULL, 0, false);
+  context.replacer_function_p = NULL;
+  context.gap_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  lit_utf8_size_t start_size = builder_p->size;
+
+  if (!ecma_builtin_json_serialize_fast (builder_p, value, &context))
+  {
+    builder_p->size = start_size;
+
+    ecma_object_t *obj_wrapper_p = ecma_op_create_object_object_noarg ();
+    ecma_string_t *empty_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+
+    ecma_value_t put_comp_val = ecma_op_object_put (obj_wrapper_p,
+                                                    empty_str_p,
+                                                    value,
+                                                    false);
+
+    JERRY_ASSERT (ecma_is_value_true (put_comp_val));
+    ecma_free_value (put_comp_val);
+
+    ecma_value_t str_val = ecma_builtin_json_str (empty_str_p, obj_wrapper_p, &context);
+
+    if (ecma_is_value_string (str_val))
+    {
+      ecma_stringbuilder_append (builder_p, ecma_get_string_from_value (str_val));
+      ecma_free_value (str_val);
+    }
+    else
+    {
+      ret_value = str_val;
+    }
+
+    ecma_deref_object (obj_wrapper_p);
+    ecma_deref_ecma_string (empty_str_p);
+  }
+
+  ecma_deref_ecma_string (context.gap_str_p);
+  ecma_deref_ecma_string (context.indent_str_p);
+  ecma_free_values_collection (context.property_list_p, true);
+  ecma_free_values_collection (context.occurence_stack_p, true);
+
+  return ret_value;
+} /* ecma_builtin_json_stringify_to_builder */
+
 /**
  * The JSON object's 'stringify' routine
  *
@@ -1011,30 +1282,45 @@ ecma_builtin_json_stringify (ecma_value_t this_arg, /**< 'this' argument */
 
     if (ecma_is_value_empty (ret_value))
     {
-      /* 9. */
-      ecma_object_t *obj_wrapper_p = ecma_op_create_object_object_noarg ();
-      ecma_string_t *empty_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+      ecma_stringbuilder_t builder;
+      ecma_stringbuilder_init (&builder);
 
-      /* 10. */
-      ecma_value_t put_comp_val = ecma_op_object_put (obj_wrapper_p,
-                                                      empty_str_p,
-                                                      arg1,
-                                                      false);
+      /* Plain data without a replacer is serialized directly into a single buffer. */
+      if (context.replacer_function_p == NULL
+          && context.property_list_p->unit_number == 0
+          && ecma_builtin_json_serialize_fast (&builder, arg1, &context))
+      {
+        ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
+      }
+      else
+      {
+        ecma_stringbuilder_destroy (&builder);
 
-      JERRY_ASSERT (ecma_is_value_true (put_comp_val));
-      ecma_free_value (put_comp_val);
+        /* 9. */
+        ecma_object_t *obj_wrapper_p = ecma_op_create_object_object_noarg ();
+        ecma_string_t *empty_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
 
-      /* 11. */
-      ECMA_TRY_CATCH (str_val,
-                      ecma_builtin_json_str (empty_str_p, obj_wrapper_p, &context),
-                      ret_value);
+        /* 10. */
+        ecma_value_t put_comp_val = ecma_op_object_put (obj_wrapper_p,
+                                                        empty_str_p,
+                                                        arg1,
+                                                        false);
 
-      ret_value = ecma_copy_value (str_val);
+        JERRY_ASSERT (ecma_is_value_true (put_comp_val));
+        ecma_free_value (put_comp_val);
 
-      ECMA_FINALIZE (str_val);
+        /* 11. */
+        ECMA_TRY_CATCH (str_val,
+                        ecma_builtin_json_str (empty_str_p, obj_wrapper_p, &context),
+                        ret_value);
+
+        ret_value = ecma_copy_value (str_val);
 
-      ecma_deref_object (obj_wrapper_p);
-      ecma_deref_ecma_string (empty_str_p);
+        ECMA_FINALIZE (str_val);
+
+        ecma_deref_object (obj_wrapper_p);
+        ecma_deref_ecma_string (empty_str_p);
+      }
     }
 
     ecma_deref_ecma_string (context.gap_str_p);
@@ -1049,158 +1335,496 @@ ecma_builtin_json_stringify (ecma_value_t this_arg, /**< 'this' argument */
 } /* ecma_builtin_json_stringify */
 
 /**
- * Abstract operation 'Quote' defined in 15.12.3
+ * Abstract operation 'Quote' defined in 15.12.3, which appends the quoted string to a string builder
  *
  * See also:
  *          ECMA-262 v5, 15.12.3
- *
- * @return ecma value
- *         Returned value must be freed with ecma_free_value.
  */
-static ecma_value_t
-ecma_builtin_json_quote (ecma_string_t *string_p) /**< string that should be quoted*/
+static void
+ecma_builtin_json_append_quoted (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                 ecma_string_t *string_p) /**< string that should be quoted*/
 {
   /* 1. */
-  ecma_string_t *quote_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_DOUBLE_QUOTE_CHAR);
-  ecma_ref_ecma_string (quote_str_p);
-  ecma_string_t *product_str_p = quote_str_p;
-  ecma_string_t *tmp_str_p;
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
 
   ECMA_STRING_TO_UTF8_STRING (string_p, string_buff, string_buff_size);
 
   const lit_utf8_byte_t *str_p = string_buff;
   const lit_utf8_byte_t *str_end_p = string_buff + string_buff_size;
+  const lit_utf8_byte_t *unescaped_start_p = str_p;
 
   while (str_p < str_end_p)
   {
+    const lit_utf8_byte_t *current_p = str_p;
     ecma_char_t current_char = lit_utf8_read_next (&str_p);
 
-    /* 2.a */
-    if (current_char == LIT_CHAR_BACKSLASH || current_char == LIT_CHAR_DOUBLE_QUOTE)
+    /* 2.d: characters which are not escaped are copied in one step. */
+    if (current_char >= LIT_CHAR_SP
+        && current_char != LIT_CHAR_BACKSLASH
+        && current_char != LIT_CHAR_DOUBLE_QUOTE)
     {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
+      continue;
+    }
+
+    ecma_stringbuilder_append_raw (builder_p,
+                                   unescaped_start_p,
+                                   (lit_utf8_size_t) (current_p - unescaped_start_p));
+    unescaped_start_p = str_p;
 
-      /* 2.a.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
+    /* 2.a.i, 2.b.i, 2.c.i */
+    ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_BACKSLASH);
 
+    switch (current_char)
+    {
       /* 2.a.ii */
-      ecma_string_t *current_char_str_p = ecma_new_ecma_string_from_code_unit (current_char);
+      case LIT_CHAR_BACKSLASH:
+      case LIT_CHAR_DOUBLE_QUOTE:
+      {
+        ecma_stringbuilder_append_byte (builder_p, (lit_utf8_byte_t) current_char);
+        break;
+      }
+      /* 2.b.ii - 2.b.iii */
+      case LIT_CHAR_BS:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_B);
+        break;
+      }
+      case LIT_CHAR_FF:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_F);
+        break;
+      }
+      case LIT_CHAR_LF:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_N);
+        break;
+      }
+      case LIT_CHAR_CR:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_R);
+        break;
+      }
+      case LIT_CHAR_TAB:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_T);
+        break;
+      }
+      /* 2.c */
+      default:
+      {
+        /* 2.c.ii */
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_U);
 
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, current_char_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (current_char_str_p);
-      product_str_p = tmp_str_p;
+        /* 2.c.iii - 2.c.iv */
+        ecma_builtin_helper_json_append_hex_digits (builder_p, current_char);
+        break;
+      }
     }
-    /* 2.b */
-    else if (current_char == LIT_CHAR_BS
-             || current_char == LIT_CHAR_FF
-             || current_char == LIT_CHAR_LF
-             || current_char == LIT_CHAR_CR
-             || current_char == LIT_CHAR_TAB)
+  }
+
+  ecma_stringbuilder_append_raw (builder_p,
+                                 unescaped_start_p,
+                                 (lit_utf8_size_t) (str_end_p - unescaped_start_p));
+
+  ECMA_FINALIZE_UTF8_STRING (string_buff, string_buff_size);
+
+  /* 3. */
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
+} /* ecma_builtin_json_append_quoted */
+
+/**
+ * Abstract operation 'Quote' defined in 15.12.3
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_quote (ecma_string_t *string_p) /**< string that should be quoted*/
+{
+  ecma_stringbuilder_t builder;
+  ecma_stringbuilder_init (&builder);
+
+  ecma_builtin_json_append_quoted (&builder, string_p);
+
+  /* 4. */
+  return ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
+} /* ecma_builtin_json_quote */
+
+/**
+ * Result of serializing a value by the fast path of JSON.stringify
+ */
+typedef enum
+{
+  ECMA_JSON_FAST_SERIALIZED, /**< the value is appended to the output */
+  ECMA_JSON_FAST_UNDEFINED, /**< the value has no JSON representation, nothing is appended */
+  ECMA_JSON_FAST_UNSUPPORTED, /**< the value must be serialized by the standard algorithm */
+} ecma_json_fast_result_t;
+
+/**
+ * Object which is being serialized by the fast path of JSON.stringify
+ */
+typedef struct ecma_json_fast_ancestor_t
+{
+  const struct ecma_json_fast_ancestor_t *parent_p; /**< object which contains this object */
+  ecma_object_t *object_p; /**< the object */
+} ecma_json_fast_ancestor_t;
+
+static ecma_json_fast_result_t
+ecma_builtin_json_fast_str (ecma_stringbuilder_t *builder_p, ecma_value_t value,
+                            ecma_json_stringify_context_t *context_p,
+                            const ecma_json_fast_ancestor_t *ancestor_p, uint32_t depth);
+
+/**
+ * Checks whether the fast path of JSON.stringify can serialize an object.
+ *
+ * Only arrays and objects of the Object class are supported, which are not built-in
+ * objects and have no toJSON property, so serializing them cannot execute user code.
+ *
+ * @return true - if the object can be serialized by the fast path
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_json_fast_is_plain_object (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_is_builtin (obj_p))
+  {
+    return false;
+  }
+
+  ecma_object_type_t type = ecma_get_object_type (obj_p);
+
+  if (type != ECMA_OBJECT_TYPE_ARRAY
+      && (type != ECMA_OBJECT_TYPE_GENERAL || ecma_object_get_class_name (obj_p) != LIT_MAGIC_STRING_OBJECT_UL))
+  {
+    return false;
+  }
+
+  ecma_string_t *to_json_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_TO_JSON_UL);
+  ecma_property_t *to_json_prop_p = ecma_op_object_get_property (obj_p, to_json_str_p);
+  ecma_deref_ecma_string (to_json_str_p);
+
+  return to_json_prop_p == NULL;
+} /* ecma_builtin_json_fast_is_plain_object */
+
+/**
+ * Append a line break and the indentation of the given depth if the output is formatted.
+ */
+static void
+ecma_builtin_json_fast_append_indent (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                      ecma_json_stringify_context_t *context_p, /**< context */
+                                      uint32_t depth) /**< nesting depth */
+{
+  if (ecma_string_is_empty (context_p->gap_str_p))
+  {
+    return;
+  }
+
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LF);
+
+  for (uint32_t i = 0; i < depth; i++)
+  {
+    ecma_stringbuilder_append (builder_p, context_p->gap_str_p);
+  }
+} /* ecma_builtin_json_fast_append_indent */
+
+/**
+ * Append the JSON representation of a number value.
+ */
+static void
+ecma_builtin_json_fast_append_number (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                      ecma_value_t value) /**< number value */
+{
+  lit_utf8_byte_t buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+  lit_utf8_size_t size;
+
+  if (ecma_is_value_integer_number (value))
+  {
+    ecma_integer_value_t integer = ecma_get_integer_from_value (value);
+
+    if (integer < 0)
+    {
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_MINUS);
+      integer = -integer;
+    }
+
+    size = ecma_uint32_to_utf8_string ((uint32_t) integer, buffer, sizeof (buffer));
+  }
+  else
+  {
+    ecma_number_t number = ecma_get_number_from_value (value);
+
+    /* 9.b */
+    if (ecma_number_is_nan (number) || ecma_number_is_infinity (number))
     {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
+      ecma_stringbuilder_append_magic (builder_p, LIT_MAGIC_STRING_NULL);
+      return;
+    }
 
-      /* 2.b.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
+    size = ecma_number_to_utf8_string (number, buffer, sizeof (buffer));
+  }
 
-      /* 2.b.ii */
-      lit_utf8_byte_t abbrev = LIT_CHAR_SP;
+  ecma_stringbuilder_append_raw (builder_p, buffer, size);
+} /* ecma_builtin_json_fast_append_number */
 
-      switch (current_char)
-      {
-        case LIT_CHAR_BS:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_B;
-          break;
-        }
-        case LIT_CHAR_FF:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_F;
-          break;
-        }
-        case LIT_CHAR_LF:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_N;
-          break;
-        }
-        case LIT_CHAR_CR:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_R;
-          break;
-        }
-        case LIT_CHAR_TAB:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_T;
-          break;
-        }
-      }
+/**
+ * Serialize a plain object by the fast path of JSON.stringify.
+ *
+ * See also:
+ *          ecma_builtin_json_object
+ *
+ * @return ECMA_JSON_FAST_SERIALIZED or ECMA_JSON_FAST_UNSUPPORTED
+ */
+static ecma_json_fast_result_t
+ecma_builtin_json_fast_object (ecma_stringbuilder_t *builder_p, /**< string builder */
+                               ecma_json_fast_ancestor_t *ancestor_p, /**< the object and its ancestors */
+                               ecma_json_stringify_context_t *context_p, /**< context */
+                               uint32_t depth) /**< nesting depth of the object */
+{
+  ecma_object_t *obj_p = ancestor_p->object_p;
+  ecma_json_fast_result_t result = ECMA_JSON_FAST_SERIALIZED;
+  bool is_empty = true;
+
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LEFT_BRACE);
 
-      /* 2.b.iii */
-      ecma_string_t *abbrev_str_p = ecma_new_ecma_string_from_utf8 (&abbrev, 1);
+  ecma_collection_header_t *props_p = ecma_op_object_get_property_names (obj_p, false, true, false);
+
+  ecma_collection_iterator_t iter;
+  ecma_collection_iterator_init (&iter, props_p);
+
+  while (ecma_collection_iterator_next (&iter))
+  {
+    ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+    ecma_property_t *property_p = ecma_op_object_get_own_property (obj_p, property_name_p);
 
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, abbrev_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (abbrev_str_p);
-      product_str_p = tmp_str_p;
+    if (ECMA_PROPERTY_GET_TYPE (property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+    {
+      result = ECMA_JSON_FAST_UNSUPPORTED;
+      break;
     }
-    /* 2.c */
-    else if (current_char < LIT_CHAR_SP)
+
+    /* Members whose value has no JSON representation are removed afterwards. */
+    lit_utf8_size_t member_start = builder_p->size;
+
+    if (!is_empty)
     {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_COMMA);
+    }
+
+    ecma_builtin_json_fast_append_indent (builder_p, context_p, depth + 1);
+    ecma_builtin_json_append_quoted (builder_p, property_name_p);
+    ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_COLON);
+
+    if (!ecma_string_is_empty (context_p->gap_str_p))
+    {
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_SP);
+    }
+
+    result = ecma_builtin_json_fast_str (builder_p,
+                                         ecma_get_named_data_property_value (property_p),
+                                         context_p,
+                                         ancestor_p,
+                                         depth + 1);
+
+    if (result == ECMA_JSON_FAST_UNSUPPORTED)
+    {
+      break;
+    }
+
+    if (result == ECMA_JSON_FAST_UNDEFINED)
+    {
+      builder_p->size = member_start;
+      result = ECMA_JSON_FAST_SERIALIZED;
+      continue;
+    }
+
+    is_empty = false;
+  }
+
+  ecma_free_values_collection (props_p, true);
 
-      /* 2.c.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
+  if (!is_empty)
+  {
+    ecma_builtin_json_fast_append_indent (builder_p, context_p, depth);
+  }
+
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_RIGHT_BRACE);
+  return result;
+} /* ecma_builtin_json_fast_object */
+
+/**
+ * Serialize a plain array by the fast path of JSON.stringify.
+ *
+ * See also:
+ *          ecma_builtin_json_array
+ *
+ * @return ECMA_JSON_FAST_SERIALIZED or ECMA_JSON_FAST_UNSUPPORTED
+ */
+static ecma_json_fast_result_t
+ecma_builtin_json_fast_array (ecma_stringbuilder_t *builder_p, /**< string builder */
+                              ecma_json_fast_ancestor_t *ancestor_p, /**< the array and its ancestors */
+                              ecma_json_stringify_context_t *context_p, /**< context */
+                              uint32_t depth) /**< nesting depth of the array */
+{
+  ecma_object_t *obj_p = ancestor_p->object_p;
+  ecma_json_fast_result_t result = ECMA_JSON_FAST_SERIALIZED;
 
-      /* 2.c.ii */
-      lit_utf8_byte_t u_ch = LIT_CHAR_LOWERCASE_U;
-      ecma_string_t *u_ch_str_p = ecma_new_ecma_string_from_utf8 (&u_ch, 1);
+  ecma_string_t *length_str_p = ecma_new_ecma_length_string ();
+  ecma_property_t *length_prop_p = ecma_op_object_get_own_property (obj_p, length_str_p);
+  ecma_deref_ecma_string (length_str_p);
+
+  JERRY_ASSERT (length_prop_p != NULL && ECMA_PROPERTY_GET_TYPE (length_prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
 
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, u_ch_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (u_ch_str_p);
-      product_str_p = tmp_str_p;
+  ecma_value_t length_value = ecma_get_named_data_property_value (length_prop_p);
+  uint32_t length = ecma_number_to_uint32 (ecma_get_number_from_value (length_value));
 
-      /* 2.c.iii */
-      ecma_string_t *hex_str_p = ecma_builtin_helper_json_create_hex_digit_ecma_string ((uint8_t) current_char);
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LEFT_SQUARE);
 
-      /* 2.c.iv */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, hex_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (hex_str_p);
-      product_str_p = tmp_str_p;
+  for (uint32_t index = 0; index < length; index++)
+  {
+    if (index > 0)
+    {
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_COMMA);
+    }
+
+    ecma_builtin_json_fast_append_indent (builder_p, context_p, depth + 1);
+
+    /* Holes are looked up in the prototype chain. */
+    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+    ecma_property_t *property_p = ecma_op_object_get_property (obj_p, index_str_p);
+    ecma_deref_ecma_string (index_str_p);
+
+    if (property_p == NULL)
+    {
+      result = ECMA_JSON_FAST_UNDEFINED;
+    }
+    else if (ECMA_PROPERTY_GET_TYPE (property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+    {
+      return ECMA_JSON_FAST_UNSUPPORTED;
     }
-    /* 2.d */
     else
     {
-      ecma_string_t *current_char_str_p = ecma_new_ecma_string_from_code_unit (current_char);
+      result = ecma_builtin_json_fast_str (builder_p,
+                                           ecma_get_named_data_property_value (property_p),
+                                           context_p,
+                                           ancestor_p,
+                                           depth + 1);
+    }
+
+    if (result == ECMA_JSON_FAST_UNSUPPORTED)
+    {
+      return result;
+    }
 
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, current_char_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (current_char_str_p);
-      product_str_p = tmp_str_p;
+    /* 8.b */
+    if (result == ECMA_JSON_FAST_UNDEFINED)
+    {
+      ecma_stringbuilder_append_magic (builder_p, LIT_MAGIC_STRING_NULL);
+      result = ECMA_JSON_FAST_SERIALIZED;
     }
   }
 
-  ECMA_FINALIZE_UTF8_STRING (string_buff, string_buff_size);
+  if (length > 0)
+  {
+    ecma_builtin_json_fast_append_indent (builder_p, context_p, depth);
+  }
 
-  /* 3. */
-  tmp_str_p = ecma_concat_ecma_strings (product_str_p, quote_str_p);
-  ecma_deref_ecma_string (product_str_p);
-  ecma_deref_ecma_string (quote_str_p);
-  product_str_p = tmp_str_p;
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_RIGHT_SQUARE);
+  return result;
+} /* ecma_builtin_json_fast_array */
 
-  /* 4. */
-  return ecma_make_string_value (product_str_p);
-} /* ecma_builtin_json_quote */
+/**
+ * Serialize a value by the fast path of JSON.stringify.
+ *
+ * See also:
+ *          ecma_builtin_json_str
+ *
+ * @return ecma_json_fast_result_t
+ */
+static ecma_json_fast_result_t
+ecma_builtin_json_fast_str (ecma_stringbuilder_t *builder_p, /**< string builder */
+                            ecma_value_t value, /**< value to serialize */
+                            ecma_json_stringify_context_t *context_p, /**< context */
+                            const ecma_json_fast_ancestor_t *ancestor_p, /**< objects which contain the value */
+                            uint32_t depth) /**< nesting depth of the value */
+{
+  if (ecma_is_value_string (value))
+  {
+    ecma_builtin_json_append_quoted (builder_p, ecma_get_string_from_value (value));
+    return ECMA_JSON_FAST_SERIALIZED;
+  }
+
+  if (ecma_is_value_number (value))
+  {
+    ecma_builtin_json_fast_append_number (builder_p, value);
+    return ECMA_JSON_FAST_SERIALIZED;
+  }
+
+  if (ecma_is_value_null (value))
+  {
+    ecma_stringbuilder_append_magic (builder_p, LIT_MAGIC_STRING_NULL);
+    return ECMA_JSON_FAST_SERIALIZED;
+  }
+
+  if (ecma_is_value_boolean (value))
+  {
+    ecma_stringbuilder_append_magic (builder_p, (ecma_is_value_true (value) ? LIT_MAGIC_STRING_TRUE
+                                                                             : LIT_MAGIC_STRING_FALSE));
+    return ECMA_JSON_FAST_SERIALIZED;
+  }
+
+  if (!ecma_is_value_object (value) || ecma_op_is_callable (value))
+  {
+    return ECMA_JSON_FAST_UNDEFINED;
+  }
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (value);
+
+  if (!ecma_builtin_json_fast_is_plain_object (obj_p))
+  {
+    return ECMA_JSON_FAST_UNSUPPORTED;
+  }
+
+  /* The standard algorithm throws the error for cyclic structures. */
+  for (const ecma_json_fast_ancestor_t *iter_p = ancestor_p; iter_p != NULL; iter_p = iter_p->parent_p)
+  {
+    if (iter_p->object_p == obj_p)
+    {
+      return ECMA_JSON_FAST_UNSUPPORTED;
+    }
+  }
+
+  ecma_json_fast_ancestor_t ancestor;
+  ancestor.parent_p = ancestor_p;
+  ancestor.object_p = obj_p;
+
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    return ecma_builtin_json_fast_array (builder_p, &ancestor, context_p, depth);
+  }
+
+  return ecma_builtin_json_fast_object (builder_p, &ancestor, context_p, depth);
+} /* ecma_builtin_json_fast_str */
+
+/**
+ * Serialize a value without calling user code, if it consists of plain objects,
+ * arrays and primitive values only.
+ *
+ * Since no user code is executed, the standard algorithm produces the same result
+ * when it is called for the same value after this function fails.
+ *
+ * @return true - if the value is serialized into the string builder
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_json_serialize_fast (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                  ecma_value_t value, /**< value to serialize */
+                                  ecma_json_stringify_context_t *context_p) /**< context */
+{
+  return ecma_builtin_json_fast_str (builder_p, value, context_p, NULL, 0) == ECMA_JSON_FAST_SERIALIZED;
+} /* ecma_builtin_json_serialize_fast */
 
 /**
  * Abstract operation 'Str' defined in 15.12.3
@@ -1478,37 +2102,25 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
     /* 8.b */
     if (!ecma_is_value_undefined (str_val))
     {
-      ecma_string_t *colon_p = ecma_get_magic_string (LIT_MAGIC_STRING_COLON_CHAR);
-      ecma_string_t *value_str_p = ecma_get_string_from_value (str_val);
-      ecma_string_t *tmp_str_p;
+      ecma_stringbuilder_t builder;
+      ecma_stringbuilder_init (&builder);
 
       /* 8.b.i */
-      ecma_value_t str_comp_val = ecma_builtin_json_quote (key_p);
-      JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (str_comp_val));
-
-      ecma_string_t *member_str_p = ecma_get_string_from_value (str_comp_val);
+      ecma_builtin_json_append_quoted (&builder, key_p);
 
       /* 8.b.ii */
-      tmp_str_p = ecma_concat_ecma_strings (member_str_p, colon_p);
-      ecma_free_value (str_comp_val);
-      ecma_deref_ecma_string (colon_p);
-      member_str_p = tmp_str_p;
+      ecma_stringbuilder_append_byte (&builder, LIT_CHAR_COLON);
 
       /* 8.b.iii */
       if (!ecma_string_is_empty (context_p->gap_str_p))
       {
-        ecma_string_t *space_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_SPACE_CHAR);
-
-        tmp_str_p = ecma_concat_ecma_strings (member_str_p, space_str_p);
-        ecma_deref_ecma_string (member_str_p);
-        ecma_deref_ecma_string (space_str_p);
-        member_str_p = tmp_str_p;
+        ecma_stringbuilder_append_byte (&builder, LIT_CHAR_SP);
       }
 
       /* 8.b.iv */
-      tmp_str_p = ecma_concat_ecma_strings (member_str_p, value_str_p);
-      ecma_deref_ecma_string (member_str_p);
-      member_str_p = tmp_str_p;
+      ecma_stringbuilder_append (&builder, ecma_get_string_from_value (str_val));
+
+      ecma_string_t *member_str_p = ecma_stringbuilder_finalize (&builder);
 
       /* 8.b.v */
       ecma_value_t member_value = ecma_make_string_value (member_str_p);
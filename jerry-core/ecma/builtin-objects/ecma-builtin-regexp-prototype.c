@@ -23,6 +23,7 @@
 #include "ecma-helpers.h"
 #include "ecma-objects.h"
 #include "ecma-try-catch-macro.h"
+#include "lit-char-helpers.h"
 
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
 #include "ecma-regexp-object.h"
@@ -368,14 +369,13 @@ ecma_builtin_regexp_prototype_to_string (ecma_value_t this_arg) /**< this argume
     ecma_property_t *source_prop_p = ecma_op_object_get_property (obj_p, magic_string_p);
     ecma_deref_ecma_string (magic_string_p);
 
-    ecma_string_t *src_sep_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_SLASH_CHAR);
-    ecma_string_t *source_str_p = ecma_get_string_from_value (ecma_get_named_data_property_value (source_prop_p));
-    ecma_string_t *output_str_p = ecma_concat_ecma_strings (src_sep_str_p, source_str_p);
+    ecma_stringbuilder_t builder;
+    ecma_stringbuilder_init (&builder);
 
-    ecma_string_t *concat_p = ecma_concat_ecma_strings (output_str_p, src_sep_str_p);
-    ecma_deref_ecma_string (src_sep_str_p);
-    ecma_deref_ecma_string (output_str_p);
-    output_str_p = concat_p;
+    ecma_stringbuilder_append_byte (&builder, LIT_CHAR_SLASH);
+    ecma_stringbuilder_append (&builder,
+                               ecma_get_string_from_value (ecma_get_named_data_property_value (source_prop_p)));
+    ecma_stringbuilder_append_byte (&builder, LIT_CHAR_SLASH);
 
     /* Check the global flag */
     magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_GLOBAL);
@@ -384,11 +384,7 @@ ecma_builtin_regexp_prototype_to_string (ecma_value_t this_arg) /**< this argume
 
     if (ecma_is_value_true (ecma_get_named_data_property_value (global_prop_p)))
     {
-      ecma_string_t *g_flag_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_G_CHAR);
-      concat_p = ecma_concat_ecma_strings (output_str_p, g_flag_str_p);
-      ecma_deref_ecma_string (output_str_p);
-      ecma_deref_ecma_string (g_flag_str_p);
-      output_str_p = concat_p;
+      ecma_stringbuilder_append_byte (&builder, LIT_CHAR_LOWERCASE_G);
     }
 
     /* Check the ignoreCase flag */
@@ -398,28 +394,20 @@ ecma_builtin_regexp_prototype_to_string (ecma_value_t this_arg) /**< this argume
 
     if (ecma_is_value_true (ecma_get_named_data_property_value (ignorecase_prop_p)))
     {
-      ecma_string_t *ic_flag_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_I_CHAR);
-      concat_p = ecma_concat_ecma_strings (output_str_p, ic_flag_str_p);
-      ecma_deref_ecma_string (output_str_p);
-      ecma_deref_ecma_string (ic_flag_str_p);
-      output_str_p = concat_p;
+      ecma_stringbuilder_append_byte (&builder, LIT_CHAR_LOWERCASE_I);
     }
 
-    /* Check the global flag */
+    /* Check the multiline flag */
     magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_MULTILINE);
     ecma_property_t *multiline_prop_p = ecma_op_object_get_property (obj_p, magic_string_p);
     ecma_deref_ecma_string (magic_string_p);
 
     if (ecma_is_value_true (ecma_get_named_data_property_value (multiline_prop_p)))
     {
-      ecma_string_t *m_flag_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_M_CHAR);
-      concat_p = ecma_concat_ecma_strings (output_str_p, m_flag_str_p);
-      ecma_deref_ecma_string (output_str_p);
-      ecma_deref_ecma_string (m_flag_str_p);
-      output_str_p = concat_p;
+      ecma_stringbuilder_append_byte (&builder, LIT_CHAR_LOWERCASE_M);
     }
 
-    ret_value = ecma_make_string_value (output_str_p);
+    ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
 
     ECMA_FINALIZE (obj_this);
   }
@@ -248,8 +248,9 @@ ecma_builtin_string_prototype_object_concat (ecma_value_t this_arg, /**< this ar
   /* No copy performed */
 
   /* 4 */
-  ecma_string_t *string_to_return = ecma_get_string_from_value (to_string_val);
-  ecma_ref_ecma_string (string_to_return);
+  ecma_stringbuilder_t builder;
+  ecma_stringbuilder_init (&builder);
+  ecma_stringbuilder_append (&builder, ecma_get_string_from_value (to_string_val));
 
   /* 5 */
   for (uint32_t arg_index = 0;
@@ -258,15 +259,11 @@ ecma_builtin_string_prototype_object_concat (ecma_value_t this_arg, /**< this ar
   {
     /* 5a */
     /* 5b */
-    ecma_string_t *string_temp = string_to_return;
-
     ECMA_TRY_CATCH (get_arg_string,
                     ecma_op_to_string (argument_list_p[arg_index]),
                     ret_value);
 
-    string_to_return = ecma_concat_ecma_strings (string_to_return, ecma_get_string_from_value (get_arg_string));
-
-    ecma_deref_ecma_string (string_temp);
+    ecma_stringbuilder_append (&builder, ecma_get_string_from_value (get_arg_string));
 
     ECMA_FINALIZE (get_arg_string);
   }
@@ -274,11 +271,11 @@ ecma_builtin_string_prototype_object_concat (ecma_value_t this_arg, /**< this ar
   /* 6 */
   if (ecma_is_value_empty (ret_value))
   {
-    ret_value = ecma_make_string_value (string_to_return);
+    ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
   }
   else
   {
-    ecma_deref_ecma_string (string_to_return);
+    ecma_stringbuilder_destroy (&builder);
   }
 
   ECMA_FINALIZE (to_string_val);
@@ -1018,7 +1015,8 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
       }
 
       /* if not a continuation byte */
-      if ((*replace_str_curr_p & LIT_UTF8_EXTRA_BYTE_MASK) != LIT_UTF8_EXTRA_BYTE_MARKER)
+      if (replace_str_curr_p >= replace_str_end_p
+          || (*replace_str_curr_p & LIT_UTF8_EXTRA_BYTE_MASK) != LIT_UTF8_EXTRA_BYTE_MARKER)
       {
         current_position++;
       }
@@ -1547,19 +1545,15 @@ ecma_builtin_helper_split_match (ecma_value_t input_string, /**< first argument
     }
     else
     {
-      bool is_different = false;
-
       /* 5. */
-      for (ecma_length_t i = 0; i < separator_length && !is_different; i++)
-      {
-        ecma_char_t char_from_string = ecma_string_get_char_at_pos (string_str_p, start_idx + i);
-        ecma_char_t char_from_separator = ecma_string_get_char_at_pos (separator_str_p, i);
+      ecma_length_t index_of = 0;
+      bool is_different = !ecma_builtin_helper_string_find_index (string_str_p,
+                                                                   separator_str_p,
+                                                                   true,
+                                                                   start_idx,
+                                                                   &index_of);
 
-        if (char_from_string != char_from_separator)
-        {
-          is_different = true;
-        }
-      }
+      is_different = is_different || (index_of != start_idx);
 
       if (!is_different)
       {
@@ -1758,6 +1752,24 @@ ecma_builtin_string_prototype_object_split (ecma_value_t this_arg, /**< this arg
           /* 13. */
           while (curr_pos < string_length && !should_return && ecma_is_value_empty (ret_value))
           {
+            if (ecma_is_value_string (separator))
+            {
+              /* Skip the positions where the separator string cannot match. */
+              ecma_length_t index_of = 0;
+
+              if (!ecma_builtin_helper_string_find_index (this_to_string_p,
+                                                          ecma_get_string_from_value (separator),
+                                                          true,
+                                                          curr_pos,
+                                                          &index_of))
+              {
+                break;
+              }
+
+              curr_pos = index_of;
+              JERRY_ASSERT (curr_pos < string_length);
+            }
+
             ecma_value_t match_result = ecma_builtin_helper_split_match (this_to_string_val,
                                                                          curr_pos,
                                                                          separator);
@@ -446,6 +446,231 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
   JERRY_UNREACHABLE ();
 } /* ecma_op_array_object_define_own_property */
 
+/**
+ * Check whether every element of an array is a writable, enumerable and configurable data property,
+ * and optionally collect the element properties by index.
+ *
+ * @return true - if the elements are plain data properties and the array has no holes
+ *         false - otherwise
+ */
+static bool
+ecma_op_array_object_collect_plain_elements (ecma_object_t *obj_p, /**< array object */
+                                             uint32_t len, /**< length of the array */
+                                             ecma_property_t **elements_p) /**< [out] element properties,
+                                                                            *   can be NULL */
+{
+  uint32_t element_count = 0;
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
+  while (prop_iter_p != NULL)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      ecma_property_t *property_p = prop_iter_p->types + i;
+
+      if (ECMA_PROPERTY_GET_TYPE (property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA
+          && ECMA_PROPERTY_GET_TYPE (property_p) != ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+      {
+        continue;
+      }
+
+      ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+      ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[i]);
+
+      uint32_t index;
+
+      if (!ecma_string_get_array_index (name_p, &index))
+      {
+        continue;
+      }
+
+      JERRY_ASSERT (index < len);
+
+      if (ECMA_PROPERTY_GET_TYPE (property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA
+          || !ecma_is_property_writable (property_p)
+          || !ecma_is_property_enumerable (property_p)
+          || !ecma_is_property_configurable (property_p))
+      {
+        return false;
+      }
+
+      if (elements_p != NULL)
+      {
+        elements_p[index] = property_p;
+      }
+
+      element_count++;
+    }
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
+  /* Property names are unique, so the array has no holes if every index is found. */
+  return element_count == len;
+} /* ecma_op_array_object_collect_plain_elements */
+
+/**
+ * Replace the elements in [start, start + delete_count) of an array with the items
+ * and relocate the following elements in bulk.
+ *
+ * Note:
+ *      This is the fast path of Array.prototype.shift, unshift and splice. The element values
+ *      are moved between the property value slots, so no property name is created for the
+ *      moved elements. It is used only for ordinary arrays with writable length, whose elements
+ *      are all writable, enumerable and configurable data properties, and whose new elements do
+ *      not shadow inherited properties. The values of the deleted elements must be read before.
+ *
+ * @return true - if the elements are relocated and the length is updated
+ *         false - if the fast path cannot be used, the array is not changed in this case
+ */
+bool
+ecma_op_array_object_relocate_elements (ecma_object_t *obj_p, /**< array object */
+                                        uint32_t len, /**< expected length of the array */
+                                        uint32_t start, /**< index of the first deleted element */
+                                        uint32_t delete_count, /**< number of deleted elements */
+                                        const ecma_value_t *items_p, /**< inserted items */
+                                        uint32_t item_count) /**< number of inserted items */
+{
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_ARRAY
+      || ecma_get_object_is_builtin (obj_p))
+  {
+    return false;
+  }
+
+  ecma_string_t *magic_string_length_p = ecma_new_ecma_length_string ();
+  ecma_property_t *len_prop_p = ecma_op_object_get_own_property (obj_p, magic_string_length_p);
+  ecma_deref_ecma_string (magic_string_length_p);
+
+  JERRY_ASSERT (len_prop_p != NULL && ECMA_PROPERTY_GET_TYPE (len_prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+  if (!ecma_is_property_writable (len_prop_p)
+      || ecma_get_uint32_from_value (ecma_get_named_data_property_value (len_prop_p)) != len
+      || start > len
+      || delete_count > len - start
+      || item_count > UINT32_MAX - (len - delete_count))
+  {
+    return false;
+  }
+
+  uint32_t new_len = len - delete_count + item_count;
+
+  if (new_len > len)
+  {
+    if (!ecma_get_object_extensible (obj_p))
+    {
+      return false;
+    }
+
+    /* Putting the new elements would call the inherited setters. */
+    ecma_object_t *prototype_p = ecma_get_object_prototype (obj_p);
+
+    for (uint32_t index = len; index < new_len && prototype_p != NULL; index++)
+    {
+      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+      ecma_property_t *property_p = ecma_op_object_get_property (prototype_p, index_str_p);
+      ecma_deref_ecma_string (index_str_p);
+
+      if (property_p != NULL)
+      {
+        return false;
+      }
+    }
+  }
+
+  uint32_t slot_count = JERRY_MAX (len, new_len);
+
+  if (slot_count == 0)
+  {
+    return false;
+  }
+
+  /* The array is checked before the allocation, since sparse arrays may have a huge length. */
+  if (!ecma_op_array_object_collect_plain_elements (obj_p, len, NULL))
+  {
+    return false;
+  }
+
+  JMEM_DEFINE_LOCAL_ARRAY (elements_p, slot_count, ecma_property_t *);
+
+  bool is_plain = ecma_op_array_object_collect_plain_elements (obj_p, len, elements_p);
+  JERRY_ASSERT (is_plain);
+
+  /* The new elements are created before any value is moved, because the allocation may trigger a gc. */
+  for (uint32_t index = len; index < new_len; index++)
+  {
+    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+    elements_p[index] = ecma_create_named_data_property (obj_p,
+                                                         index_str_p,
+                                                         ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
+    ecma_deref_ecma_string (index_str_p);
+  }
+
+  for (uint32_t index = start; index < start + delete_count; index++)
+  {
+    ecma_free_value_if_not_object (ecma_get_named_data_property_value (elements_p[index]));
+  }
+
+  uint32_t from = start + delete_count;
+  uint32_t to = start + item_count;
+  uint32_t move_count = len - from;
+
+  if (to < from)
+  {
+    for (uint32_t i = 0; i < move_count; i++)
+    {
+      ecma_value_t value = ecma_get_named_data_property_value (elements_p[from + i]);
+      ecma_set_named_data_property_value (elements_p[to + i], value);
+    }
+  }
+  else if (to > from)
+  {
+    for (uint32_t i = move_count; i > 0; i--)
+    {
+      ecma_value_t value = ecma_get_named_data_property_value (elements_p[from + i - 1]);
+      ecma_set_named_data_property_value (elements_p[to + i - 1], value);
+    }
+  }
+
+  /* Clear the slots whose values are moved or freed, before copying the items may trigger a gc. */
+  for (uint32_t index = start; index < to; index++)
+  {
+    ecma_set_named_data_property_value (elements_p[index], ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+  }
+
+  for (uint32_t index = new_len; index < len; index++)
+  {
+    ecma_set_named_data_property_value (elements_p[index], ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+  }
+
+  /* The last elements are the most recently created ones, which are at the front of the property list. */
+  for (uint32_t index = len; index > new_len; index--)
+  {
+    ecma_delete_property (obj_p, elements_p[index - 1]);
+  }
+
+  for (uint32_t i = 0; i < item_count; i++)
+  {
+    ecma_set_named_data_property_value (elements_p[start + i], ecma_copy_value_if_not_object (items_p[i]));
+  }
+
+  ecma_property_value_t *len_prop_value_p = ECMA_PROPERTY_VALUE_PTR (len_prop_p);
+  ecma_value_assign_uint32 (&len_prop_value_p->value, new_len);
+
+  JMEM_FINALIZE_LOCAL_ARRAY (elements_p);
+
+  return true;
+} /* ecma_op_array_object_relocate_elements */
+
 /**
  * @}
  * @}
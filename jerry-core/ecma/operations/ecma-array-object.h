@@ -31,6 +31,9 @@ ecma_op_create_array_object (const ecma_value_t *, ecma_length_t, bool);
 extern ecma_value_t
 ecma_op_array_object_define_own_property (ecma_object_t *, ecma_string_t *, const ecma_property_descriptor_t *, bool);
 
+extern bool
+ecma_op_array_object_relocate_elements (ecma_object_t *, uint32_t, uint32_t, uint32_t, const ecma_value_t *, uint32_t);
+
 /**
  * @}
  * @}
@@ -21,7 +21,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
-#include "js-parser.h"
+#include "js-parser-cache.h"
 #include "vm.h"
 
 /** \addtogroup ecma ECMA
@@ -58,6 +58,7 @@ ecma_op_eval (ecma_string_t *code_p, /**< code string */
 
     ret_value = ecma_op_eval_chars_buffer (code_utf8_buffer_p,
                                            chars_num,
+                                           code_p,
                                            is_direct,
                                            is_called_from_strict_mode_code);
 
@@ -79,6 +80,8 @@ ecma_op_eval (ecma_string_t *code_p, /**< code string */
 ecma_value_t
 ecma_op_eval_chars_buffer (const lit_utf8_byte_t *code_p, /**< code characters buffer */
                            size_t code_buffer_size, /**< size of the buffer */
+                           ecma_string_t *code_str_p, /**< code string if available, NULL otherwise
+                                                       *   (used as the key of the compiled code cache) */
                            bool is_direct, /**< is eval called directly (ECMA-262 v5, 15.1.2.1.1) */
                            bool is_called_from_strict_mode_code) /**< is eval is called from strict mode code */
 {
@@ -88,10 +91,11 @@ ecma_op_eval_chars_buffer (const lit_utf8_byte_t *code_p, /**< code characters b
 
   bool is_strict_call = (is_direct && is_called_from_strict_mode_code);
 
-  ecma_value_t parse_status = parser_parse_script (code_p,
-                                                   code_buffer_size,
-                                                   is_strict_call,
-                                                   &bytecode_data_p);
+  ecma_value_t parse_status = parser_cache_parse_script (code_p,
+                                                         code_buffer_size,
+                                                         code_str_p,
+                                                         is_strict_call,
+                                                         &bytecode_data_p);
 
   if (ECMA_IS_VALUE_ERROR (parse_status))
   {
@@ -27,6 +27,7 @@
 #include "ecma-objects-arguments.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
+#include "js-parser.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -532,6 +533,51 @@ ecma_op_function_has_instance (ecma_object_t *func_obj_p, /**< Function object *
   return ret_value;
 } /* ecma_op_function_has_instance */
 
+/**
+ * Replace the byte code of a lazily compiled function object with the compiled byte code.
+ *
+ * The function body is compiled when the first function object created
+ * from the same function literal is called.
+ *
+ * @return true - if successful
+ *         syntax error - otherwise (e.g. when the parser runs out of memory)
+ */
+static ecma_value_t
+ecma_op_function_compile_lazy (ecma_extended_object_t *ext_func_p) /**< function object */
+{
+  cbc_lazy_function_t *lazy_function_p;
+  lazy_function_p = ECMA_GET_INTERNAL_VALUE_POINTER (cbc_lazy_function_t,
+                                                     ext_func_p->u.function.bytecode_cp);
+
+  JERRY_ASSERT (lazy_function_p->header.header.status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION);
+
+  ecma_compiled_code_t *bytecode_p;
+
+  if (lazy_function_p->bytecode_cp == JMEM_CP_NULL)
+  {
+    ecma_value_t parse_status = parser_parse_lazy_function ((ecma_compiled_code_t *) lazy_function_p,
+                                                            &bytecode_p);
+
+    if (ECMA_IS_VALUE_ERROR (parse_status))
+    {
+      return parse_status;
+    }
+
+    /* The reference of the parser is owned by the placeholder. */
+    ECMA_SET_NON_NULL_POINTER (lazy_function_p->bytecode_cp, bytecode_p);
+  }
+  else
+  {
+    bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, lazy_function_p->bytecode_cp);
+  }
+
+  ecma_bytecode_ref (bytecode_p);
+  ECMA_SET_INTERNAL_VALUE_POINTER (ext_func_p->u.function.bytecode_cp, bytecode_p);
+  ecma_bytecode_deref ((ecma_compiled_code_t *) lazy_function_p);
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+} /* ecma_op_function_compile_lazy */
+
 /**
  * [[Call]] implementation for Function objects,
  * created through 13.2 (ECMA_OBJECT_TYPE_FUNCTION)
@@ -580,6 +626,19 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       bytecode_data_p = ECMA_GET_INTERNAL_VALUE_POINTER (const ecma_compiled_code_t,
                                                          ext_func_p->u.function.bytecode_cp);
 
+      if (unlikely (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+      {
+        ecma_value_t compile_status = ecma_op_function_compile_lazy (ext_func_p);
+
+        if (ECMA_IS_VALUE_ERROR (compile_status))
+        {
+          return compile_status;
+        }
+
+        bytecode_data_p = ECMA_GET_INTERNAL_VALUE_POINTER (const ecma_compiled_code_t,
+                                                           ext_func_p->u.function.bytecode_cp);
+      }
+
       is_strict = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) ? true : false;
       is_no_lex_env = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED) ? true : false;
 
@@ -832,6 +832,69 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
   return ret_p;
 } /* ecma_op_object_get_property_names */
 
+/**
+ * Check whether every array index below the limit is an own property of the object
+ *
+ * Note:
+ *      lazy instantiated properties are not listed, so built-in and String objects are never dense
+ *
+ * @return true - if the object has an own property for each index in [0, limit)
+ *         false - otherwise
+ */
+bool
+ecma_op_object_has_dense_array_indices (ecma_object_t *obj_p, /**< object */
+                                        uint32_t limit) /**< upper bound of the indices */
+{
+  JERRY_ASSERT (obj_p != NULL
+                && !ecma_is_lexical_environment (obj_p));
+
+  if (ecma_get_object_is_builtin (obj_p)
+      || ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_STRING)
+  {
+    return false;
+  }
+
+  uint32_t index_count = 0;
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
+  while (prop_iter_p != NULL)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      ecma_property_t *property_p = prop_iter_p->types + i;
+
+      if (ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          || ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+      {
+        ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+        ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[i]);
+
+        uint32_t index;
+
+        /* Property names are unique, so counting the indices below the limit is enough. */
+        if (ecma_string_get_array_index (name_p, &index) && index < limit)
+        {
+          index_count++;
+        }
+      }
+    }
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
+  return index_count == limit;
+} /* ecma_op_object_has_dense_array_indices */
+
 /**
  * Get [[Class]] string of specified object
  *
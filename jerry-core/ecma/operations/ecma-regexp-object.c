@@ -25,6 +25,7 @@
 #include "ecma-try-catch-macro.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
+#include "re-automaton.h"
 #include "re-compiler.h"
 
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
@@ -1162,6 +1163,356 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
   return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
 } /* re_match_regexp */
 
+/**
+ * Flag of the automaton stack items which restore a saved string pointer
+ */
+#define RE_AUTOMATON_RESTORE_FLAG 0x80000000u
+
+/**
+ * Stack item of the RegExp automaton
+ */
+typedef struct
+{
+  uint32_t value;                     /**< instruction index or saved pointer index with RE_AUTOMATON_RESTORE_FLAG */
+  const lit_utf8_byte_t *saved_p;     /**< saved pointer to restore */
+} re_automaton_stack_item_t;
+
+/**
+ * Thread list of the RegExp automaton
+ */
+typedef struct
+{
+  uint16_t *inst_idx_p;               /**< instruction index of the threads */
+  const lit_utf8_byte_t **saved_p;    /**< saved pointers of the threads */
+  uint32_t count;                     /**< number of threads */
+} re_automaton_thread_list_t;
+
+/**
+ * Context of the RegExp automaton
+ */
+typedef struct
+{
+  re_matcher_ctx_t *re_ctx_p;         /**< RegExp matcher context */
+  const re_compiled_code_t *bytecode_p; /**< compiled RegExp */
+  const re_automaton_inst_t *inst_p;  /**< automaton instructions */
+  re_automaton_stack_item_t *stack_p; /**< stack for adding threads */
+  uint32_t *visited_p;                /**< generation of the last visit of the instructions */
+  uint32_t generation;                /**< current generation */
+} re_automaton_run_ctx_t;
+
+/**
+ * Check a RegExp assertion at the given position
+ *
+ * @return true - if the assertion holds
+ *         false - otherwise
+ */
+static bool
+re_automaton_check_assertion (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                              uint8_t opcode, /**< assertion opcode */
+                              const lit_utf8_byte_t *str_curr_p) /**< current position */
+{
+  switch (opcode)
+  {
+    case RE_AUTOMATON_ASSERT_START:
+    {
+      if (str_curr_p <= re_ctx_p->input_start_p)
+      {
+        return true;
+      }
+
+      return ((re_ctx_p->flags & RE_FLAG_MULTILINE)
+              && lit_char_is_line_terminator (lit_utf8_peek_prev (str_curr_p)));
+    }
+    case RE_AUTOMATON_ASSERT_END:
+    {
+      if (str_curr_p >= re_ctx_p->input_end_p)
+      {
+        return true;
+      }
+
+      return ((re_ctx_p->flags & RE_FLAG_MULTILINE)
+              && lit_char_is_line_terminator (lit_utf8_peek_next (str_curr_p)));
+    }
+    default:
+    {
+      JERRY_ASSERT (opcode == RE_AUTOMATON_ASSERT_WORD_BOUNDARY
+                    || opcode == RE_AUTOMATON_ASSERT_NOT_WORD_BOUNDARY);
+
+      bool is_wordchar_left = (str_curr_p > re_ctx_p->input_start_p
+                               && lit_char_is_word_char (lit_utf8_peek_prev (str_curr_p)));
+      bool is_wordchar_right = (str_curr_p < re_ctx_p->input_end_p
+                                && lit_char_is_word_char (lit_utf8_peek_next (str_curr_p)));
+
+      return (opcode == RE_AUTOMATON_ASSERT_WORD_BOUNDARY) == (is_wordchar_left != is_wordchar_right);
+    }
+  }
+} /* re_automaton_check_assertion */
+
+/**
+ * Add a thread and all the threads reachable from it without reading
+ * a character to a thread list in priority order
+ */
+static void
+re_automaton_add_thread (re_automaton_run_ctx_t *run_ctx_p, /**< automaton context */
+                         re_automaton_thread_list_t *list_p, /**< thread list */
+                         uint32_t inst_idx, /**< instruction index of the thread */
+                         const lit_utf8_byte_t **saved_p, /**< saved pointers of the thread
+                                                          *   (modified, but restored before return) */
+                         const lit_utf8_byte_t *str_curr_p) /**< current position */
+{
+  uint32_t num_of_saved = run_ctx_p->re_ctx_p->num_of_captures;
+  re_automaton_stack_item_t *stack_top_p = run_ctx_p->stack_p;
+
+  stack_top_p->value = inst_idx;
+  stack_top_p++;
+
+  while (stack_top_p > run_ctx_p->stack_p)
+  {
+    stack_top_p--;
+
+    if (stack_top_p->value & RE_AUTOMATON_RESTORE_FLAG)
+    {
+      saved_p[stack_top_p->value & ~RE_AUTOMATON_RESTORE_FLAG] = stack_top_p->saved_p;
+      continue;
+    }
+
+    inst_idx = stack_top_p->value;
+
+    if (run_ctx_p->visited_p[inst_idx] == run_ctx_p->generation)
+    {
+      continue;
+    }
+
+    run_ctx_p->visited_p[inst_idx] = run_ctx_p->generation;
+
+    const re_automaton_inst_t *inst_p = run_ctx_p->inst_p + inst_idx;
+
+    switch (inst_p->opcode)
+    {
+      case RE_AUTOMATON_JUMP:
+      {
+        stack_top_p->value = inst_p->arg;
+        stack_top_p++;
+        break;
+      }
+      case RE_AUTOMATON_SPLIT:
+      {
+        /* The preferred path is pushed last, so it is processed first. */
+        stack_top_p->value = inst_p->value;
+        stack_top_p++;
+        stack_top_p->value = inst_p->arg;
+        stack_top_p++;
+        break;
+      }
+      case RE_AUTOMATON_SAVE:
+      case RE_AUTOMATON_CLEAR:
+      {
+        stack_top_p->value = inst_p->arg | RE_AUTOMATON_RESTORE_FLAG;
+        stack_top_p->saved_p = saved_p[inst_p->arg];
+        stack_top_p++;
+
+        saved_p[inst_p->arg] = (inst_p->opcode == RE_AUTOMATON_SAVE) ? str_curr_p : NULL;
+
+        stack_top_p->value = inst_idx + 1;
+        stack_top_p++;
+        break;
+      }
+      case RE_AUTOMATON_ASSERT_START:
+      case RE_AUTOMATON_ASSERT_END:
+      case RE_AUTOMATON_ASSERT_WORD_BOUNDARY:
+      case RE_AUTOMATON_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        if (re_automaton_check_assertion (run_ctx_p->re_ctx_p, inst_p->opcode, str_curr_p))
+        {
+          stack_top_p->value = inst_idx + 1;
+          stack_top_p++;
+        }
+        break;
+      }
+      default:
+      {
+        list_p->inst_idx_p[list_p->count] = (uint16_t) inst_idx;
+        memcpy (list_p->saved_p + list_p->count * num_of_saved,
+                saved_p,
+                num_of_saved * sizeof (const lit_utf8_byte_t *));
+        list_p->count++;
+        break;
+      }
+    }
+  }
+} /* re_automaton_add_thread */
+
+/**
+ * Check whether an automaton instruction accepts the current character
+ *
+ * @return true - if the character is accepted
+ *         false - otherwise
+ */
+static bool
+re_automaton_match_char (re_automaton_run_ctx_t *run_ctx_p, /**< automaton context */
+                         const re_automaton_inst_t *inst_p, /**< automaton instruction */
+                         ecma_char_t ch, /**< current character */
+                         ecma_char_t canonical_ch) /**< canonicalized current character */
+{
+  switch (inst_p->opcode)
+  {
+    case RE_AUTOMATON_CHAR:
+    {
+      return inst_p->arg == canonical_ch;
+    }
+    case RE_AUTOMATON_PERIOD:
+    {
+      return !lit_char_is_line_terminator (ch);
+    }
+    default:
+    {
+      JERRY_ASSERT (inst_p->opcode == RE_AUTOMATON_CHAR_CLASS
+                    || inst_p->opcode == RE_AUTOMATON_INV_CHAR_CLASS);
+
+      bool is_ignorecase = run_ctx_p->re_ctx_p->flags & RE_FLAG_IGNORE_CASE;
+      uint8_t *bc_p = ((uint8_t *) run_ctx_p->bytecode_p) + inst_p->value;
+      uint32_t num_of_ranges = re_get_value (&bc_p);
+      bool is_match = false;
+
+      while (num_of_ranges-- > 0 && !is_match)
+      {
+        ecma_char_t ch1 = re_canonicalize (re_get_char (&bc_p), is_ignorecase);
+        ecma_char_t ch2 = re_canonicalize (re_get_char (&bc_p), is_ignorecase);
+
+        is_match = (canonical_ch >= ch1 && canonical_ch <= ch2);
+      }
+
+      return is_match == (inst_p->opcode == RE_AUTOMATON_CHAR_CLASS);
+    }
+  }
+} /* re_automaton_match_char */
+
+/**
+ * Match a RegExp with its linear-time automaton
+ *
+ * A new thread is started at each position until a match is found, so every
+ * start position is tried in a single pass over the input. The threads are
+ * kept in priority order, so the match is the same as the match of the
+ * backtracking matcher. The captures follow ECMA-262 v5, 15.10.2.5.
+ *
+ * @return true - if matched, the capture pointers are stored into the saved pointers of the context
+ *         false - otherwise
+ */
+static bool
+re_match_automaton (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                    const re_compiled_code_t *bytecode_p, /**< compiled RegExp */
+                    const lit_utf8_byte_t *str_p) /**< first start position */
+{
+  JERRY_ASSERT (bytecode_p->automaton_offset != 0);
+
+  const uint32_t length = bytecode_p->automaton_length;
+  const uint32_t num_of_saved = re_ctx_p->num_of_captures;
+  const bool is_ignorecase = re_ctx_p->flags & RE_FLAG_IGNORE_CASE;
+  bool is_match = false;
+
+  re_automaton_run_ctx_t run_ctx;
+  run_ctx.re_ctx_p = re_ctx_p;
+  run_ctx.bytecode_p = bytecode_p;
+  run_ctx.inst_p = RE_AUTOMATON_GET_INSTRUCTIONS (bytecode_p);
+  run_ctx.generation = 1;
+
+  JMEM_DEFINE_LOCAL_ARRAY (stack_p, 2 * length + 1, re_automaton_stack_item_t);
+  JMEM_DEFINE_LOCAL_ARRAY (visited_p, length, uint32_t);
+  JMEM_DEFINE_LOCAL_ARRAY (inst_idx_p, 2 * length, uint16_t);
+  JMEM_DEFINE_LOCAL_ARRAY (saved_p, (2 * length + 1) * num_of_saved, const lit_utf8_byte_t *);
+
+  run_ctx.stack_p = stack_p;
+  run_ctx.visited_p = visited_p;
+  memset (visited_p, 0, length * sizeof (uint32_t));
+
+  /* The saved pointers of a new thread are stored after the two thread lists. */
+  const lit_utf8_byte_t **start_saved_p = saved_p + 2 * length * num_of_saved;
+
+  for (uint32_t i = 0; i < num_of_saved; i++)
+  {
+    start_saved_p[i] = NULL;
+  }
+
+  re_automaton_thread_list_t lists[2];
+  lists[0].inst_idx_p = inst_idx_p;
+  lists[0].saved_p = saved_p;
+  lists[0].count = 0;
+  lists[1].inst_idx_p = inst_idx_p + length;
+  lists[1].saved_p = saved_p + length * num_of_saved;
+  lists[1].count = 0;
+
+  re_automaton_thread_list_t *current_list_p = lists;
+  re_automaton_thread_list_t *next_list_p = lists + 1;
+  const lit_utf8_byte_t *str_curr_p = str_p;
+
+  re_automaton_add_thread (&run_ctx, current_list_p, 0, start_saved_p, str_curr_p);
+
+  /* New threads are started until a match is found, so the thread list can be empty before that. */
+  while (current_list_p->count > 0 || !is_match)
+  {
+    const lit_utf8_byte_t *str_next_p = str_curr_p;
+    ecma_char_t ch = 0;
+    ecma_char_t canonical_ch = 0;
+    bool has_char = (str_curr_p < re_ctx_p->input_end_p);
+
+    if (has_char)
+    {
+      ch = lit_utf8_read_next (&str_next_p);
+      canonical_ch = re_canonicalize (ch, is_ignorecase);
+    }
+
+    run_ctx.generation++;
+    next_list_p->count = 0;
+
+    for (uint32_t i = 0; i < current_list_p->count; i++)
+    {
+      const re_automaton_inst_t *inst_p = run_ctx.inst_p + current_list_p->inst_idx_p[i];
+      const lit_utf8_byte_t **thread_saved_p = current_list_p->saved_p + i * num_of_saved;
+
+      if (inst_p->opcode == RE_AUTOMATON_MATCH)
+      {
+        /* The threads with lower priority are dropped. */
+        memcpy (re_ctx_p->saved_p, thread_saved_p, num_of_saved * sizeof (const lit_utf8_byte_t *));
+        is_match = true;
+        break;
+      }
+
+      if (has_char && re_automaton_match_char (&run_ctx, inst_p, ch, canonical_ch))
+      {
+        re_automaton_add_thread (&run_ctx,
+                                 next_list_p,
+                                 current_list_p->inst_idx_p[i] + 1u,
+                                 thread_saved_p,
+                                 str_next_p);
+      }
+    }
+
+    if (!has_char)
+    {
+      break;
+    }
+
+    str_curr_p = str_next_p;
+
+    if (!is_match)
+    {
+      /* Start a new thread at the next position with the lowest priority. */
+      re_automaton_add_thread (&run_ctx, next_list_p, 0, start_saved_p, str_curr_p);
+    }
+
+    re_automaton_thread_list_t *tmp_list_p = current_list_p;
+    current_list_p = next_list_p;
+    next_list_p = tmp_list_p;
+  }
+
+  JMEM_FINALIZE_LOCAL_ARRAY (saved_p);
+  JMEM_FINALIZE_LOCAL_ARRAY (inst_idx_p);
+  JMEM_FINALIZE_LOCAL_ARRAY (visited_p);
+  JMEM_FINALIZE_LOCAL_ARRAY (stack_p);
+
+  return is_match;
+} /* re_match_automaton */
+
 /**
  * Define the necessary properties for the result array (index, input, length).
  */
@@ -1213,6 +1564,45 @@ re_set_result_array_properties (ecma_object_t *array_obj_p, /**< result array */
   ecma_deref_ecma_string (result_prop_str_p);
 } /* re_set_result_array_properties */
 
+/**
+ * Find the first position where a match can start, using the literal prefix
+ * or the first character set of the RegExp
+ *
+ * @return pointer to the position - if found
+ *         NULL - if the RegExp cannot match after str_p
+ */
+static const lit_utf8_byte_t *
+re_find_match_start (const re_compiled_code_t *bc_p, /**< RegExp bytecode */
+                     const lit_utf8_byte_t *str_p, /**< current position */
+                     const lit_utf8_byte_t *str_end_p) /**< end of the input string */
+{
+  const uint8_t *compiled_code_start_p = (const uint8_t *) bc_p;
+
+  if (bc_p->prefix_offset != 0)
+  {
+    return lit_utf8_string_find (str_p,
+                                 (lit_utf8_size_t) (str_end_p - str_p),
+                                 compiled_code_start_p + bc_p->prefix_offset,
+                                 bc_p->prefix_size);
+  }
+
+  const uint8_t *set_p = compiled_code_start_p + bc_p->first_char_set_offset;
+
+  while (str_p < str_end_p)
+  {
+    lit_utf8_byte_t byte = *str_p;
+
+    if (set_p[byte >> 3] & (1u << (byte & 0x7)))
+    {
+      return str_p;
+    }
+
+    str_p++;
+  }
+
+  return NULL;
+} /* re_find_match_start */
+
 /**
  * RegExp helper function to start the recursive matching algorithm
  * and create the result Array object
@@ -1304,9 +1694,7 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
   bool is_match = false;
   re_ctx.num_of_iterations_p = num_of_iter_p;
   int32_t index = 0;
-  ecma_length_t input_str_len;
-
-  input_str_len = lit_utf8_string_length (input_buffer_p, input_buffer_size);
+  ecma_length_t input_str_len = ecma_string_get_length (input_string_p);
 
   if (input_buffer_p && (re_ctx.flags & RE_FLAG_GLOBAL))
   {
@@ -1352,6 +1740,37 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
       is_match = false;
       break;
     }
+
+    if (bc_p->prefix_offset != 0 || bc_p->first_char_set_offset != 0)
+    {
+      const lit_utf8_byte_t *match_start_p = re_find_match_start (bc_p, input_curr_p, input_end_p);
+
+      if (match_start_p == NULL)
+      {
+        index = (int32_t) input_str_len + 1;
+        continue;
+      }
+
+      index += (int32_t) lit_utf8_string_length (input_curr_p, (lit_utf8_size_t) (match_start_p - input_curr_p));
+      input_curr_p = match_start_p;
+    }
+
+    if (bc_p->automaton_offset != 0)
+    {
+      /* The automaton tries all the remaining start positions at once. */
+      if (!re_match_automaton (&re_ctx, bc_p, input_curr_p))
+      {
+        index = (int32_t) input_str_len + 1;
+        continue;
+      }
+
+      const lit_utf8_byte_t *match_start_p = re_ctx.saved_p[RE_GLOBAL_START_IDX];
+      index += (int32_t) lit_utf8_string_length (input_curr_p, (lit_utf8_size_t) (match_start_p - input_curr_p));
+      input_curr_p = match_start_p;
+      sub_str_p = re_ctx.saved_p[RE_GLOBAL_END_IDX];
+      is_match = true;
+      break;
+    }
     else
     {
       ECMA_TRY_CATCH (match_value, re_match_regexp (&re_ctx,
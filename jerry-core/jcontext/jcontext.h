@@ -23,7 +23,9 @@
 #include "ecma-builtins.h"
 #include "jmem-allocator.h"
 #include "jmem-config.h"
-#include "re-bytecode.h"
+#include "js-parser.h"
+#include "js-parser-cache.h"
+#include "re-cache.h"
 #include "vm-defines.h"
 
 /** \addtogroup context Jerry context
@@ -48,9 +50,6 @@ typedef struct
 {
   /* Update JERRY_CONTEXT_FIRST_MEMBER if the first member changes */
   ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< pointer to instances of built-in objects */
-#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-  const re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
-#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
   ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT]; /**< List of marked (visited during
                                                                *   current GC session) and umarked objects */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< This is used to speed up deallocation. */
@@ -59,11 +58,25 @@ typedef struct
   jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
 #endif /* JERRY_CPOINTER_32_BIT */
   jmem_free_unused_memory_callback_t jmem_free_unused_memory_callback; /**< Callback for freeing up memory. */
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  re_cache_entry_t *re_cache_p; /**< regex cache entries followed by the hash bucket heads */
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+  parser_cache_entry_t *parser_cache_p; /**< compiled code cache entries */
+  parser_arena_chunk_t *parser_arena_chunk_p; /**< chunks of the parser arena, the current one is the first */
+  parser_arena_chunk_t *parser_arena_spare_chunk_p; /**< chunk kept for the next parse */
+  parser_arena_free_block_t *parser_arena_free_block_p; /**< released blocks of the parser arena */
   const lit_utf8_byte_t **lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
   ecma_lit_storage_item_t *string_list_first_p; /**< first item of the literal string list */
   ecma_lit_storage_item_t *number_list_first_p; /**< first item of the literal number list */
   ecma_object_t *ecma_global_lex_env_p; /**< global lexical environment */
+#if CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0
+  ecma_number_string_cache_entry_t ecma_number_string_cache[CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE]; /**< number to
+                                                                                                   *   string cache */
+#endif /* CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0 */
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+  jmem_cpointer_t ecma_enum_cache[CONFIG_ECMA_ENUM_CACHE_SIZE]; /**< enumerable property names cache */
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
   vm_frame_ctx_t *vm_top_context_p; /**< top (current) interpreter context */
   size_t ecma_gc_objects_number; /**< number of currently allocated objects */
   size_t ecma_gc_new_objects; /**< number of newly allocated objects since last GC session */
@@ -72,16 +85,31 @@ typedef struct
                            *   causes call of "try give memory back" callbacks */
   uint32_t lit_magic_string_ex_count; /**< external magic strings count */
   uint32_t jerry_init_flags; /**< run-time configuration flags */
+  size_t parser_arena_size; /**< heap memory used by the parser arena */
+  size_t parser_arena_peak_size; /**< peak heap memory used by the parser arena during the last parse */
+  uint32_t parser_cache_count; /**< number of byte codes in the compiled code cache */
+  uint32_t parser_arena_position; /**< start of the free space in the current parser arena chunk */
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  uint32_t re_cache_size; /**< capacity of the regex cache */
+  uint32_t re_cache_count; /**< number of bytecodes in the regex cache */
+  re_cache_stats_t re_cache_stats; /**< regex cache usage statistics */
+  uint16_t re_cache_lru_first; /**< most recently used regex cache entry */
+  uint16_t re_cache_lru_last; /**< least recently used regex cache entry */
+  uint16_t re_cache_free_first; /**< first unused regex cache entry */
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
   uint8_t ecma_gc_visited_flip_flag; /**< current state of an object's visited flag */
   uint8_t is_direct_eval_form_call; /**< direct call from eval */
   uint8_t jerry_api_available; /**< API availability flag */
-#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-  uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
-#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 
 #ifdef JMEM_STATS
   jmem_heap_stats_t jmem_heap_stats; /**< heap's memory usage statistics */
   jmem_pools_stats_t jmem_pools_stats; /**< pools' memory usage statistics */
+#if CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0
+  ecma_number_string_cache_stats_t ecma_number_string_cache_stats; /**< number to string cache statistics */
+#endif /* CONFIG_ECMA_NUMBER_STRING_CACHE_SIZE > 0 */
+#if CONFIG_ECMA_ENUM_CACHE_SIZE > 0
+  ecma_enum_cache_stats_t ecma_enum_cache_stats; /**< enumeration cache statistics */
+#endif /* CONFIG_ECMA_ENUM_CACHE_SIZE > 0 */
 #endif /* JMEM_STATS */
 
 #ifdef JERRY_VALGRIND_FREYA
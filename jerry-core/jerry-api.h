@@ -52,6 +52,9 @@ typedef enum
   JERRY_INIT_SHOW_REGEXP_OPCODES = (1u << 1), /**< dump regexp byte-code to log after compilation */
   JERRY_INIT_MEM_STATS           = (1u << 2), /**< dump memory statistics */
   JERRY_INIT_MEM_STATS_SEPARATE  = (1u << 3), /**< dump memory statistics and reset peak values after parse */
+  JERRY_INIT_LAZY_FUNCTIONS      = (1u << 4), /**< compile function bodies of scripts passed to jerry_parse
+                                               *   on their first call, the source code must be kept until
+                                               *   jerry_cleanup is called */
 } jerry_init_flag_t;
 
 /**
@@ -136,6 +139,27 @@ typedef struct
   jerry_value_t setter;
 } jerry_property_descriptor_t;
 
+/**
+ * Usage statistics of the compiled regular expression cache
+ */
+typedef struct
+{
+  uint32_t capacity; /**< maximum number of cached regular expressions */
+  uint32_t count; /**< number of currently cached regular expressions */
+  uint32_t hits; /**< number of compilations served from the cache */
+  uint32_t misses; /**< number of compilations not found in the cache */
+  uint32_t evictions; /**< number of least recently used entries dropped from the full cache */
+} jerry_regexp_cache_stats_t;
+
+/**
+ * Source of a script which is stored as a module of a snapshot bundle
+ */
+typedef struct
+{
+  const jerry_char_t *source_p; /**< script source */
+  size_t source_size; /**< script source size */
+} jerry_snapshot_source_t;
+
 /**
  * Type of an external function handler
  */
@@ -156,6 +180,25 @@ typedef bool (*jerry_object_property_foreach_t) (const jerry_value_t property_na
                                                  const jerry_value_t property_value,
                                                  void *user_data_p);
 
+/**
+ * Callback which reads the next chunk of a source code
+ *
+ * The callback copies at most buffer_size bytes to buffer_p and returns
+ * the number of copied bytes, or 0 at the end of the source.
+ */
+typedef size_t (*jerry_source_read_callback_t) (jerry_char_t *buffer_p,
+                                                size_t buffer_size,
+                                                void *user_data_p);
+
+/**
+ * Callback which receives a serialized JSON text
+ *
+ * The text is only valid during the call. It is not zero terminated.
+ */
+typedef void (*jerry_json_write_callback_t) (const jerry_char_t *buffer_p,
+                                             jerry_size_t buffer_size,
+                                             void *user_data_p);
+
 /**
  * General engine functions
  */
@@ -164,15 +207,24 @@ void jerry_cleanup (void);
 void jerry_register_magic_strings (const jerry_char_ptr_t *, uint32_t, const jerry_length_t *);
 void jerry_get_memory_limits (size_t *, size_t *);
 void jerry_gc (void);
+void jerry_set_regexp_cache_size (uint32_t);
+bool jerry_get_regexp_cache_stats (jerry_regexp_cache_stats_t *);
 
 /**
  * Parser and executor functions
  */
 bool jerry_run_simple (const jerry_char_t *, size_t, jerry_init_flag_t);
 jerry_value_t jerry_parse (const jerry_char_t *, size_t, bool);
+jerry_value_t jerry_parse_stream (jerry_source_read_callback_t, void *, bool);
 jerry_value_t jerry_run (const jerry_value_t);
 jerry_value_t jerry_eval (const jerry_char_t *, size_t, bool);
 
+/**
+ * JSON functions
+ */
+jerry_value_t jerry_json_parse (const jerry_char_t *, jerry_size_t);
+jerry_value_t jerry_json_stringify (const jerry_value_t, jerry_json_write_callback_t, void *);
+
 /**
  * Get the global context
  */
@@ -289,7 +341,10 @@ bool jerry_foreach_object_property (const jerry_value_t, jerry_object_property_f
  * Snapshot functions
  */
 size_t jerry_parse_and_save_snapshot (const jerry_char_t *, size_t, bool, bool, uint8_t *, size_t);
+size_t jerry_parse_and_save_snapshot_bundle (const jerry_snapshot_source_t *, size_t, bool, bool, uint8_t *, size_t);
 jerry_value_t jerry_exec_snapshot (const void *, size_t, bool);
+jerry_value_t jerry_exec_snapshot_module (const void *, size_t, uint32_t, bool);
+uint32_t jerry_get_snapshot_module_count (const void *, size_t);
 
 /**
  * @}
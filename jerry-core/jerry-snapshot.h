@@ -32,11 +32,19 @@ typedef struct
   uint32_t is_run_global; /**< flag, indicating whether the snapshot
                             *   was saved as 'Global scope'-mode code (true)
                             *   or as eval-mode code (false) */
+  uint32_t module_count; /**< number of modules, the offsets of their byte code
+                          *   are stored in an uint32_t array after the header */
+  uint32_t reserved; /**< padding, must be zero */
 } jerry_snapshot_header_t;
 
 /**
  * Jerry snapshot format version
  */
-#define JERRY_SNAPSHOT_VERSION (5u)
+#define JERRY_SNAPSHOT_VERSION (9u)
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+extern ecma_compiled_code_t *jerry_snapshot_load_function_stub (ecma_compiled_code_t *);
+extern void jerry_snapshot_free_function_stub (ecma_compiled_code_t *);
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
 
 #endif /* !JERRY_SNAPSHOT_H */
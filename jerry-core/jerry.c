@@ -34,6 +34,8 @@
 #include "jerry-api.h"
 #include "jerry-snapshot.h"
 #include "js-parser.h"
+#include "js-parser-cache.h"
+#include "re-cache.h"
 #include "re-compiler.h"
 
 #define JERRY_INTERNAL
@@ -229,6 +231,50 @@ jerry_gc (void)
   ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
 } /* jerry_gc */
 
+/**
+ * Set the capacity of the compiled regular expression cache
+ *
+ * Note:
+ *      should be called right after jerry_init, because the already cached
+ *      regular expressions are released, zero size disables the cache,
+ *      sizes above 1024 are reduced to 1024
+ */
+void
+jerry_set_regexp_cache_size (uint32_t size) /**< maximum number of cached regular expressions */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  re_cache_set_size (size);
+#else /* CONFIG_DISABLE_REGEXP_BUILTIN */
+  JERRY_UNUSED (size);
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+} /* jerry_set_regexp_cache_size */
+
+/**
+ * Get the usage statistics of the compiled regular expression cache
+ *
+ * @return true - if the statistics are filled
+ *         false - if the RegExp built-in is disabled
+ */
+bool
+jerry_get_regexp_cache_stats (jerry_regexp_cache_stats_t *out_stats_p) /**< [out] cache statistics */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  out_stats_p->capacity = JERRY_CONTEXT (re_cache_size);
+  out_stats_p->count = JERRY_CONTEXT (re_cache_count);
+  out_stats_p->hits = JERRY_CONTEXT (re_cache_stats).hits;
+  out_stats_p->misses = JERRY_CONTEXT (re_cache_stats).misses;
+  out_stats_p->evictions = JERRY_CONTEXT (re_cache_stats).evictions;
+  return true;
+#else /* CONFIG_DISABLE_REGEXP_BUILTIN */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+} /* jerry_get_regexp_cache_stats */
+
 /**
  * Simple Jerry runner
  *
@@ -265,26 +311,29 @@ jerry_run_simple (const jerry_char_t *script_source_p, /**< script source */
 } /* jerry_run_simple */
 
 /**
- * Parse script and construct an EcmaScript function. The lexical
- * environment is set to the global lexical environment.
+ * Parse script and construct an EcmaScript function (see also jerry_parse).
  *
  * @return function object value - if script was parsed successfully,
  *         thrown error - otherwise
  */
-jerry_value_t
-jerry_parse (const jerry_char_t *source_p, /**< script source */
-             size_t source_size, /**< script source size */
-             bool is_strict) /**< strict mode */
+static jerry_value_t
+jerry_parse_source (const jerry_char_t *source_p, /**< script source */
+                    size_t source_size, /**< script source size */
+                    bool is_strict, /**< strict mode */
+                    bool is_source_kept) /**< the source is kept until the engine stops */
 {
-  jerry_assert_api_available ();
-
   ecma_compiled_code_t *bytecode_data_p;
   ecma_value_t parse_status;
 
-  parse_status = parser_parse_script (source_p,
-                                      source_size,
-                                      is_strict,
-                                      &bytecode_data_p);
+  if (is_source_kept && (JERRY_CONTEXT (jerry_init_flags) & JERRY_INIT_LAZY_FUNCTIONS))
+  {
+    /* The lazily compiled functions refer to the source buffer, so their byte code cannot be shared. */
+    parse_status = parser_parse_script (source_p, source_size, is_strict, true, &bytecode_data_p);
+  }
+  else
+  {
+    parse_status = parser_cache_parse_script (source_p, source_size, NULL, is_strict, &bytecode_data_p);
+  }
 
   if (ECMA_IS_VALUE_ERROR (parse_status))
   {
@@ -309,8 +358,94 @@ jerry_parse (const jerry_char_t *source_p, /**< script source */
   ecma_bytecode_deref (bytecode_data_p);
 
   return ecma_make_object_value (func_obj_p);
+} /* jerry_parse_source */
+
+/**
+ * Parse script and construct an EcmaScript function. The lexical
+ * environment is set to the global lexical environment.
+ *
+ * @return function object value - if script was parsed successfully,
+ *         thrown error - otherwise
+ */
+jerry_value_t
+jerry_parse (const jerry_char_t *source_p, /**< script source */
+             size_t source_size, /**< script source size */
+             bool is_strict) /**< strict mode */
+{
+  jerry_assert_api_available ();
+
+  return jerry_parse_source (source_p, source_size, is_strict, true);
 } /* jerry_parse */
 
+/**
+ * Initial size of the source buffer of jerry_parse_stream
+ */
+#define JERRY_PARSE_STREAM_INITIAL_BUFFER_SIZE 1024
+
+/**
+ * Parse a script whose source code is read in chunks by a callback and construct
+ * an EcmaScript function. The lexical environment is set to the global lexical
+ * environment.
+ *
+ * Note:
+ *      the chunks are collected on the engine heap and released after parsing,
+ *      so the application does not need to hold the whole source, but the
+ *      engine heap must have room for up to three times the source size
+ *
+ * @return function object value - if script was parsed successfully,
+ *         thrown error - otherwise
+ */
+jerry_value_t
+jerry_parse_stream (jerry_source_read_callback_t read_cb, /**< source reader callback */
+                    void *user_data_p, /**< user data passed to the callback */
+                    bool is_strict) /**< strict mode */
+{
+  jerry_assert_api_available ();
+
+  size_t buffer_size = JERRY_PARSE_STREAM_INITIAL_BUFFER_SIZE;
+  size_t source_size = 0;
+  jerry_char_t *buffer_p = (jerry_char_t *) jmem_heap_alloc_block_null_on_error (buffer_size);
+
+  while (buffer_p != NULL)
+  {
+    if (source_size == buffer_size)
+    {
+      /* Doubling the buffer keeps the number of copies logarithmic. */
+      jerry_char_t *new_buffer_p = (jerry_char_t *) jmem_heap_alloc_block_null_on_error (buffer_size * 2);
+
+      if (new_buffer_p != NULL)
+      {
+        memcpy (new_buffer_p, buffer_p, source_size);
+      }
+
+      jmem_heap_free_block (buffer_p, buffer_size);
+      buffer_p = new_buffer_p;
+      buffer_size *= 2;
+      continue;
+    }
+
+    size_t read_size = read_cb (buffer_p + source_size, buffer_size - source_size, user_data_p);
+
+    if (read_size == 0)
+    {
+      break;
+    }
+
+    JERRY_ASSERT (read_size <= buffer_size - source_size);
+    source_size += read_size;
+  }
+
+  if (buffer_p == NULL)
+  {
+    return ecma_raise_range_error (ECMA_ERR_MSG ("Not enough memory for the source code."));
+  }
+
+  jerry_value_t ret_value = jerry_parse_source (buffer_p, source_size, is_strict, false);
+
+  jmem_heap_free_block (buffer_p, buffer_size);
+  return ret_value;
+} /* jerry_parse_stream */
+
 /**
  * Run an EcmaScript function created by jerry_parse.
  *
@@ -372,10 +507,83 @@ jerry_eval (const jerry_char_t *source_p, /**< source code */
 
   return ecma_op_eval_chars_buffer ((const lit_utf8_byte_t *) source_p,
                                     source_size,
+                                    NULL,
                                     false,
                                     is_strict);
 } /* jerry_eval */
 
+/**
+ * Parse a JSON text without creating an intermediate string value.
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return parsed value - if the text is a valid JSON text
+ *         thrown error - otherwise
+ */
+jerry_value_t
+jerry_json_parse (const jerry_char_t *json_p, /**< JSON text (cesu-8 string) */
+                  jerry_size_t json_size) /**< size of the JSON text */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+  return ecma_builtin_json_parse_buffer ((const lit_utf8_byte_t *) json_p, (lit_utf8_size_t) json_size);
+#else /* CONFIG_DISABLE_JSON_BUILTIN */
+  JERRY_UNUSED (json_p);
+  JERRY_UNUSED (json_size);
+  return ecma_raise_common_error (ECMA_ERR_MSG ("JSON support is disabled."));
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+} /* jerry_json_parse */
+
+/**
+ * Serialize a value to JSON text and pass the text to a write callback
+ * without creating an intermediate string value.
+ *
+ * The value is serialized as JSON.stringify (value) does: there is no
+ * replacer function and no indentation. The text is collected in a string
+ * builder, and the callback is called once with the whole text.
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return true - if the text is passed to the callback
+ *         undefined - if the value has no JSON representation (e.g. undefined or a function),
+ *                     the callback is not called in this case
+ *         thrown error - if the serialization throws an exception
+ */
+jerry_value_t
+jerry_json_stringify (const jerry_value_t value, /**< value to serialize */
+                      jerry_json_write_callback_t write_cb, /**< callback which receives the text */
+                      void *user_data_p) /**< user data passed to the callback */
+{
+  jerry_assert_api_available ();
+
+  if (ECMA_IS_VALUE_ERROR (value))
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (error_value_msg_p));
+  }
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+  ecma_stringbuilder_t builder;
+  ecma_stringbuilder_init (&builder);
+
+  ecma_value_t ret_value = ecma_builtin_json_stringify_to_builder (value, &builder);
+
+  if (ecma_is_value_true (ret_value))
+  {
+    write_cb ((const jerry_char_t *) builder.buffer_p, (jerry_size_t) builder.size, user_data_p);
+  }
+
+  ecma_stringbuilder_destroy (&builder);
+  return ret_value;
+#else /* CONFIG_DISABLE_JSON_BUILTIN */
+  JERRY_UNUSED (write_cb);
+  JERRY_UNUSED (user_data_p);
+  return ecma_raise_common_error (ECMA_ERR_MSG ("JSON support is disabled."));
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+} /* jerry_json_stringify */
+
 /**
  * Get global object
  *
@@ -1762,6 +1970,42 @@ jerry_foreach_object_property (const jerry_value_t obj_val, /**< object value */
   return false;
 } /* jerry_foreach_object_property */
 
+#if defined (JERRY_ENABLE_SNAPSHOT_SAVE) || defined (JERRY_ENABLE_SNAPSHOT_EXEC)
+
+/**
+ * Get the size of the offset table which follows the byte code of a function in the snapshot.
+ *
+ * The table contains the uint32_t snapshot offsets of the functions and regular
+ * expressions referenced by the literal table (from const_literal_end to literal_end).
+ *
+ * @return size of the table in bytes (aligned to JMEM_ALIGNMENT)
+ */
+static size_t
+snapshot_get_code_offset_table_size (const ecma_compiled_code_t *compiled_code_p) /**< function byte code */
+{
+  uint32_t const_literal_end;
+  uint32_t literal_end;
+
+  JERRY_ASSERT (compiled_code_p->status_flags & CBC_CODE_FLAGS_FUNCTION);
+
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    const cbc_uint16_arguments_t *args_p = (const cbc_uint16_arguments_t *) compiled_code_p;
+    literal_end = args_p->literal_end;
+    const_literal_end = args_p->const_literal_end;
+  }
+  else
+  {
+    const cbc_uint8_arguments_t *args_p = (const cbc_uint8_arguments_t *) compiled_code_p;
+    literal_end = args_p->literal_end;
+    const_literal_end = args_p->const_literal_end;
+  }
+
+  return JERRY_ALIGNUP ((literal_end - const_literal_end) * sizeof (uint32_t), JMEM_ALIGNMENT);
+} /* snapshot_get_code_offset_table_size */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_SAVE || JERRY_ENABLE_SNAPSHOT_EXEC */
+
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
 
 /**
@@ -1804,9 +2048,13 @@ snapshot_write_to_buffer_by_offset (uint8_t *buffer_p, /**< buffer */
 /**
  * Snapshot callback for byte codes.
  *
- * @return start offset
+ * Note:
+ *      functions are followed by the offset table of their sub-functions
+ *      (see snapshot_get_code_offset_table_size)
+ *
+ * @return start offset in bytes
  */
-static uint16_t
+static uint32_t
 snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled code */
                             uint8_t *snapshot_buffer_p, /**< snapshot buffer */
                             size_t snapshot_buffer_size, /**< snapshot buffer size */
@@ -1819,13 +2067,13 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
 
   JERRY_ASSERT ((globals_p->snapshot_buffer_write_offset & (JMEM_ALIGNMENT - 1)) == 0);
 
-  if ((globals_p->snapshot_buffer_write_offset >> JMEM_ALIGNMENT_LOG) > 0xffffu)
+  if (globals_p->snapshot_buffer_write_offset > UINT32_MAX)
   {
     globals_p->snapshot_error_occured = true;
     return 0;
   }
 
-  uint16_t start_offset = (uint16_t) (globals_p->snapshot_buffer_write_offset >> JMEM_ALIGNMENT_LOG);
+  uint32_t start_offset = (uint32_t) globals_p->snapshot_buffer_write_offset;
 
   uint8_t *copied_code_start_p = snapshot_buffer_p + globals_p->snapshot_buffer_write_offset;
   ecma_compiled_code_t *copied_code_p = (ecma_compiled_code_t *) copied_code_start_p;
@@ -1833,18 +2081,24 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
   if (!(compiled_code_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
   {
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-    /* Regular expression. */
-    if (globals_p->snapshot_buffer_write_offset + sizeof (ecma_compiled_code_t) > snapshot_buffer_size)
+    /* Regular expression: the compiled program is followed by the pattern string. Only the
+     * pattern pointer is not relocatable, so the program size (in JMEM_ALIGNMENT units) is
+     * stored in its place, and the pattern size is stored in the reference counter. */
+    const re_compiled_code_t *re_bytecode_p = (const re_compiled_code_t *) compiled_code_p;
+    size_t program_size = ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG;
+
+    if (!snapshot_write_to_buffer_by_offset (snapshot_buffer_p,
+                                             snapshot_buffer_size,
+                                             &globals_p->snapshot_buffer_write_offset,
+                                             compiled_code_p,
+                                             program_size))
     {
       globals_p->snapshot_error_occured = true;
       return 0;
     }
 
-    globals_p->snapshot_buffer_write_offset += sizeof (ecma_compiled_code_t);
-
-    jmem_cpointer_t pattern_cp = ((re_compiled_code_t *) compiled_code_p)->pattern_cp;
     ecma_string_t *pattern_string_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                                 pattern_cp);
+                                                                 re_bytecode_p->pattern_cp);
 
     ecma_length_t pattern_size = 0;
 
@@ -1866,13 +2120,21 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
     globals_p->snapshot_buffer_write_offset = JERRY_ALIGNUP (globals_p->snapshot_buffer_write_offset,
                                                              JMEM_ALIGNMENT);
 
-    /* Regexp character size is stored in refs. */
-    copied_code_p->refs = (uint16_t) pattern_size;
+    size_t total_size = JERRY_ALIGNUP (program_size + pattern_size, JMEM_ALIGNMENT);
 
-    pattern_size += (ecma_length_t) sizeof (ecma_compiled_code_t);
-    copied_code_p->size = (uint16_t) ((pattern_size + JMEM_ALIGNMENT - 1) >> JMEM_ALIGNMENT_LOG);
+    if (globals_p->snapshot_error_occured
+        || pattern_size > UINT16_MAX
+        || (total_size >> JMEM_ALIGNMENT_LOG) > UINT16_MAX)
+    {
+      globals_p->snapshot_error_occured = true;
+      return 0;
+    }
+
+    re_compiled_code_t *copied_re_code_p = (re_compiled_code_t *) copied_code_p;
+    copied_re_code_p->pattern_cp = compiled_code_p->size;
 
-    copied_code_p->status_flags = compiled_code_p->status_flags;
+    copied_code_p->refs = (uint16_t) pattern_size;
+    copied_code_p->size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
 
 #else /* CONFIG_DISABLE_REGEXP_BUILTIN */
     JERRY_UNREACHABLE (); /* RegExp is not supported in the selected profile. */
@@ -1890,6 +2152,19 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
     return 0;
   }
 
+  /* Space for the offset table of the sub-functions and regular expressions. */
+  size_t offset_table_start = globals_p->snapshot_buffer_write_offset;
+  size_t offset_table_size = snapshot_get_code_offset_table_size (compiled_code_p);
+
+  if (offset_table_start + offset_table_size > snapshot_buffer_size)
+  {
+    globals_p->snapshot_error_occured = true;
+    return 0;
+  }
+
+  memset (snapshot_buffer_p + offset_table_start, 0, offset_table_size);
+  globals_p->snapshot_buffer_write_offset += offset_table_size;
+
   /* Sub-functions and regular expressions are stored recursively. */
   uint8_t *src_buffer_p = (uint8_t *) compiled_code_p;
   uint8_t *dst_buffer_p = (uint8_t *) copied_code_p;
@@ -1921,25 +2196,28 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
   {
     ecma_compiled_code_t *bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
                                                                   src_literal_start_p[i]);
+    uint32_t literal_offset = start_offset;
 
-    if (bytecode_p == compiled_code_p)
-    {
-      dst_literal_start_p[i] = start_offset;
-    }
-    else
+    if (bytecode_p != compiled_code_p)
     {
-      dst_literal_start_p[i] = snapshot_add_compiled_code (bytecode_p,
-                                                           snapshot_buffer_p,
-                                                           snapshot_buffer_size,
-                                                           globals_p);
+      literal_offset = snapshot_add_compiled_code (bytecode_p,
+                                                   snapshot_buffer_p,
+                                                   snapshot_buffer_size,
+                                                   globals_p);
     }
+
+    /* The offsets do not fit into the literal table, it is filled when the byte code is loaded. */
+    dst_literal_start_p[i] = JMEM_CP_NULL;
+    memcpy (snapshot_buffer_p + offset_table_start + (i - const_literal_end) * sizeof (uint32_t),
+            &literal_offset,
+            sizeof (uint32_t));
   }
 
   return start_offset;
 } /* snapshot_add_compiled_code */
 
 /**
- * Set the uint16_t offsets in the code area.
+ * Set the uint16_t literal offsets in the code area.
  */
 static void
 jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
@@ -2024,6 +2302,8 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
 
       /* Set reference counter to 1. */
       bytecode_p->refs = 1;
+
+      code_size += (uint32_t) snapshot_get_code_offset_table_size (bytecode_p);
     }
 
     buffer_p += code_size;
@@ -2037,6 +2317,9 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
 /**
  * Generate snapshot from specified source
  *
+ * Note:
+ *      the snapshot is a bundle with a single module
+ *
  * @return size of snapshot, if it was generated succesfully
  *          (i.e. there are no syntax errors in source code, buffer size is sufficient,
  *           and snapshot support is enabled in current configuration through JERRY_ENABLE_SNAPSHOT_SAVE),
@@ -2050,30 +2333,88 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
                                bool is_strict, /**< strict mode */
                                uint8_t *buffer_p, /**< buffer to save snapshot to */
                                size_t buffer_size) /**< the buffer's size */
+{
+  jerry_snapshot_source_t source;
+  source.source_p = source_p;
+  source.source_size = source_size;
+
+  return jerry_parse_and_save_snapshot_bundle (&source,
+                                               1,
+                                               is_for_global,
+                                               is_strict,
+                                               buffer_p,
+                                               buffer_size);
+} /* jerry_parse_and_save_snapshot */
+
+/**
+ * Generate a snapshot bundle from specified sources
+ *
+ * Each source is stored as a separate module, which can be executed with
+ * jerry_exec_snapshot_module. The modules share the literal table of the snapshot.
+ *
+ * @return size of snapshot, if it was generated succesfully
+ *          (i.e. there are no syntax errors in the sources, buffer size is sufficient,
+ *           and snapshot support is enabled in current configuration through JERRY_ENABLE_SNAPSHOT_SAVE),
+ *         0 - otherwise.
+ */
+size_t
+jerry_parse_and_save_snapshot_bundle (const jerry_snapshot_source_t *sources_p, /**< script sources */
+                                      size_t source_count, /**< number of script sources */
+                                      bool is_for_global, /**< snapshot would be executed as global (true)
+                                                           *   or eval (false) */
+                                      bool is_strict, /**< strict mode */
+                                      uint8_t *buffer_p, /**< buffer to save snapshot to */
+                                      size_t buffer_size) /**< the buffer's size */
 {
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
   snapshot_globals_t globals;
-  ecma_value_t parse_status;
-  ecma_compiled_code_t *bytecode_data_p;
 
-  globals.snapshot_buffer_write_offset = JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t),
-                                                        JMEM_ALIGNMENT);
-  globals.snapshot_error_occured = false;
+  if (source_count == 0 || source_count > UINT32_MAX / sizeof (uint32_t))
+  {
+    return 0;
+  }
 
-  parse_status = parser_parse_script (source_p,
-                                      source_size,
-                                      is_strict,
-                                      &bytecode_data_p);
+  size_t module_table_size = source_count * sizeof (uint32_t);
+  size_t code_start_offset = JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t) + module_table_size,
+                                            JMEM_ALIGNMENT);
 
-  if (ECMA_IS_VALUE_ERROR (parse_status))
+  if (code_start_offset > buffer_size)
   {
-    ecma_free_value (parse_status);
     return 0;
   }
 
-  snapshot_add_compiled_code (bytecode_data_p, buffer_p, buffer_size, &globals);
+  uint32_t *module_table_p = (uint32_t *) (buffer_p + sizeof (jerry_snapshot_header_t));
+
+  globals.snapshot_buffer_write_offset = code_start_offset;
+  globals.snapshot_error_occured = false;
+
+  /* The byte code of a module is freed before the next one is parsed, so
+   * the size of the bundle is not limited by the size of the heap. */
+  for (size_t i = 0; i < source_count; i++)
+  {
+    ecma_compiled_code_t *bytecode_data_p;
+    ecma_value_t parse_status = parser_parse_script (sources_p[i].source_p,
+                                                     sources_p[i].source_size,
+                                                     is_strict,
+                                                     false,
+                                                     &bytecode_data_p);
+
+    if (ECMA_IS_VALUE_ERROR (parse_status))
+    {
+      ecma_free_value (parse_status);
+      return 0;
+    }
+
+    module_table_p[i] = snapshot_add_compiled_code (bytecode_data_p, buffer_p, buffer_size, &globals);
+    ecma_bytecode_deref (bytecode_data_p);
+
+    if (globals.snapshot_error_occured)
+    {
+      return 0;
+    }
+  }
 
-  if (globals.snapshot_error_occured)
+  if (globals.snapshot_buffer_write_offset > UINT32_MAX)
   {
     return 0;
   }
@@ -2082,6 +2423,8 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
   header.version = JERRY_SNAPSHOT_VERSION;
   header.lit_table_offset = (uint32_t) globals.snapshot_buffer_write_offset;
   header.is_run_global = is_for_global;
+  header.module_count = (uint32_t) source_count;
+  header.reserved = 0;
 
   lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
   uint32_t literals_num;
@@ -2097,8 +2440,8 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
     return 0;
   }
 
-  jerry_snapshot_set_offsets (buffer_p + JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t), JMEM_ALIGNMENT),
-                              (uint32_t) (header.lit_table_offset - sizeof (jerry_snapshot_header_t)),
+  jerry_snapshot_set_offsets (buffer_p + code_start_offset,
+                              (uint32_t) (header.lit_table_offset - code_start_offset),
                               lit_map_p);
 
   size_t header_offset = 0;
@@ -2114,12 +2457,10 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
     jmem_heap_free_block (lit_map_p, literals_num * sizeof (lit_mem_to_snapshot_id_map_entry_t));
   }
 
-  ecma_bytecode_deref (bytecode_data_p);
-
   return globals.snapshot_buffer_write_offset;
 #else /* !JERRY_ENABLE_SNAPSHOT_SAVE */
-  JERRY_UNUSED (source_p);
-  JERRY_UNUSED (source_size);
+  JERRY_UNUSED (sources_p);
+  JERRY_UNUSED (source_count);
   JERRY_UNUSED (is_for_global);
   JERRY_UNUSED (is_strict);
   JERRY_UNUSED (buffer_p);
@@ -2127,7 +2468,7 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
 
   return 0;
 #endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
-} /* jerry_parse_and_save_snapshot */
+} /* jerry_parse_and_save_snapshot_bundle */
 
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 
@@ -2138,34 +2479,157 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
  */
 #define BYTECODE_NO_COPY_TRESHOLD 8
 
+/**
+ * Context of loading byte code from a snapshot.
+ *
+ * When the byte code is not copied, the functions are loaded on demand, and
+ * the context is kept alive by the stubs of the functions which are not loaded yet.
+ */
+typedef struct
+{
+  const uint8_t *snapshot_data_p; /**< snapshot data */
+  lit_mem_to_snapshot_id_map_entry_t *lit_map_p; /**< literal map (sorted by literal offsets) */
+  uint32_t literals_num; /**< number of literals in the map */
+  uint32_t refs; /**< reference counter */
+  bool copy_bytecode; /**< byte code should be copied to memory */
+} snapshot_load_context_t;
+
+/**
+ * Stub of a function which is loaded from the snapshot when its first function object is created.
+ */
+typedef struct
+{
+  ecma_compiled_code_t header; /**< byte code header with CBC_CODE_FLAGS_SNAPSHOT_FUNCTION_STUB flag */
+  jmem_cpointer_t context_cp; /**< snapshot load context */
+  uint32_t offset; /**< offset of the function in the snapshot */
+} snapshot_function_stub_t;
+
+/**
+ * Decrease the reference counter of a snapshot load context and free it if the counter becomes zero.
+ */
+static void
+snapshot_load_context_deref (snapshot_load_context_t *context_p) /**< snapshot load context */
+{
+  JERRY_ASSERT (context_p->refs > 0);
+
+  if (--context_p->refs > 0)
+  {
+    return;
+  }
+
+  if (context_p->lit_map_p != NULL)
+  {
+    jmem_heap_free_block (context_p->lit_map_p,
+                          context_p->literals_num * sizeof (lit_mem_to_snapshot_id_map_entry_t));
+  }
+
+  if (!context_p->copy_bytecode)
+  {
+    jmem_heap_free_block (context_p, sizeof (snapshot_load_context_t));
+  }
+} /* snapshot_load_context_deref */
+
+/**
+ * Find the identifier of a loaded literal.
+ *
+ * @return literal identifier
+ */
+static jmem_cpointer_t
+snapshot_find_literal_id (const snapshot_load_context_t *context_p, /**< snapshot load context */
+                          jmem_cpointer_t literal_offset) /**< literal offset in the snapshot */
+{
+  const lit_mem_to_snapshot_id_map_entry_t *lit_map_p = context_p->lit_map_p;
+  uint32_t lower = 0;
+  uint32_t upper = context_p->literals_num;
+
+  while (lower < upper)
+  {
+    uint32_t middle = lower + (upper - lower) / 2;
+
+    if (lit_map_p[middle].literal_offset < literal_offset)
+    {
+      lower = middle + 1;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+
+  JERRY_ASSERT (lower < context_p->literals_num && lit_map_p[lower].literal_offset == literal_offset);
+  return lit_map_p[lower].literal_id;
+} /* snapshot_find_literal_id */
+
+/**
+ * Create a stub for a function which is loaded on demand.
+ *
+ * @return byte code of the stub
+ */
+static ecma_compiled_code_t *
+snapshot_create_function_stub (uint32_t offset, /**< function offset */
+                               snapshot_load_context_t *context_p) /**< snapshot load context */
+{
+  snapshot_function_stub_t *stub_p;
+  stub_p = (snapshot_function_stub_t *) jmem_heap_alloc_block (sizeof (snapshot_function_stub_t));
+
+  stub_p->header.size = (uint16_t) (JERRY_ALIGNUP (sizeof (snapshot_function_stub_t),
+                                                   JMEM_ALIGNMENT) >> JMEM_ALIGNMENT_LOG);
+  stub_p->header.refs = 1;
+  stub_p->header.status_flags = CBC_CODE_FLAGS_SNAPSHOT_FUNCTION_STUB;
+  ECMA_SET_NON_NULL_POINTER (stub_p->context_cp, context_p);
+  stub_p->offset = offset;
+
+  context_p->refs++;
+  return &stub_p->header;
+} /* snapshot_create_function_stub */
+
 /**
  * Load byte code from snapshot.
  *
  * @return byte code
  */
 static ecma_compiled_code_t *
-snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data */
-                             size_t offset, /**< byte code offset */
-                             lit_mem_to_snapshot_id_map_entry_t *lit_map_p, /**< literal map */
-                             bool copy_bytecode) /**< byte code should be copied to memory */
+snapshot_load_compiled_code (size_t offset, /**< byte code offset */
+                             snapshot_load_context_t *context_p) /**< snapshot load context */
 {
+  const uint8_t *snapshot_data_p = context_p->snapshot_data_p;
   ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) (snapshot_data_p + offset);
   uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
 
   if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
   {
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-    const re_compiled_code_t *re_bytecode_p = NULL;
+    /* See snapshot_add_compiled_code for the layout of the regular expressions. */
+    const re_compiled_code_t *snapshot_re_bytecode_p = (const re_compiled_code_t *) bytecode_p;
+    size_t program_size = ((size_t) snapshot_re_bytecode_p->pattern_cp) << JMEM_ALIGNMENT_LOG;
+    const lit_utf8_byte_t *pattern_start_p = ((const lit_utf8_byte_t *) bytecode_p) + program_size;
+
+    if (program_size < sizeof (re_compiled_code_t)
+        || program_size + bytecode_p->refs > code_size
+        || !lit_is_cesu8_string_valid (pattern_start_p, bytecode_p->refs))
+    {
+      return NULL;
+    }
 
-    const uint8_t *regex_start_p = ((const uint8_t *) bytecode_p) + sizeof (ecma_compiled_code_t);
+    ecma_string_t *pattern_str_p = ecma_new_ecma_string_from_utf8 (pattern_start_p, bytecode_p->refs);
+    uint16_t flags = (uint16_t) (bytecode_p->status_flags & RE_FLAGS_MASK);
 
-    /* Real size is stored in refs. */
-    ecma_string_t *pattern_str_p = ecma_new_ecma_string_from_utf8 (regex_start_p,
-                                                                   bytecode_p->refs);
+    /* The RegExp might be compiled already. */
+    const re_compiled_code_t *re_bytecode_p = re_cache_lookup (pattern_str_p, flags);
 
-    re_compile_bytecode (&re_bytecode_p,
-                         pattern_str_p,
-                         bytecode_p->status_flags);
+    if (re_bytecode_p == NULL)
+    {
+      re_compiled_code_t *loaded_re_bytecode_p = (re_compiled_code_t *) jmem_heap_alloc_block (program_size);
+      memcpy (loaded_re_bytecode_p, bytecode_p, program_size);
+
+      loaded_re_bytecode_p->header.size = (uint16_t) (program_size >> JMEM_ALIGNMENT_LOG);
+      loaded_re_bytecode_p->header.refs = 1;
+      ecma_ref_ecma_string (pattern_str_p);
+      ECMA_SET_NON_NULL_POINTER (loaded_re_bytecode_p->pattern_cp, pattern_str_p);
+
+      re_cache_insert (loaded_re_bytecode_p);
+      re_bytecode_p = loaded_re_bytecode_p;
+    }
 
     ecma_deref_ecma_string (pattern_str_p);
 
@@ -2196,7 +2660,10 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
     header_size = sizeof (cbc_uint8_arguments_t);
   }
 
-  if (copy_bytecode
+  /* See snapshot_add_compiled_code for the layout of the functions. */
+  const uint32_t *offset_table_p = (const uint32_t *) (snapshot_data_p + offset + code_size);
+
+  if (context_p->copy_bytecode
       || (header_size + (literal_end * sizeof (uint16_t)) + BYTECODE_NO_COPY_TRESHOLD > code_size))
   {
     bytecode_p = (ecma_compiled_code_t *) jmem_heap_alloc_block (code_size);
@@ -2228,68 +2695,101 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
 
   for (uint32_t i = 0; i < const_literal_end; i++)
   {
-    lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
-
     if (literal_start_p[i] != 0)
     {
-      while (current_p->literal_offset != literal_start_p[i])
-      {
-        current_p++;
-      }
-
-      literal_start_p[i] = current_p->literal_id;
+      literal_start_p[i] = snapshot_find_literal_id (context_p, literal_start_p[i]);
     }
   }
 
   for (uint32_t i = const_literal_end; i < literal_end; i++)
   {
-    size_t literal_offset = ((size_t) literal_start_p[i]) << JMEM_ALIGNMENT_LOG;
+    size_t literal_offset = offset_table_p[i - const_literal_end];
 
     if (literal_offset == offset)
     {
       /* Self reference */
       ECMA_SET_NON_NULL_POINTER (literal_start_p[i],
                                  bytecode_p);
+      continue;
+    }
+
+    const ecma_compiled_code_t *literal_header_p;
+    literal_header_p = (const ecma_compiled_code_t *) (snapshot_data_p + literal_offset);
+
+    ecma_compiled_code_t *literal_bytecode_p;
+
+    if (!context_p->copy_bytecode
+        && (literal_header_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
+    {
+      /* The snapshot buffer is available until the engine is cleaned up, so the
+       * functions are loaded when their first function object is created. */
+      literal_bytecode_p = snapshot_create_function_stub ((uint32_t) literal_offset, context_p);
     }
     else
     {
-      ecma_compiled_code_t *literal_bytecode_p;
-      literal_bytecode_p = snapshot_load_compiled_code (snapshot_data_p,
-                                                        literal_offset,
-                                                        lit_map_p,
-                                                        copy_bytecode);
-
-      ECMA_SET_NON_NULL_POINTER (literal_start_p[i],
-                                 literal_bytecode_p);
+      literal_bytecode_p = snapshot_load_compiled_code (literal_offset, context_p);
     }
+
+    ECMA_SET_NON_NULL_POINTER (literal_start_p[i],
+                               literal_bytecode_p);
   }
 
   return bytecode_p;
 } /* snapshot_load_compiled_code */
 
-#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
-
 /**
- * Execute snapshot from specified buffer
+ * Load the function which is represented by a stub.
  *
  * Note:
- *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *      the stub is freed, and the caller takes over the reference of the stub
  *
- * @return result of bytecode - if run was successful
+ * @return byte code of the function
+ */
+ecma_compiled_code_t *
+jerry_snapshot_load_function_stub (ecma_compiled_code_t *bytecode_p) /**< byte code of the stub */
+{
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_SNAPSHOT_FUNCTION_STUB);
+  JERRY_ASSERT (bytecode_p->refs == 1);
+
+  snapshot_function_stub_t *stub_p = (snapshot_function_stub_t *) bytecode_p;
+  snapshot_load_context_t *context_p = ECMA_GET_NON_NULL_POINTER (snapshot_load_context_t,
+                                                                  stub_p->context_cp);
+
+  ecma_compiled_code_t *function_bytecode_p = snapshot_load_compiled_code (stub_p->offset, context_p);
+
+  ecma_bytecode_deref (bytecode_p);
+  return function_bytecode_p;
+} /* jerry_snapshot_load_function_stub */
+
+/**
+ * Free a function stub, which reference counter is zero.
+ */
+void
+jerry_snapshot_free_function_stub (ecma_compiled_code_t *bytecode_p) /**< byte code of the stub */
+{
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_SNAPSHOT_FUNCTION_STUB);
+  JERRY_ASSERT (bytecode_p->refs == 0);
+
+  snapshot_function_stub_t *stub_p = (snapshot_function_stub_t *) bytecode_p;
+
+  snapshot_load_context_deref (ECMA_GET_NON_NULL_POINTER (snapshot_load_context_t,
+                                                          stub_p->context_cp));
+  jmem_heap_free_block (stub_p, sizeof (snapshot_function_stub_t));
+} /* jerry_snapshot_free_function_stub */
+
+/**
+ * Execute modules of a snapshot.
+ *
+ * @return result of the last executed module - if run was successful
  *         thrown error - otherwise
  */
-jerry_value_t
-jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
-                     size_t snapshot_size, /**< size of snapshot */
-                     bool copy_bytecode) /**< flag, indicating whether the passed snapshot
-                                          *   buffer should be copied to the engine's memory.
-                                          *   If set the engine should not reference the buffer
-                                          *   after the function returns (in this case, the passed
-                                          *   buffer could be freed after the call).
-                                          *   Otherwise (if the flag is not set) - the buffer could only be
-                                          *   freed after the engine stops (i.e. after call to jerry_cleanup). */
+static ecma_value_t
+snapshot_exec_modules (const void *snapshot_p, /**< snapshot */
+                       size_t snapshot_size, /**< size of snapshot */
+                       uint32_t module_index, /**< index of the module */
+                       bool is_all_modules, /**< execute all modules (module_index is ignored) */
+                       bool copy_bytecode) /**< byte code should be copied to memory */
 {
-#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
   JERRY_ASSERT (snapshot_p != NULL);
 
   static const char * const invalid_version_error_p = "Invalid snapshot version";
@@ -2308,52 +2808,128 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
     return ecma_raise_type_error (invalid_version_error_p);
   }
 
-  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
-  uint32_t literals_num;
-
-  if (header_p->lit_table_offset >= snapshot_size)
+  if (header_p->lit_table_offset >= snapshot_size
+      || header_p->lit_table_offset <= sizeof (jerry_snapshot_header_t))
   {
     return ecma_raise_type_error (invalid_version_error_p);
   }
 
-  if (!ecma_load_literals_from_snapshot (snapshot_data_p + header_p->lit_table_offset,
-                                         header_p->lit_table_size,
-                                         &lit_map_p,
-                                         &literals_num))
+  uint32_t module_count = header_p->module_count;
+
+  if (module_count == 0
+      || module_count > (header_p->lit_table_offset - sizeof (jerry_snapshot_header_t)) / sizeof (uint32_t))
   {
-    JERRY_ASSERT (lit_map_p == NULL);
     return ecma_raise_type_error (invalid_format_error_p);
   }
 
-  ecma_compiled_code_t *bytecode_p;
-  bytecode_p = snapshot_load_compiled_code (snapshot_data_p,
-                                            sizeof (jerry_snapshot_header_t),
-                                            lit_map_p,
-                                            copy_bytecode);
+  uint32_t module_end = module_count;
 
-  if (lit_map_p != NULL)
+  if (is_all_modules)
   {
-    jmem_heap_free_block (lit_map_p, literals_num * sizeof (lit_mem_to_snapshot_id_map_entry_t));
+    module_index = 0;
+  }
+  else
+  {
+    if (module_index >= module_count)
+    {
+      return ecma_raise_range_error ("Invalid snapshot module index");
+    }
+
+    module_end = module_index + 1;
   }
 
-  if (bytecode_p == NULL)
+  snapshot_load_context_t copy_context;
+  snapshot_load_context_t *context_p = &copy_context;
+
+  if (!copy_bytecode)
   {
-    return ecma_raise_type_error (invalid_format_error_p);
+    context_p = (snapshot_load_context_t *) jmem_heap_alloc_block (sizeof (snapshot_load_context_t));
   }
 
-  ecma_value_t ret_val;
+  context_p->snapshot_data_p = snapshot_data_p;
+  context_p->refs = 1;
+  context_p->copy_bytecode = copy_bytecode;
 
-  if (header_p->is_run_global)
+  if (!ecma_load_literals_from_snapshot (snapshot_data_p + header_p->lit_table_offset,
+                                         header_p->lit_table_size,
+                                         &context_p->lit_map_p,
+                                         &context_p->literals_num,
+                                         !copy_bytecode))
   {
-    ret_val = vm_run_global (bytecode_p);
-    ecma_bytecode_deref (bytecode_p);
+    JERRY_ASSERT (context_p->lit_map_p == NULL);
+    snapshot_load_context_deref (context_p);
+    return ecma_raise_type_error (invalid_format_error_p);
   }
-  else
+
+  const uint32_t *module_table_p = (const uint32_t *) (snapshot_data_p + sizeof (jerry_snapshot_header_t));
+  ecma_value_t ret_val = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+  for (uint32_t i = module_index; i < module_end; i++)
   {
-    ret_val = vm_run_eval (bytecode_p, false);
+    uint32_t code_offset = module_table_p[i];
+    ecma_compiled_code_t *bytecode_p = NULL;
+
+    if (code_offset < header_p->lit_table_offset
+        && (code_offset & (JMEM_ALIGNMENT - 1)) == 0)
+    {
+      bytecode_p = snapshot_load_compiled_code (code_offset, context_p);
+    }
+
+    ecma_free_value (ret_val);
+
+    if (bytecode_p == NULL)
+    {
+      ret_val = ecma_raise_type_error (invalid_format_error_p);
+      break;
+    }
+
+    if (header_p->is_run_global)
+    {
+      ret_val = vm_run_global (bytecode_p);
+      ecma_bytecode_deref (bytecode_p);
+    }
+    else
+    {
+      ret_val = vm_run_eval (bytecode_p, false);
+    }
+
+    if (ECMA_IS_VALUE_ERROR (ret_val))
+    {
+      break;
+    }
   }
 
+  snapshot_load_context_deref (context_p);
   return ret_val;
+} /* snapshot_exec_modules */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+/**
+ * Execute snapshot from specified buffer
+ *
+ * Note:
+ *      all modules of a snapshot bundle are executed in order,
+ *      the execution stops at the first error
+ *
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return result of the last module - if run was successful
+ *         thrown error - otherwise
+ */
+jerry_value_t
+jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
+                     size_t snapshot_size, /**< size of snapshot */
+                     bool copy_bytecode) /**< flag, indicating whether the passed snapshot
+                                          *   buffer should be copied to the engine's memory.
+                                          *   If set the engine should not reference the buffer
+                                          *   after the function returns (in this case, the passed
+                                          *   buffer could be freed after the call).
+                                          *   Otherwise (if the flag is not set) - the buffer could only be
+                                          *   freed after the engine stops (i.e. after call to jerry_cleanup). */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  return snapshot_exec_modules (snapshot_p, snapshot_size, 0, true, copy_bytecode);
 #else /* !JERRY_ENABLE_SNAPSHOT_EXEC */
   JERRY_UNUSED (snapshot_p);
   JERRY_UNUSED (snapshot_size);
@@ -2363,6 +2939,63 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
 #endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
 } /* jerry_exec_snapshot */
 
+/**
+ * Execute a single module of a snapshot bundle
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return result of the module - if run was successful
+ *         thrown error - otherwise
+ */
+jerry_value_t
+jerry_exec_snapshot_module (const void *snapshot_p, /**< snapshot */
+                            size_t snapshot_size, /**< size of snapshot */
+                            uint32_t module_index, /**< index of the module */
+                            bool copy_bytecode) /**< flag, indicating whether the passed snapshot
+                                                 *   buffer should be copied to the engine's memory
+                                                 *   (see jerry_exec_snapshot) */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  return snapshot_exec_modules (snapshot_p, snapshot_size, module_index, false, copy_bytecode);
+#else /* !JERRY_ENABLE_SNAPSHOT_EXEC */
+  JERRY_UNUSED (snapshot_p);
+  JERRY_UNUSED (snapshot_size);
+  JERRY_UNUSED (module_index);
+  JERRY_UNUSED (copy_bytecode);
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE);
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+} /* jerry_exec_snapshot_module */
+
+/**
+ * Get the number of modules in a snapshot bundle
+ *
+ * @return number of modules - if the snapshot is valid
+ *         0 - otherwise
+ */
+uint32_t
+jerry_get_snapshot_module_count (const void *snapshot_p, /**< snapshot */
+                                 size_t snapshot_size) /**< size of snapshot */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) snapshot_p;
+
+  if (snapshot_size <= sizeof (jerry_snapshot_header_t)
+      || header_p->version != JERRY_SNAPSHOT_VERSION)
+  {
+    return 0;
+  }
+
+  return header_p->module_count;
+#else /* !JERRY_ENABLE_SNAPSHOT_EXEC */
+  JERRY_UNUSED (snapshot_p);
+  JERRY_UNUSED (snapshot_size);
+
+  return 0;
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+} /* jerry_get_snapshot_module_count */
+
 /**
  * @}
  */
@@ -571,6 +571,11 @@ jmem_heap_stats_print (void)
 {
   jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
 
+  /* Avoid division by zero when nothing has been allocated or freed yet. */
+  size_t nonskip_count = heap_stats->nonskip_count > 0 ? heap_stats->nonskip_count : 1;
+  size_t alloc_count = heap_stats->alloc_count > 0 ? heap_stats->alloc_count : 1;
+  size_t free_count = heap_stats->free_count > 0 ? heap_stats->free_count : 1;
+
   JERRY_DEBUG_MSG ("Heap stats:\n"
                    "  Heap size = %zu bytes\n"
                    "  Allocated = %zu bytes\n"
@@ -586,12 +591,12 @@ jmem_heap_stats_print (void)
                    heap_stats->waste_bytes,
                    heap_stats->peak_allocated_bytes,
                    heap_stats->peak_waste_bytes,
-                   heap_stats->skip_count / heap_stats->nonskip_count,
-                   heap_stats->skip_count % heap_stats->nonskip_count * 10000 / heap_stats->nonskip_count,
-                   heap_stats->alloc_iter_count / heap_stats->alloc_count,
-                   heap_stats->alloc_iter_count % heap_stats->alloc_count * 10000 / heap_stats->alloc_count,
-                   heap_stats->free_iter_count / heap_stats->free_count,
-                   heap_stats->free_iter_count % heap_stats->free_count * 10000 / heap_stats->free_count);
+                   heap_stats->skip_count / nonskip_count,
+                   heap_stats->skip_count % nonskip_count * 10000 / nonskip_count,
+                   heap_stats->alloc_iter_count / alloc_count,
+                   heap_stats->alloc_iter_count % alloc_count * 10000 / alloc_count,
+                   heap_stats->free_iter_count / free_count,
+                   heap_stats->free_iter_count % free_count * 10000 / free_count);
 } /* jmem_heap_stats_print */
 
 /**
@@ -18,6 +18,77 @@
 
 #include "jrt-libc-includes.h"
 
+/**
+ * Machine word used by the word-at-a-time (SWAR) byte scanners
+ */
+typedef uintptr_t lit_utf8_word_t;
+
+/**
+ * Word which has 0x01 in all of its bytes
+ */
+#define LIT_UTF8_WORD_ONES ((lit_utf8_word_t) -1 / 0xff)
+
+/**
+ * Word which has 0x80 in all of its bytes
+ */
+#define LIT_UTF8_WORD_HIGHS (LIT_UTF8_WORD_ONES * 0x80)
+
+/**
+ * Load a machine word from a byte buffer
+ *
+ * Note:
+ *      memcpy keeps the access valid under the strict aliasing rules,
+ *      compilers emit a single load for it
+ *
+ * @return the loaded word
+ */
+static inline lit_utf8_word_t __attr_always_inline___
+lit_utf8_load_word (const lit_utf8_byte_t *buf_p) /**< word aligned position in the buffer */
+{
+  lit_utf8_word_t word;
+  memcpy (&word, buf_p, sizeof (lit_utf8_word_t));
+  return word;
+} /* lit_utf8_load_word */
+
+/**
+ * Checks whether any byte of a word is zero
+ */
+#define LIT_UTF8_WORD_HAS_ZERO_BYTE(word) ((((word) - LIT_UTF8_WORD_ONES) & ~(word) & LIT_UTF8_WORD_HIGHS) != 0)
+
+/**
+ * Skip the ascii characters at the beginning of a buffer
+ *
+ * The buffer is processed one machine word at a time.
+ *
+ * @return pointer to the first non-ascii byte or the end of the buffer
+ */
+static const lit_utf8_byte_t *
+lit_utf8_skip_ascii (const lit_utf8_byte_t *start_p, /**< start of the buffer */
+                     const lit_utf8_byte_t *end_p) /**< end of the buffer */
+{
+  while (start_p < end_p && ((uintptr_t) start_p % sizeof (lit_utf8_word_t)) != 0)
+  {
+    if (*start_p & LIT_UTF8_1_BYTE_MASK)
+    {
+      return start_p;
+    }
+    start_p++;
+  }
+
+  while ((size_t) (end_p - start_p) >= sizeof (lit_utf8_word_t)
+         && (lit_utf8_load_word (start_p) & LIT_UTF8_WORD_HIGHS) == 0)
+  {
+    start_p += sizeof (lit_utf8_word_t);
+  }
+
+  while (start_p < end_p && (*start_p & LIT_UTF8_1_BYTE_MASK) == 0)
+  {
+    start_p++;
+  }
+
+  return start_p;
+} /* lit_utf8_skip_ascii */
+
 /**
  * Validate utf-8 string
  *
@@ -41,6 +112,7 @@ lit_is_utf8_string_valid (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string *
     if ((c & LIT_UTF8_1_BYTE_MASK) == LIT_UTF8_1_BYTE_MARKER)
     {
       is_prev_code_point_high_surrogate = false;
+      idx = (lit_utf8_size_t) (lit_utf8_skip_ascii (utf8_buf_p + idx, utf8_buf_p + buf_size) - utf8_buf_p);
       continue;
     }
 
@@ -136,6 +208,7 @@ lit_is_cesu8_string_valid (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string
     lit_utf8_byte_t c = utf8_buf_p[idx++];
     if ((c & LIT_UTF8_1_BYTE_MASK) == LIT_UTF8_1_BYTE_MARKER)
     {
+      idx = (lit_utf8_size_t) (lit_utf8_skip_ascii (utf8_buf_p + idx, utf8_buf_p + buf_size) - utf8_buf_p);
       continue;
     }
 
@@ -267,18 +340,43 @@ ecma_length_t
 lit_utf8_string_length (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string */
                         lit_utf8_size_t utf8_buf_size) /**< string size */
 {
-  ecma_length_t length = 0;
-  lit_utf8_size_t size = 0;
+  /* Each code unit starts with a non-continuation byte, so the length
+   * is the size minus the number of continuation bytes. */
+  const lit_utf8_byte_t *current_p = utf8_buf_p;
+  const lit_utf8_byte_t *end_p = utf8_buf_p + utf8_buf_size;
+  lit_utf8_size_t extra_bytes_count = 0;
 
-  while (size < utf8_buf_size)
+  while (current_p < end_p && ((uintptr_t) current_p % sizeof (lit_utf8_word_t)) != 0)
   {
-    size += lit_get_unicode_char_size_by_utf8_first_byte (*(utf8_buf_p + size));
-    length++;
+    extra_bytes_count += ((*current_p & LIT_UTF8_EXTRA_BYTE_MASK) == LIT_UTF8_EXTRA_BYTE_MARKER);
+    current_p++;
   }
 
-  JERRY_ASSERT (size == utf8_buf_size);
+  while ((size_t) (end_p - current_p) >= sizeof (lit_utf8_word_t))
+  {
+    lit_utf8_word_t word = lit_utf8_load_word (current_p);
+
+    if (word & LIT_UTF8_WORD_HIGHS)
+    {
+      /* The highest bit of a byte is set and the next one is cleared for continuation bytes.
+       * The number of set bits is summed up by the multiplication in the highest byte. */
+      lit_utf8_word_t extra_bytes = ((word & ~(word << 1) & LIT_UTF8_WORD_HIGHS) >> 7) * LIT_UTF8_WORD_ONES;
+      extra_bytes_count += (lit_utf8_size_t) (extra_bytes >> ((sizeof (lit_utf8_word_t) - 1) * 8));
+    }
 
-  return length;
+    current_p += sizeof (lit_utf8_word_t);
+  }
+
+  while (current_p < end_p)
+  {
+    extra_bytes_count += ((*current_p & LIT_UTF8_EXTRA_BYTE_MASK) == LIT_UTF8_EXTRA_BYTE_MARKER);
+    current_p++;
+  }
+
+  JERRY_ASSERT (utf8_buf_size == 0
+                || (utf8_buf_p[0] & LIT_UTF8_EXTRA_BYTE_MASK) != LIT_UTF8_EXTRA_BYTE_MARKER);
+
+  return (ecma_length_t) (utf8_buf_size - extra_bytes_count);
 } /* lit_utf8_string_length */
 
 /**
@@ -797,3 +895,148 @@ bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, /**<
 
   return (string1_pos >= string1_end_p && string2_pos < string2_end_p);
 } /* lit_compare_utf8_strings_relational */
+
+/**
+ * Find the first occurence of a byte in a buffer
+ *
+ * The buffer is processed one machine word at a time, and the
+ * exact position is determined by a byte-by-byte scan of the
+ * word which contains the byte.
+ *
+ * @return pointer to the byte - if found
+ *         NULL - otherwise
+ */
+static const lit_utf8_byte_t *
+lit_utf8_find_byte (const lit_utf8_byte_t *start_p, /**< start of the buffer */
+                    const lit_utf8_byte_t *end_p, /**< end of the buffer */
+                    lit_utf8_byte_t byte) /**< byte to find */
+{
+  while (start_p < end_p && ((uintptr_t) start_p % sizeof (lit_utf8_word_t)) != 0)
+  {
+    if (*start_p == byte)
+    {
+      return start_p;
+    }
+    start_p++;
+  }
+
+  const lit_utf8_word_t pattern = LIT_UTF8_WORD_ONES * byte;
+
+  while ((size_t) (end_p - start_p) >= sizeof (lit_utf8_word_t))
+  {
+    lit_utf8_word_t word = lit_utf8_load_word (start_p) ^ pattern;
+
+    if (LIT_UTF8_WORD_HAS_ZERO_BYTE (word))
+    {
+      break;
+    }
+    start_p += sizeof (lit_utf8_word_t);
+  }
+
+  while (start_p < end_p)
+  {
+    if (*start_p == byte)
+    {
+      return start_p;
+    }
+    start_p++;
+  }
+
+  return NULL;
+} /* lit_utf8_find_byte */
+
+/**
+ * Find the first occurence of a cesu-8 string in another cesu-8 string
+ *
+ * Since the first byte of a cesu-8 string is never a continuation byte
+ * and the encoding of each code unit is unique, a byte level match is
+ * always a code unit level match as well.
+ *
+ * Candidate positions are selected by searching the first byte of the
+ * searched string, and they are verified by comparing the last byte
+ * and the remaining bytes afterwards.
+ *
+ * @return pointer to the first byte of the match - if found
+ *         NULL - otherwise
+ */
+const lit_utf8_byte_t *
+lit_utf8_string_find (const lit_utf8_byte_t *string_p, /**< cesu-8 string */
+                      lit_utf8_size_t string_size, /**< string size */
+                      const lit_utf8_byte_t *search_p, /**< searched cesu-8 string */
+                      lit_utf8_size_t search_size) /**< searched string size */
+{
+  JERRY_ASSERT (search_size > 0);
+
+  if (search_size > string_size)
+  {
+    return NULL;
+  }
+
+  const lit_utf8_byte_t *last_start_p = string_p + (string_size - search_size);
+  const lit_utf8_byte_t first_byte = search_p[0];
+  const lit_utf8_byte_t last_byte = search_p[search_size - 1];
+
+  while (string_p <= last_start_p)
+  {
+    string_p = lit_utf8_find_byte (string_p, last_start_p + 1, first_byte);
+
+    if (string_p == NULL)
+    {
+      return NULL;
+    }
+
+    if (string_p[search_size - 1] == last_byte
+        && memcmp (string_p + 1, search_p + 1, search_size - 1) == 0)
+    {
+      return string_p;
+    }
+
+    string_p++;
+  }
+
+  return NULL;
+} /* lit_utf8_string_find */
+
+/**
+ * Find the last occurence of a cesu-8 string in another cesu-8 string
+ *
+ * See also:
+ *          lit_utf8_string_find
+ *
+ * @return pointer to the first byte of the match - if found
+ *         NULL - otherwise
+ */
+const lit_utf8_byte_t *
+lit_utf8_string_find_last (const lit_utf8_byte_t *string_p, /**< cesu-8 string */
+                           lit_utf8_size_t string_size, /**< string size */
+                           const lit_utf8_byte_t *search_p, /**< searched cesu-8 string */
+                           lit_utf8_size_t search_size) /**< searched string size */
+{
+  JERRY_ASSERT (search_size > 0);
+
+  if (search_size > string_size)
+  {
+    return NULL;
+  }
+
+  const lit_utf8_byte_t *current_p = string_p + (string_size - search_size);
+  const lit_utf8_byte_t first_byte = search_p[0];
+  const lit_utf8_byte_t last_byte = search_p[search_size - 1];
+
+  while (true)
+  {
+    if (current_p[0] == first_byte
+        && current_p[search_size - 1] == last_byte
+        && memcmp (current_p + 1, search_p + 1, search_size - 1) == 0)
+    {
+      return current_p;
+    }
+
+    if (current_p == string_p)
+    {
+      return NULL;
+    }
+
+    current_p--;
+  }
+} /* lit_utf8_string_find_last */
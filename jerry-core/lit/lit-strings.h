@@ -119,6 +119,12 @@ bool lit_compare_utf8_strings (const lit_utf8_byte_t *, lit_utf8_size_t,
 bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, lit_utf8_size_t,
                                           const lit_utf8_byte_t *string2_p, lit_utf8_size_t);
 
+/* search */
+const lit_utf8_byte_t *lit_utf8_string_find (const lit_utf8_byte_t *, lit_utf8_size_t,
+                                             const lit_utf8_byte_t *, lit_utf8_size_t);
+const lit_utf8_byte_t *lit_utf8_string_find_last (const lit_utf8_byte_t *, lit_utf8_size_t,
+                                                  const lit_utf8_byte_t *, lit_utf8_size_t);
+
 /* read code point from buffer */
 lit_utf8_size_t lit_read_code_point_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t, lit_code_point_t *);
 
@@ -196,10 +196,15 @@
 #define CBC_BRANCH_IS_FORWARD(flags) \
   ((flags) & CBC_FORWARD_BRANCH_ARG)
 
+/* The entries of switch jump tables keep their full length after
+ * post processing, so the execution engine can index them directly. */
+#define CBC_EXT_IS_SWITCH_TABLE_ENTRY(ext_opcode) \
+  ((ext_opcode) >= CBC_EXT_SWITCH_TABLE_ENTRY && (ext_opcode) <= CBC_EXT_SWITCH_TABLE_ENTRY_3)
+
 /* Stack consumption of opcodes with context. */
 
 /* PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION must be <= 4 */
-#define PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION 3
+#define PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION 4
 /* PARSER_WITH_CONTEXT_STACK_ALLOCATION must be <= 4 */
 #define PARSER_WITH_CONTEXT_STACK_ALLOCATION 2
 /* PARSER_TRY_CONTEXT_STACK_ALLOCATION must be <= 3 */
@@ -530,6 +535,12 @@
               VM_OC_PUSH_UNDEFINED_BASE | VM_OC_PUT_STACK) \
   CBC_FORWARD_BRANCH (CBC_EXT_FINALLY, 0, \
                       VM_OC_FINALLY) \
+  CBC_OPCODE (CBC_EXT_SWITCH_INTEGER_TABLE, CBC_HAS_LITERAL_ARG | CBC_HAS_BYTE_ARG, -1, \
+              VM_OC_SWITCH_INTEGER_TABLE | VM_OC_GET_STACK_LITERAL) \
+  CBC_FORWARD_BRANCH (CBC_EXT_SWITCH_TABLE_ENTRY, 0, \
+                      VM_OC_JUMP) \
+  CBC_OPCODE (CBC_EXT_SWITCH_STRING_TABLE, CBC_HAS_BYTE_ARG, 0, \
+              VM_OC_SWITCH_STRING_TABLE) \
   \
   /* Basic opcodes. */ \
   CBC_OPCODE (CBC_EXT_DEBUGGER, CBC_NO_FLAG, 0, \
@@ -634,6 +645,23 @@ typedef struct
   uint16_t literal_end;             /**< end position of the literal group */
 } cbc_uint16_arguments_t;
 
+/**
+ * Function whose body is compiled when it is called first.
+ *
+ * Only the argument_end field of the arguments header is valid,
+ * the function has no literals.
+ */
+typedef struct
+{
+  cbc_uint16_arguments_t header;    /**< compiled code arguments */
+  jmem_cpointer_t bytecode_cp;      /**< byte code of the function (JMEM_CP_NULL before the first call) */
+  uint32_t parser_status_flags;     /**< parser status flags of the function */
+  uint32_t line;                    /**< line of the function start */
+  uint32_t column;                  /**< column of the function start */
+  const uint8_t *source_p;          /**< function start in the source code (after the function keyword) */
+  const uint8_t *source_end_p;      /**< function end in the source code (after its closing brace) */
+} cbc_lazy_function_t;
+
 /* When CBC_CODE_FLAGS_FULL_LITERAL_ENCODING
  * is not set the small encoding is used. */
 #define CBC_CODE_FLAGS_FUNCTION 0x01
@@ -643,6 +671,14 @@ typedef struct
 #define CBC_CODE_FLAGS_ARGUMENTS_NEEDED 0x10
 #define CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED 0x20
 
+/* Placeholder of a function which is loaded from a snapshot when its
+ * first function object is created. CBC_CODE_FLAGS_FUNCTION is not set. */
+#define CBC_CODE_FLAGS_SNAPSHOT_FUNCTION_STUB 0x40
+
+/* Placeholder of a function whose body is compiled on its first call
+ * (see cbc_lazy_function_t). CBC_CODE_FLAGS_FUNCTION is also set. */
+#define CBC_CODE_FLAGS_LAZY_FUNCTION 0x80
+
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg1,
 
 /**
@@ -41,8 +41,9 @@ util_free_literal (lexer_literal_t *literal_p) /**< literal */
       jmem_heap_free_block ((void *) literal_p->u.char_p, literal_p->prop.length);
     }
   }
-  else if ((literal_p->type == LEXER_FUNCTION_LITERAL)
-           || (literal_p->type == LEXER_REGEXP_LITERAL))
+  else if (((literal_p->type == LEXER_FUNCTION_LITERAL)
+            || (literal_p->type == LEXER_REGEXP_LITERAL))
+           && literal_p->u.bytecode_p != NULL)
   {
     ecma_bytecode_deref (literal_p->u.bytecode_p);
   }
@@ -33,6 +33,56 @@
 
 #define IS_UTF8_INTERMEDIATE_OCTET(byte) (((byte) & LIT_UTF8_EXTRA_BYTE_MASK) == LIT_UTF8_2_BYTE_CODE_POINT_MIN)
 
+/**
+ * Character classes of the lexer_char_class table.
+ */
+typedef enum
+{
+  LEXER_CHAR_IDENT_START = (1u << 0),   /**< ASCII identifier start: letters, dollar sign and underscore */
+  LEXER_CHAR_IDENT_PART = (1u << 1),    /**< ASCII identifier part: identifier start characters and digits */
+  LEXER_CHAR_SPACE = (1u << 2),         /**< space, vertical tab and form feed */
+  LEXER_CHAR_COMMENT_STOP = (1u << 3),  /**< bytes which need special handling inside comments:
+                                         *   newlines, tab, asterisk and the first byte of
+                                         *   \u2028, \u2029 and \uFEFF */
+} lexer_char_class_t;
+
+/**
+ * Character classes of the bytes of the source code. The classes of
+ * non-ASCII bytes are empty, those characters use the slow paths.
+ */
+static const uint8_t lexer_char_class[256] =
+{
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x4, 0x4, 0x8, 0x0, 0x0, /* 0x00 - 0x0f */
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0x10 - 0x1f */
+  0x4, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0x20 - 0x2f */
+  0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0x30 - 0x3f */
+  0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, /* 0x40 - 0x4f */
+  0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, /* 0x50 - 0x5f */
+  0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, /* 0x60 - 0x6f */
+  0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0x70 - 0x7f */
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0x80 - 0x8f */
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0x90 - 0x9f */
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0xa0 - 0xaf */
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0xb0 - 0xbf */
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0xc0 - 0xcf */
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, /* 0xd0 - 0xdf */
+  0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, /* 0xe0 - 0xef */
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0  /* 0xf0 - 0xff */
+};
+
+/**
+ * Checks whether the byte has the given lexer_char_class_t class.
+ */
+#define LEXER_CHAR_HAS_CLASS(byte, char_class) (lexer_char_class[(byte)] & (char_class))
+
+/**
+ * Checks whether the source starts with an identifier start character or a backslash.
+ */
+#define LEXER_IS_IDENT_OR_ESCAPE_START(source_p) \
+  (LEXER_CHAR_HAS_CLASS ((source_p)[0], LEXER_CHAR_IDENT_START) \
+   || (source_p)[0] == LIT_CHAR_BACKSLASH \
+   || ((source_p)[0] > LIT_UTF8_1_BYTE_CODE_POINT_MAX && lit_char_is_identifier_start (source_p)))
+
 /**
  * Align column to the next tab position.
  *
@@ -108,6 +158,28 @@ skip_spaces (parser_context_t *context_p) /**< context */
 
   while (true)
   {
+    if (mode != LEXER_SKIP_SPACES)
+    {
+      /* Fast path for the characters which have no special meaning inside comments.
+       * The columns are counted the same way as in the slow path below. */
+      const uint8_t *source_p = context_p->source_p;
+      parser_line_counter_t column = context_p->column;
+
+      while (source_p < source_end_p
+             && !LEXER_CHAR_HAS_CLASS (source_p[0], LEXER_CHAR_COMMENT_STOP))
+      {
+        if (LEXER_CHAR_HAS_CLASS (source_p[0], LEXER_CHAR_SPACE)
+            || (source_p + 1 < source_end_p && IS_UTF8_INTERMEDIATE_OCTET (source_p[1])))
+        {
+          column++;
+        }
+        source_p++;
+      }
+
+      context_p->source_p = source_p;
+      context_p->column = column;
+    }
+
     if (context_p->source_p >= source_end_p)
     {
       if (mode == LEXER_SKIP_MULTI_LINE_COMMENT)
@@ -272,41 +344,25 @@ skip_spaces (parser_context_t *context_p) /**< context */
 typedef struct
 {
   const uint8_t *keyword_p;     /**< keyword string */
+  uint8_t length;               /**< keyword length */
   lexer_token_type_t type;      /**< keyword token type */
 } keyword_string_t;
 
-#define LEXER_KEYWORD(name, type) { (const uint8_t *) (name), (type) }
-#define LEXER_KEYWORD_END()       { (const uint8_t *) NULL, LEXER_EOS }
+#define LEXER_KEYWORD(name, type) { (const uint8_t *) (name), sizeof (name) - 1, (type) }
 
 /**
- * Keywords with 2 characters.
+ * Keywords and reserved words.
  */
-static const keyword_string_t keyword_length_2[4] =
+static const keyword_string_t keyword_strings[] =
 {
   LEXER_KEYWORD ("do", LEXER_KEYW_DO),
   LEXER_KEYWORD ("if", LEXER_KEYW_IF),
   LEXER_KEYWORD ("in", LEXER_KEYW_IN),
-  LEXER_KEYWORD_END ()
-};
-
-/**
- * Keywords with 3 characters.
- */
-static const keyword_string_t keyword_length_3[6] =
-{
   LEXER_KEYWORD ("for", LEXER_KEYW_FOR),
   LEXER_KEYWORD ("let", LEXER_KEYW_LET),
   LEXER_KEYWORD ("new", LEXER_KEYW_NEW),
   LEXER_KEYWORD ("try", LEXER_KEYW_TRY),
   LEXER_KEYWORD ("var", LEXER_KEYW_VAR),
-  LEXER_KEYWORD_END ()
-};
-
-/**
- * Keywords with 4 characters.
- */
-static const keyword_string_t keyword_length_4[9] =
-{
   LEXER_KEYWORD ("case", LEXER_KEYW_CASE),
   LEXER_KEYWORD ("else", LEXER_KEYW_ELSE),
   LEXER_KEYWORD ("enum", LEXER_KEYW_ENUM),
@@ -315,14 +371,6 @@ static const keyword_string_t keyword_length_4[9] =
   LEXER_KEYWORD ("true", LEXER_LIT_TRUE),
   LEXER_KEYWORD ("void", LEXER_KEYW_VOID),
   LEXER_KEYWORD ("with", LEXER_KEYW_WITH),
-  LEXER_KEYWORD_END ()
-};
-
-/**
- * Keywords with 5 characters.
- */
-static const keyword_string_t keyword_length_5[10] =
-{
   LEXER_KEYWORD ("break", LEXER_KEYW_BREAK),
   LEXER_KEYWORD ("catch", LEXER_KEYW_CATCH),
   LEXER_KEYWORD ("class", LEXER_KEYW_CLASS),
@@ -332,14 +380,6 @@ static const keyword_string_t keyword_length_5[10] =
   LEXER_KEYWORD ("throw", LEXER_KEYW_THROW),
   LEXER_KEYWORD ("while", LEXER_KEYW_WHILE),
   LEXER_KEYWORD ("yield", LEXER_KEYW_YIELD),
-  LEXER_KEYWORD_END ()
-};
-
-/**
- * Keywords with 6 characters.
- */
-static const keyword_string_t keyword_length_6[9] =
-{
   LEXER_KEYWORD ("delete", LEXER_KEYW_DELETE),
   LEXER_KEYWORD ("export", LEXER_KEYW_EXPORT),
   LEXER_KEYWORD ("import", LEXER_KEYW_IMPORT),
@@ -348,72 +388,47 @@ static const keyword_string_t keyword_length_6[9] =
   LEXER_KEYWORD ("static", LEXER_KEYW_STATIC),
   LEXER_KEYWORD ("switch", LEXER_KEYW_SWITCH),
   LEXER_KEYWORD ("typeof", LEXER_KEYW_TYPEOF),
-  LEXER_KEYWORD_END ()
-};
-
-/**
- * Keywords with 7 characters.
- */
-static const keyword_string_t keyword_length_7[6] =
-{
   LEXER_KEYWORD ("default", LEXER_KEYW_DEFAULT),
   LEXER_KEYWORD ("extends", LEXER_KEYW_EXTENDS),
   LEXER_KEYWORD ("finally", LEXER_KEYW_FINALLY),
   LEXER_KEYWORD ("package", LEXER_KEYW_PACKAGE),
   LEXER_KEYWORD ("private", LEXER_KEYW_PRIVATE),
-  LEXER_KEYWORD_END ()
-};
-
-/**
- * Keywords with 8 characters.
- */
-static const keyword_string_t keyword_length_8[4] =
-{
   LEXER_KEYWORD ("continue", LEXER_KEYW_CONTINUE),
   LEXER_KEYWORD ("debugger", LEXER_KEYW_DEBUGGER),
   LEXER_KEYWORD ("function", LEXER_KEYW_FUNCTION),
-  LEXER_KEYWORD_END ()
-};
-
-/**
- * Keywords with 9 characters.
- */
-static const keyword_string_t keyword_length_9[3] =
-{
   LEXER_KEYWORD ("interface", LEXER_KEYW_INTERFACE),
   LEXER_KEYWORD ("protected", LEXER_KEYW_PROTECTED),
-  LEXER_KEYWORD_END ()
+  LEXER_KEYWORD ("implements", LEXER_KEYW_IMPLEMENTS),
+  LEXER_KEYWORD ("instanceof", LEXER_KEYW_INSTANCEOF),
 };
 
+#undef LEXER_KEYWORD
+
 /**
- * Keywords with 10 characters.
+ * Perfect hash of the keywords (computed from the first, second and last characters
+ * and the length), which selects an entry of keyword_hash_table.
  */
-static const keyword_string_t keyword_length_10[3] =
-{
-  LEXER_KEYWORD ("implements", LEXER_KEYW_IMPLEMENTS),
-  LEXER_KEYWORD ("instanceof", LEXER_KEYW_INSTANCEOF),
-  LEXER_KEYWORD_END ()
-};
+#define LEXER_KEYWORD_HASH(ident_p, length) \
+  ((((uint32_t) (ident_p)[0] * 6) \
+    + ((uint32_t) (ident_p)[1] * 32) \
+    + ((uint32_t) (ident_p)[(length) - 1] * 18) \
+    + (uint32_t) (length)) & 0x7f)
 
 /**
- * List to the keywords.
+ * Index of the keyword in keyword_strings plus one for each hash value, zero for unused values.
  */
-static const keyword_string_t * const keyword_string_list[9] =
+static const uint8_t keyword_hash_table[128] =
 {
-  keyword_length_2,
-  keyword_length_3,
-  keyword_length_4,
-  keyword_length_5,
-  keyword_length_6,
-  keyword_length_7,
-  keyword_length_8,
-  keyword_length_9,
-  keyword_length_10
+   0, 38,  0, 25, 40,  0,  0,  0,  1,  0, 33,  0, 27, 36, 30,  0,
+   9,  0,  0,  0,  0,  6, 14, 17, 26,  0,  0, 23,  0,  0,  0,  0,
+   0,  0,  0, 21,  0,  0,  0, 34,  0,  0,  0,  0,  0,  0, 31,  0,
+  15,  0,  0,  0,  0,  0, 44,  0,  0,  0,  0,  0, 29,  0, 16,  0,
+   0,  0,  0,  0, 28,  0,  0, 18, 41,  0,  0,  4, 11,  0,  0,  0,
+  12,  0, 13,  5, 39,  0,  0,  0,  0, 42,  0, 22,  0,  0,  0, 20,
+   0, 37,  0,  0,  2,  0,  0,  0, 32, 24,  0,  8, 45, 19,  0,  0,
+   0, 43,  0,  0,  3,  0,  0,  0,  0,  0,  0, 35, 10,  7,  0,  0
 };
 
-#undef LEXER_KEYWORD
-#undef LEXER_KEYWORD_END
-
 /**
  * Parse identifier.
  */
@@ -488,9 +503,20 @@ lexer_parse_identifier (parser_context_t *context_p, /**< context */
       source_p++;
       length++;
     }
+
+    /* Fast path for ASCII identifier characters. */
+    while (source_p < source_end_p
+           && LEXER_CHAR_HAS_CLASS (source_p[0], LEXER_CHAR_IDENT_PART))
+    {
+      source_p++;
+      length++;
+      column++;
+    }
   }
   while (source_p < source_end_p
-         && (lit_char_is_identifier_part (source_p) || *source_p == LIT_CHAR_BACKSLASH));
+         && (LEXER_CHAR_HAS_CLASS (source_p[0], LEXER_CHAR_IDENT_PART)
+             || *source_p == LIT_CHAR_BACKSLASH
+             || (*source_p > LIT_UTF8_1_BYTE_CODE_POINT_MAX && lit_char_is_identifier_part (source_p))));
 
   context_p->source_p = ident_start_p;
   context_p->token.column = context_p->column;
@@ -505,12 +531,14 @@ lexer_parse_identifier (parser_context_t *context_p, /**< context */
       && !context_p->token.lit_location.has_escape
       && (length >= 2 && length <= 10))
   {
-    const keyword_string_t *keyword_p = keyword_string_list[length - 2];
+    uint32_t keyword_index = keyword_hash_table[LEXER_KEYWORD_HASH (ident_start_p, length)];
 
-    do
+    if (keyword_index > 0)
     {
-      if (ident_start_p[0] == keyword_p->keyword_p[0]
-          && ident_start_p[1] == keyword_p->keyword_p[1]
+      const keyword_string_t *keyword_p = keyword_strings + keyword_index - 1;
+
+      /* The lengths are compared first, since memcmp must not read past the end of the keyword. */
+      if (keyword_p->length == length
           && memcmp (ident_start_p, keyword_p->keyword_p, length) == 0)
       {
         if (keyword_p->type >= LEXER_FIRST_FUTURE_STRICT_RESERVED_WORD)
@@ -521,15 +549,13 @@ lexer_parse_identifier (parser_context_t *context_p, /**< context */
           }
 
           context_p->token.literal_is_reserved = true;
-          break;
         }
-
-        context_p->token.type = keyword_p->type;
-        break;
+        else
+        {
+          context_p->token.type = keyword_p->type;
+        }
       }
-      keyword_p++;
     }
-    while (keyword_p->type != LEXER_EOS);
   }
 
   if (context_p->token.type == LEXER_LITERAL)
@@ -984,8 +1010,7 @@ lexer_next_token (parser_context_t *context_p) /**< context */
     return;
   }
 
-  if (lit_char_is_identifier_start (context_p->source_p)
-      || context_p->source_p[0] == LIT_CHAR_BACKSLASH)
+  if (LEXER_IS_IDENT_OR_ESCAPE_START (context_p->source_p))
   {
     lexer_parse_identifier (context_p, true);
     return;
@@ -1521,10 +1546,7 @@ lexer_construct_number_object (parser_context_t *context_p, /**< context */
                                bool push_number_allowed, /**< push number support is allowed */
                                bool is_negative_number) /**< sign is negative */
 {
-  parser_list_iterator_t literal_iterator;
-  lexer_literal_t *literal_p;
   ecma_number_t num;
-  uint32_t literal_index = 0;
   uint16_t length = context_p->token.lit_location.length;
 
   if (context_p->token.extra_value != LEXER_NUMBER_OCTAL)
@@ -1566,6 +1588,21 @@ lexer_construct_number_object (parser_context_t *context_p, /**< context */
     num = -num;
   }
 
+  lexer_construct_number_literal (context_p, num);
+  return false;
+} /* lexer_construct_number_object */
+
+/**
+ * Construct a number literal object from a number value.
+ */
+void
+lexer_construct_number_literal (parser_context_t *context_p, /**< context */
+                                ecma_number_t num) /**< number value */
+{
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+  uint32_t literal_index = 0;
+
   jmem_cpointer_t lit_cp = ecma_find_or_create_literal_number (num);
   parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
 
@@ -1576,7 +1613,8 @@ lexer_construct_number_object (parser_context_t *context_p, /**< context */
     {
       context_p->lit_object.literal_p = literal_p;
       context_p->lit_object.index = (uint16_t) literal_index;
-      return false;
+      context_p->lit_object.type = LEXER_LITERAL_OBJECT_ANY;
+      return;
     }
 
     literal_index++;
@@ -1590,7 +1628,7 @@ lexer_construct_number_object (parser_context_t *context_p, /**< context */
   }
 
   literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
-  literal_p->prop.length = context_p->token.lit_location.length;
+  literal_p->prop.length = 0;
   literal_p->type = LEXER_UNUSED_LITERAL;
   literal_p->status_flags = 0;
 
@@ -1602,9 +1640,21 @@ lexer_construct_number_object (parser_context_t *context_p, /**< context */
   context_p->lit_object.literal_p = literal_p;
   context_p->lit_object.index = (uint16_t) literal_index;
   context_p->lit_object.type = LEXER_LITERAL_OBJECT_ANY;
+} /* lexer_construct_number_literal */
 
-  return false;
-} /* lexer_construct_number_object */
+/**
+ * Construct a string literal object from a character sequence which
+ * is not part of the source code (e.g. the result of constant folding).
+ */
+void
+lexer_construct_string_literal (parser_context_t *context_p, /**< context */
+                                const uint8_t *char_p, /**< characters */
+                                size_t length) /**< length of the string */
+{
+  /* The characters are copied since the buffer is not persistent. */
+  lexer_process_char_literal (context_p, char_p, length, LEXER_STRING_LITERAL, true);
+  context_p->lit_object.type = LEXER_LITERAL_OBJECT_ANY;
+} /* lexer_construct_string_literal */
 
 /**
  * Construct a function literal object.
@@ -1636,6 +1686,7 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
 
   compiled_code_p = parser_parse_function (context_p, extra_status_flags);
 
+  /* The byte code is NULL when the function is nested into a pre-parsed function. */
   literal_p->u.bytecode_p = compiled_code_p;
 
   literal_p->type = LEXER_FUNCTION_LITERAL;
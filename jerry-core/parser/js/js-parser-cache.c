@@ -0,0 +1,251 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jmem-heap.h"
+#include "lit-strings.h"
+#include "js-parser.h"
+#include "js-parser-cache.h"
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup jsparser JavaScript
+ * @{
+ *
+ * \addtogroup jsparser_cache Compiled code cache
+ * @{
+ */
+
+/**
+ * Initialize the compiled code cache
+ */
+void
+parser_cache_init (void)
+{
+  JERRY_CONTEXT (parser_cache_p) = NULL;
+  JERRY_CONTEXT (parser_cache_count) = 0;
+} /* parser_cache_init */
+
+/**
+ * Release the byte code and the source string of a cache entry
+ */
+static void
+parser_cache_free_entry (parser_cache_entry_t *entry_p) /**< cache entry */
+{
+  ecma_bytecode_deref (ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, entry_p->bytecode_cp));
+  ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, entry_p->source_cp));
+} /* parser_cache_free_entry */
+
+/**
+ * Release all entries and the memory block of the compiled code cache
+ */
+void
+parser_cache_finalize (void)
+{
+  parser_cache_entry_t *entries_p = JERRY_CONTEXT (parser_cache_p);
+
+  if (entries_p == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < JERRY_CONTEXT (parser_cache_count); i++)
+  {
+    parser_cache_free_entry (entries_p + i);
+  }
+
+  jmem_heap_free_block (entries_p, CONFIG_PARSER_CACHE_SIZE * sizeof (parser_cache_entry_t));
+  parser_cache_init ();
+} /* parser_cache_finalize */
+
+/**
+ * Drop the entries whose byte code is referenced only by the cache
+ *
+ * Called when the engine runs out of memory.
+ */
+void
+parser_cache_free_unused (void)
+{
+  parser_cache_entry_t *entries_p = JERRY_CONTEXT (parser_cache_p);
+  uint32_t count = 0;
+
+  for (uint32_t i = 0; i < JERRY_CONTEXT (parser_cache_count); i++)
+  {
+    ecma_compiled_code_t *bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
+                                                                  entries_p[i].bytecode_cp);
+
+    if (bytecode_p->refs == 1)
+    {
+      parser_cache_free_entry (entries_p + i);
+    }
+    else
+    {
+      entries_p[count++] = entries_p[i];
+    }
+  }
+
+  JERRY_CONTEXT (parser_cache_count) = count;
+
+  if (count == 0 && entries_p != NULL)
+  {
+    jmem_heap_free_block (entries_p, CONFIG_PARSER_CACHE_SIZE * sizeof (parser_cache_entry_t));
+    JERRY_CONTEXT (parser_cache_p) = NULL;
+  }
+} /* parser_cache_free_unused */
+
+/**
+ * Search the byte code of a source string in the cache and move the
+ * entry to the front of the cache if it is found
+ *
+ * @return referenced byte code - if found
+ *         NULL - otherwise
+ */
+static ecma_compiled_code_t *
+parser_cache_lookup (ecma_string_t *source_str_p, /**< source code string */
+                     uint16_t flags) /**< PARSER_CACHE_* options */
+{
+  parser_cache_entry_t *entries_p = JERRY_CONTEXT (parser_cache_p);
+
+  for (uint32_t i = 0; i < JERRY_CONTEXT (parser_cache_count); i++)
+  {
+    parser_cache_entry_t entry = entries_p[i];
+
+    if (entry.flags != flags
+        || !ecma_compare_ecma_strings (ECMA_GET_NON_NULL_POINTER (ecma_string_t, entry.source_cp), source_str_p))
+    {
+      continue;
+    }
+
+    memmove (entries_p + 1, entries_p, i * sizeof (parser_cache_entry_t));
+    entries_p[0] = entry;
+
+    ecma_compiled_code_t *bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, entry.bytecode_cp);
+    ecma_bytecode_ref (bytecode_p);
+    return bytecode_p;
+  }
+
+  return NULL;
+} /* parser_cache_lookup */
+
+/**
+ * Insert a byte code to the front of the cache, the least recently
+ * used entry is dropped if the cache is full
+ */
+static void
+parser_cache_insert (ecma_string_t *source_str_p, /**< source code string */
+                     uint16_t flags, /**< PARSER_CACHE_* options */
+                     ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  parser_cache_entry_t *entries_p = JERRY_CONTEXT (parser_cache_p);
+
+  if (entries_p == NULL)
+  {
+    size_t size = CONFIG_PARSER_CACHE_SIZE * sizeof (parser_cache_entry_t);
+    entries_p = (parser_cache_entry_t *) jmem_heap_alloc_block_null_on_error (size);
+
+    if (entries_p == NULL)
+    {
+      return;
+    }
+
+    JERRY_CONTEXT (parser_cache_p) = entries_p;
+  }
+
+  uint32_t count = JERRY_CONTEXT (parser_cache_count);
+
+  if (count == CONFIG_PARSER_CACHE_SIZE)
+  {
+    count--;
+    parser_cache_free_entry (entries_p + count);
+  }
+
+  memmove (entries_p + 1, entries_p, count * sizeof (parser_cache_entry_t));
+
+  ecma_bytecode_ref (bytecode_p);
+  ecma_ref_ecma_string (source_str_p);
+
+  ECMA_SET_NON_NULL_POINTER (entries_p[0].bytecode_cp, bytecode_p);
+  ECMA_SET_NON_NULL_POINTER (entries_p[0].source_cp, source_str_p);
+  entries_p[0].flags = flags;
+
+  JERRY_CONTEXT (parser_cache_count) = count + 1;
+} /* parser_cache_insert */
+
+/**
+ * Parse EcmaScript source code, reusing the byte code of an earlier
+ * parse of the same source when it is still in the cache
+ *
+ * Note:
+ *      returned value must be freed with ecma_free_value
+ *
+ * @return true - if success
+ *         syntax error - otherwise
+ */
+ecma_value_t
+parser_cache_parse_script (const uint8_t *source_p, /**< source code */
+                           size_t size, /**< size of the source code */
+                           ecma_string_t *source_str_p, /**< source code as string if available, NULL otherwise */
+                           bool is_strict, /**< strict mode */
+                           ecma_compiled_code_t **bytecode_data_p) /**< [out] JS bytecode */
+{
+  if (CONFIG_PARSER_CACHE_SIZE == 0
+      || size > CONFIG_PARSER_CACHE_MAX_SOURCE_SIZE
+      || (source_str_p == NULL && !lit_is_cesu8_string_valid (source_p, (lit_utf8_size_t) size)))
+  {
+    /* Sources which cannot be represented as strings (e.g. four byte long UTF-8 sequences) are not cached. */
+    return parser_parse_script (source_p, size, is_strict, false, bytecode_data_p);
+  }
+
+  uint16_t flags = is_strict ? PARSER_CACHE_STRICT_MODE : 0;
+
+  if (source_str_p != NULL)
+  {
+    ecma_ref_ecma_string (source_str_p);
+  }
+  else
+  {
+    source_str_p = ecma_new_ecma_string_from_utf8 (source_p, (lit_utf8_size_t) size);
+  }
+
+  ecma_value_t parse_status;
+
+  *bytecode_data_p = parser_cache_lookup (source_str_p, flags);
+
+  if (*bytecode_data_p != NULL)
+  {
+    parse_status = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+  else
+  {
+    parse_status = parser_parse_script (source_p, size, is_strict, false, bytecode_data_p);
+
+    if (!ECMA_IS_VALUE_ERROR (parse_status))
+    {
+      parser_cache_insert (source_str_p, flags, *bytecode_data_p);
+    }
+  }
+
+  ecma_deref_ecma_string (source_str_p);
+  return parse_status;
+} /* parser_cache_parse_script */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
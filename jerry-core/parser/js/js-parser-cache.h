@@ -0,0 +1,60 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JS_PARSER_CACHE_H
+#define JS_PARSER_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup jsparser JavaScript
+ * @{
+ *
+ * \addtogroup jsparser_cache Compiled code cache
+ * @{
+ */
+
+/**
+ * The cached byte code was compiled in strict mode
+ */
+#define PARSER_CACHE_STRICT_MODE 0x1u
+
+/**
+ * Entry of the compiled code cache
+ *
+ * The entries are kept in most recently used first order.
+ */
+typedef struct
+{
+  jmem_cpointer_t bytecode_cp; /**< cached byte code */
+  jmem_cpointer_t source_cp; /**< source code string (key of the entry) */
+  uint16_t flags; /**< PARSER_CACHE_* options the byte code was compiled with */
+} parser_cache_entry_t;
+
+void parser_cache_init (void);
+void parser_cache_finalize (void);
+void parser_cache_free_unused (void);
+ecma_value_t parser_cache_parse_script (const uint8_t *, size_t, ecma_string_t *, bool, ecma_compiled_code_t **);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !JS_PARSER_CACHE_H */
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "ecma-helpers.h"
+#include "ecma-number-arithmetic.h"
 #include "js-parser-internal.h"
 
 /** \addtogroup parser Parser
@@ -601,6 +603,13 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
         status_flags |= PARSER_RESOLVE_THIS_FOR_CALLS;
       }
 
+      /* Bracketed function expressions are usually called immediately,
+       * so compiling them lazily would only parse them twice. */
+      if (context_p->stack_top_uint8 == LEXER_LEFT_PAREN)
+      {
+        status_flags |= PARSER_NO_LAZY_COMPILE;
+      }
+
       lexer_construct_function_object (context_p, status_flags);
 
       JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
@@ -694,6 +703,660 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
   lexer_next_token (context_p);
 } /* parser_parse_unary_expression */
 
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+
+/**
+ * Type of a constant value known at parse time.
+ */
+typedef enum
+{
+  PARSER_CONSTANT_NUMBER,                     /**< number value */
+  PARSER_CONSTANT_STRING,                     /**< string value */
+  PARSER_CONSTANT_BOOLEAN,                    /**< boolean value */
+} parser_constant_type_t;
+
+/**
+ * Constant value known at parse time.
+ */
+typedef struct
+{
+  parser_constant_type_t type;                /**< type of the value */
+  ecma_number_t number;                       /**< number value */
+  lexer_literal_t *literal_p;                 /**< string literal */
+  bool boolean;                               /**< boolean value */
+} parser_constant_t;
+
+/**
+ * Get the value pushed by an instruction if it is a constant.
+ *
+ * @return true - if the value is a constant
+ *         false - otherwise
+ */
+static bool
+parser_get_constant (parser_context_t *context_p, /**< context */
+                     uint16_t opcode, /**< opcode which pushes the value */
+                     uint16_t value, /**< literal index or number argument */
+                     parser_constant_t *constant_p) /**< [out] constant value */
+{
+  switch (opcode)
+  {
+    case CBC_PUSH_TRUE:
+    case CBC_PUSH_FALSE:
+    {
+      constant_p->type = PARSER_CONSTANT_BOOLEAN;
+      constant_p->boolean = (opcode == CBC_PUSH_TRUE);
+      return true;
+    }
+    case CBC_PUSH_NUMBER_0:
+    {
+      constant_p->type = PARSER_CONSTANT_NUMBER;
+      constant_p->number = ECMA_NUMBER_ZERO;
+      return true;
+    }
+    case CBC_PUSH_NUMBER_POS_BYTE:
+    case CBC_PUSH_NUMBER_NEG_BYTE:
+    {
+      constant_p->type = PARSER_CONSTANT_NUMBER;
+      constant_p->number = (ecma_number_t) value;
+
+      if (opcode == CBC_PUSH_NUMBER_NEG_BYTE)
+      {
+        constant_p->number = -constant_p->number;
+      }
+      return true;
+    }
+    case CBC_PUSH_LITERAL:
+    {
+      lexer_literal_t *literal_p = PARSER_GET_LITERAL (value);
+
+      if (literal_p->type == LEXER_NUMBER_LITERAL)
+      {
+        ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, literal_p->u.value);
+
+        JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (value_p) == ECMA_STRING_LITERAL_NUMBER);
+
+        constant_p->type = PARSER_CONSTANT_NUMBER;
+        constant_p->number = ecma_get_number_from_value (value_p->u.lit_number);
+        return true;
+      }
+
+      if (literal_p->type == LEXER_STRING_LITERAL)
+      {
+        constant_p->type = PARSER_CONSTANT_STRING;
+        constant_p->literal_p = literal_p;
+        return true;
+      }
+      return false;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* parser_get_constant */
+
+/**
+ * Get the constant values on the top of the stack.
+ *
+ * @return true - if the topmost count values are all constants
+ *         false - otherwise
+ */
+static bool
+parser_get_constant_operands (parser_context_t *context_p, /**< context */
+                              uint32_t count, /**< number of values (one or two) */
+                              parser_constant_t *operands_p) /**< [out] values, the topmost is the first */
+{
+  uint16_t opcodes[2];
+  uint16_t values[2];
+  uint32_t found = 0;
+
+  JERRY_ASSERT (count == 1 || count == 2);
+
+  switch (context_p->last_cbc_opcode)
+  {
+    case CBC_PUSH_THREE_LITERALS:
+    {
+      opcodes[0] = CBC_PUSH_LITERAL;
+      values[0] = context_p->last_cbc.third_literal_index;
+      opcodes[1] = CBC_PUSH_LITERAL;
+      values[1] = context_p->last_cbc.value;
+      found = 2;
+      break;
+    }
+    case CBC_PUSH_TWO_LITERALS:
+    {
+      opcodes[0] = CBC_PUSH_LITERAL;
+      values[0] = context_p->last_cbc.value;
+      opcodes[1] = CBC_PUSH_LITERAL;
+      values[1] = context_p->last_cbc.literal_index;
+      found = 2;
+      break;
+    }
+    case CBC_PUSH_LITERAL:
+    case CBC_PUSH_TRUE:
+    case CBC_PUSH_FALSE:
+    case CBC_PUSH_NUMBER_0:
+    {
+      opcodes[0] = context_p->last_cbc_opcode;
+      values[0] = context_p->last_cbc.literal_index;
+      found = 1;
+      break;
+    }
+    case PARSER_CBC_UNAVAILABLE:
+    {
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  if (found < count)
+  {
+    /* The remaining values are pushed by already emitted instructions. */
+    uint32_t recorded = parser_count_pushed_constants (context_p);
+
+    for (uint32_t i = 1; i <= recorded && found < count; i++)
+    {
+      const parser_pushed_constant_t *constant_p;
+      constant_p = context_p->pushed_constants + context_p->pushed_constant_count - i;
+
+      opcodes[found] = constant_p->opcode;
+      values[found] = constant_p->value;
+      found++;
+    }
+
+    if (found < count)
+    {
+      return false;
+    }
+  }
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    if (!parser_get_constant (context_p, opcodes[i], values[i], operands_p + i))
+    {
+      return false;
+    }
+  }
+  return true;
+} /* parser_get_constant_operands */
+
+/**
+ * Remove the instructions which push the topmost constant values.
+ */
+static void
+parser_remove_constant_operands (parser_context_t *context_p, /**< context */
+                                 uint32_t count) /**< number of values */
+{
+  switch (context_p->last_cbc_opcode)
+  {
+    case CBC_PUSH_THREE_LITERALS:
+    {
+      context_p->last_cbc_opcode = (count == 1) ? CBC_PUSH_TWO_LITERALS : CBC_PUSH_LITERAL;
+      return;
+    }
+    case CBC_PUSH_TWO_LITERALS:
+    {
+      context_p->last_cbc_opcode = (count == 1) ? CBC_PUSH_LITERAL : PARSER_CBC_UNAVAILABLE;
+      return;
+    }
+    case PARSER_CBC_UNAVAILABLE:
+    {
+      break;
+    }
+    default:
+    {
+      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+      count--;
+      break;
+    }
+  }
+
+  if (count > 0)
+  {
+    parser_remove_pushed_constants (context_p, count);
+  }
+} /* parser_remove_constant_operands */
+
+/**
+ * Emit an instruction which pushes a literal created by constant folding.
+ */
+static void
+parser_emit_constant_literal (parser_context_t *context_p, /**< context */
+                              uint8_t literal_type) /**< literal type */
+{
+  if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
+  {
+    context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
+    context_p->last_cbc.value = context_p->lit_object.index;
+  }
+  else if (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS)
+  {
+    context_p->last_cbc_opcode = CBC_PUSH_THREE_LITERALS;
+    context_p->last_cbc.third_literal_index = context_p->lit_object.index;
+  }
+  else
+  {
+    parser_emit_cbc_literal (context_p, CBC_PUSH_LITERAL, context_p->lit_object.index);
+  }
+
+  context_p->last_cbc.literal_type = literal_type;
+  context_p->last_cbc.literal_object_type = LEXER_LITERAL_OBJECT_ANY;
+} /* parser_emit_constant_literal */
+
+/**
+ * Emit an instruction which pushes a boolean or number constant.
+ */
+static void
+parser_emit_constant (parser_context_t *context_p, /**< context */
+                      const parser_constant_t *constant_p) /**< constant value */
+{
+  if (constant_p->type == PARSER_CONSTANT_BOOLEAN)
+  {
+    parser_emit_cbc (context_p, constant_p->boolean ? CBC_PUSH_TRUE : CBC_PUSH_FALSE);
+    return;
+  }
+
+  JERRY_ASSERT (constant_p->type == PARSER_CONSTANT_NUMBER);
+
+  ecma_number_t num = constant_p->number;
+
+  if (num >= -CBC_PUSH_NUMBER_BYTE_RANGE_END
+      && num <= CBC_PUSH_NUMBER_BYTE_RANGE_END
+      && (ecma_number_t) (int32_t) num == num
+      && !(ecma_number_is_zero (num) && ecma_number_is_negative (num)))
+  {
+    int32_t int_num = (int32_t) num;
+
+    if (int_num == 0)
+    {
+      parser_emit_cbc (context_p, CBC_PUSH_NUMBER_0);
+      return;
+    }
+
+    context_p->lit_object.index = (uint16_t) ((int_num < 0) ? -int_num : int_num);
+    parser_emit_cbc_push_number (context_p, int_num < 0);
+    return;
+  }
+
+  lexer_construct_number_literal (context_p, num);
+  parser_emit_constant_literal (context_p, LEXER_NUMBER_LITERAL);
+} /* parser_emit_constant */
+
+/**
+ * Convert a constant value to boolean.
+ *
+ * @return boolean value
+ */
+static bool
+parser_constant_to_boolean (const parser_constant_t *constant_p) /**< constant value */
+{
+  switch (constant_p->type)
+  {
+    case PARSER_CONSTANT_BOOLEAN:
+    {
+      return constant_p->boolean;
+    }
+    case PARSER_CONSTANT_STRING:
+    {
+      return constant_p->literal_p->prop.length != 0;
+    }
+    default:
+    {
+      JERRY_ASSERT (constant_p->type == PARSER_CONSTANT_NUMBER);
+      return !ecma_number_is_nan (constant_p->number) && !ecma_number_is_zero (constant_p->number);
+    }
+  }
+} /* parser_constant_to_boolean */
+
+/**
+ * Compute the result of an equality or relational operator.
+ *
+ * @return true - if the result is computed
+ *         false - otherwise
+ */
+static bool
+parser_fold_comparison (cbc_opcode_t opcode, /**< binary opcode */
+                        const parser_constant_t *left_p, /**< left operand */
+                        const parser_constant_t *right_p, /**< right operand */
+                        parser_constant_t *result_p) /**< [out] result */
+{
+  bool is_equal;
+
+  switch (left_p->type)
+  {
+    case PARSER_CONSTANT_NUMBER:
+    {
+      ecma_number_t left_num = left_p->number;
+      ecma_number_t right_num = right_p->number;
+
+      switch (opcode)
+      {
+        case CBC_LESS:
+        {
+          result_p->boolean = left_num < right_num;
+          break;
+        }
+        case CBC_GREATER:
+        {
+          result_p->boolean = left_num > right_num;
+          break;
+        }
+        case CBC_LESS_EQUAL:
+        {
+          result_p->boolean = left_num <= right_num;
+          break;
+        }
+        case CBC_GREATER_EQUAL:
+        {
+          result_p->boolean = left_num >= right_num;
+          break;
+        }
+        default:
+        {
+          result_p->boolean = false;
+          break;
+        }
+      }
+
+      is_equal = (left_num == right_num);
+      break;
+    }
+    case PARSER_CONSTANT_STRING:
+    {
+      const lexer_literal_t *left_literal_p = left_p->literal_p;
+      const lexer_literal_t *right_literal_p = right_p->literal_p;
+
+      is_equal = (left_literal_p->prop.length == right_literal_p->prop.length
+                  && memcmp (left_literal_p->u.char_p, right_literal_p->u.char_p, left_literal_p->prop.length) == 0);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (left_p->type == PARSER_CONSTANT_BOOLEAN);
+      is_equal = (left_p->boolean == right_p->boolean);
+      break;
+    }
+  }
+
+  switch (opcode)
+  {
+    case CBC_EQUAL:
+    case CBC_STRICT_EQUAL:
+    {
+      result_p->boolean = is_equal;
+      break;
+    }
+    case CBC_NOT_EQUAL:
+    case CBC_STRICT_NOT_EQUAL:
+    {
+      result_p->boolean = !is_equal;
+      break;
+    }
+    default:
+    {
+      /* Strings are compared by code units, which is not done here. */
+      if (left_p->type != PARSER_CONSTANT_NUMBER)
+      {
+        return false;
+      }
+      break;
+    }
+  }
+
+  result_p->type = PARSER_CONSTANT_BOOLEAN;
+  return true;
+} /* parser_fold_comparison */
+
+/**
+ * Compute the result of an arithmetic or bitwise operator with number operands.
+ *
+ * @return true - if the result is computed
+ *         false - otherwise
+ */
+static bool
+parser_fold_number_operation (cbc_opcode_t opcode, /**< binary opcode */
+                              ecma_number_t left_num, /**< left operand */
+                              ecma_number_t right_num, /**< right operand */
+                              parser_constant_t *result_p) /**< [out] result */
+{
+  ecma_number_t result;
+  uint32_t shift_count = ecma_number_to_uint32 (right_num) & 0x1f;
+
+  switch (opcode)
+  {
+    case CBC_ADD:
+    {
+      result = ecma_number_add (left_num, right_num);
+      break;
+    }
+    case CBC_SUBTRACT:
+    {
+      result = ecma_number_substract (left_num, right_num);
+      break;
+    }
+    case CBC_MULTIPLY:
+    {
+      result = ecma_number_multiply (left_num, right_num);
+      break;
+    }
+    case CBC_DIVIDE:
+    {
+      result = ecma_number_divide (left_num, right_num);
+      break;
+    }
+    case CBC_MODULO:
+    {
+      result = ecma_op_number_remainder (left_num, right_num);
+      break;
+    }
+    case CBC_BIT_OR:
+    {
+      result = (ecma_number_t) ((int32_t) (ecma_number_to_uint32 (left_num) | ecma_number_to_uint32 (right_num)));
+      break;
+    }
+    case CBC_BIT_XOR:
+    {
+      result = (ecma_number_t) ((int32_t) (ecma_number_to_uint32 (left_num) ^ ecma_number_to_uint32 (right_num)));
+      break;
+    }
+    case CBC_BIT_AND:
+    {
+      result = (ecma_number_t) ((int32_t) (ecma_number_to_uint32 (left_num) & ecma_number_to_uint32 (right_num)));
+      break;
+    }
+    case CBC_LEFT_SHIFT:
+    {
+      result = (ecma_number_t) ((int32_t) (ecma_number_to_uint32 (left_num) << shift_count));
+      break;
+    }
+    case CBC_RIGHT_SHIFT:
+    {
+      result = (ecma_number_t) (ecma_number_to_int32 (left_num) >> shift_count);
+      break;
+    }
+    case CBC_UNS_RIGHT_SHIFT:
+    {
+      result = (ecma_number_t) (ecma_number_to_uint32 (left_num) >> shift_count);
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  if (ecma_number_is_nan (result))
+  {
+    return false;
+  }
+
+  result_p->type = PARSER_CONSTANT_NUMBER;
+  result_p->number = result;
+  return true;
+} /* parser_fold_number_operation */
+
+/**
+ * Replace a binary operation with constant operands by its result.
+ *
+ * @return true - if the operation is folded
+ *         false - otherwise
+ */
+static bool
+parser_fold_binary_operation (parser_context_t *context_p, /**< context */
+                              cbc_opcode_t opcode) /**< binary opcode */
+{
+  parser_constant_t operands[2];
+  parser_constant_t result;
+
+  if (opcode == CBC_IN
+      || opcode == CBC_INSTANCEOF
+      || !parser_get_constant_operands (context_p, 2, operands)
+      || operands[0].type != operands[1].type)
+  {
+    return false;
+  }
+
+  const parser_constant_t *left_p = operands + 1;
+  const parser_constant_t *right_p = operands + 0;
+
+  if (opcode >= CBC_EQUAL && opcode <= CBC_GREATER_EQUAL)
+  {
+    if (!parser_fold_comparison (opcode, left_p, right_p, &result))
+    {
+      return false;
+    }
+
+    parser_remove_constant_operands (context_p, 2);
+  }
+  else if (left_p->type == PARSER_CONSTANT_NUMBER)
+  {
+    if (!parser_fold_number_operation (opcode, left_p->number, right_p->number, &result))
+    {
+      return false;
+    }
+
+    parser_remove_constant_operands (context_p, 2);
+  }
+  else if (left_p->type == PARSER_CONSTANT_STRING && opcode == CBC_ADD)
+  {
+    uint8_t buffer[PARSER_MAXIMUM_FOLDED_STRING_LENGTH];
+    size_t left_length = left_p->literal_p->prop.length;
+    size_t right_length = right_p->literal_p->prop.length;
+
+    if (left_length + right_length > PARSER_MAXIMUM_FOLDED_STRING_LENGTH)
+    {
+      return false;
+    }
+
+    memcpy (buffer, left_p->literal_p->u.char_p, left_length);
+    memcpy (buffer + left_length, right_p->literal_p->u.char_p, right_length);
+
+    parser_remove_constant_operands (context_p, 2);
+
+    lexer_construct_string_literal (context_p, buffer, left_length + right_length);
+    parser_emit_constant_literal (context_p, LEXER_STRING_LITERAL);
+
+#ifdef PARSER_DUMP_BYTE_CODE
+    if (context_p->is_show_opcodes)
+    {
+      JERRY_DEBUG_MSG ("  Constant folding saved 2 instructions\n");
+    }
+#endif /* PARSER_DUMP_BYTE_CODE */
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+
+  parser_emit_constant (context_p, &result);
+
+#ifdef PARSER_DUMP_BYTE_CODE
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("  Constant folding saved 2 instructions\n");
+  }
+#endif /* PARSER_DUMP_BYTE_CODE */
+  return true;
+} /* parser_fold_binary_operation */
+
+/**
+ * Replace a unary operation with a constant operand by its result.
+ *
+ * @return true - if the operation is folded
+ *         false - otherwise
+ */
+static bool
+parser_fold_unary_operation (parser_context_t *context_p, /**< context */
+                             cbc_opcode_t opcode) /**< unary opcode */
+{
+  parser_constant_t operand;
+  parser_constant_t result;
+
+  if (!parser_get_constant_operands (context_p, 1, &operand))
+  {
+    return false;
+  }
+
+  if (opcode == CBC_LOGICAL_NOT)
+  {
+    result.type = PARSER_CONSTANT_BOOLEAN;
+    result.boolean = !parser_constant_to_boolean (&operand);
+  }
+  else if (operand.type == PARSER_CONSTANT_NUMBER)
+  {
+    result.type = PARSER_CONSTANT_NUMBER;
+
+    switch (opcode)
+    {
+      case CBC_PLUS:
+      {
+        result.number = operand.number;
+        break;
+      }
+      case CBC_NEGATE:
+      {
+        result.number = ecma_number_negate (operand.number);
+        break;
+      }
+      case CBC_BIT_NOT:
+      {
+        result.number = (ecma_number_t) (~ecma_number_to_int32 (operand.number));
+        break;
+      }
+      default:
+      {
+        return false;
+      }
+    }
+
+    if (ecma_number_is_nan (result.number))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    return false;
+  }
+
+  parser_remove_constant_operands (context_p, 1);
+  parser_emit_constant (context_p, &result);
+
+#ifdef PARSER_DUMP_BYTE_CODE
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("  Constant folding saved 1 instruction\n");
+  }
+#endif /* PARSER_DUMP_BYTE_CODE */
+  return true;
+} /* parser_fold_unary_operation */
+
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
 /**
  * Parse the postfix part of unary operators, and
  * generate byte code for the whole expression.
@@ -1018,6 +1681,13 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
       }
       else
       {
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+        if (parser_fold_unary_operation (context_p, (cbc_opcode_t) token))
+        {
+          continue;
+        }
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
         if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
         {
           /* It is not worth to combine with push multiple literals
@@ -1319,6 +1989,13 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
     {
       opcode = LEXER_BINARY_OP_TOKEN_TO_OPCODE (token);
 
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+      if (parser_fold_binary_operation (context_p, opcode))
+      {
+        continue;
+      }
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
       if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
       {
         JERRY_ASSERT (CBC_SAME_ARGS (context_p->last_cbc_opcode, opcode + CBC_BINARY_WITH_LITERAL));
@@ -1524,6 +2201,87 @@ parser_parse_expression (parser_context_t *context_p, /**< context */
   }
 } /* parser_parse_expression */
 
+/**
+ * Check whether the value of the last parsed expression is known at parse time.
+ * The byte code which pushes the value is removed when the value is known.
+ *
+ * @return PARSER_CONDITION_TRUE or PARSER_CONDITION_FALSE - if the boolean value is known
+ *         PARSER_CONDITION_UNKNOWN - otherwise
+ */
+parser_condition_t
+parser_check_constant_condition (parser_context_t *context_p) /**< context */
+{
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+  parser_constant_t operand;
+
+  if (parser_get_constant_operands (context_p, 1, &operand))
+  {
+    parser_remove_constant_operands (context_p, 1);
+    return parser_constant_to_boolean (&operand) ? PARSER_CONDITION_TRUE : PARSER_CONDITION_FALSE;
+  }
+#else /* !CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+  JERRY_UNUSED (context_p);
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
+  return PARSER_CONDITION_UNKNOWN;
+} /* parser_check_constant_condition */
+
+/**
+ * Check whether the last parsed case expression of a switch statement is
+ * a constant which can be used as a key of a jump table. The expression
+ * must be compiled to a single instruction, since the other instructions
+ * may have side effects.
+ *
+ * @return PARSER_SWITCH_KEY_INTEGER - if the value is an integer (stored into key_p)
+ *         PARSER_SWITCH_KEY_STRING - if the value is a string (its literal index is stored into key_p)
+ *         PARSER_SWITCH_KEY_NONE - otherwise
+ */
+parser_switch_key_t
+parser_get_switch_key (parser_context_t *context_p, /**< context */
+                       uint32_t start_offset, /**< byte code size before the case expression */
+                       uint32_t *key_p) /**< [out] key value */
+{
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+  const parser_pushed_constant_t *pushed_constant_p;
+  parser_constant_t constant;
+
+  parser_flush_cbc (context_p);
+  pushed_constant_p = parser_get_pushed_constant (context_p, start_offset);
+
+  if (pushed_constant_p == NULL
+      || !parser_get_constant (context_p, pushed_constant_p->opcode, pushed_constant_p->value, &constant))
+  {
+    return PARSER_SWITCH_KEY_NONE;
+  }
+
+  if (constant.type == PARSER_CONSTANT_STRING)
+  {
+    *key_p = pushed_constant_p->value;
+    return PARSER_SWITCH_KEY_STRING;
+  }
+
+  if (constant.type == PARSER_CONSTANT_NUMBER
+      && constant.number >= ECMA_INTEGER_NUMBER_MIN
+      && constant.number <= ECMA_INTEGER_NUMBER_MAX)
+  {
+    ecma_integer_value_t integer = (ecma_integer_value_t) constant.number;
+
+    /* Negative zero is also accepted, since it is strictly equal to zero. */
+    if ((ecma_number_t) integer == constant.number)
+    {
+      *key_p = (uint32_t) integer;
+      return PARSER_SWITCH_KEY_INTEGER;
+    }
+  }
+#else /* !CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+  JERRY_UNUSED (context_p);
+  JERRY_UNUSED (start_offset);
+  JERRY_UNUSED (key_p);
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
+  return PARSER_SWITCH_KEY_NONE;
+} /* parser_get_switch_key */
+
 /**
  * @}
  * @}
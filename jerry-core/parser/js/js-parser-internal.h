@@ -52,6 +52,9 @@
 #define PARSER_ARGUMENTS_NOT_NEEDED           0x04000u
 #define PARSER_LEXICAL_ENV_NEEDED             0x08000u
 #define PARSER_HAS_LATE_LIT_INIT              0x10000u
+#define PARSER_LAZY_FUNCTIONS                 0x20000u
+#define PARSER_PRE_PARSE                      0x40000u
+#define PARSER_NO_LAZY_COMPILE                0x80000u
 
 /* Expression parsing flags. */
 #define PARSE_EXPR                            0x00
@@ -67,6 +70,9 @@
 #define PARSER_STACK_PAGE_SIZE \
   ((uint32_t) (((sizeof (void *) > 4) ? 128 : 64) - sizeof (void *)))
 
+/* Usable size of the memory blocks allocated by the parser arena (a multiple of the page sizes). */
+#define PARSER_ARENA_CHUNK_SIZE 1024
+
 /* Avoid compiler warnings for += operations. */
 #define PARSER_PLUS_EQUAL_U16(base, value) (base) = (uint16_t) ((base) + (value))
 #define PARSER_MINUS_EQUAL_U16(base, value) (base) = (uint16_t) ((base) - (value))
@@ -191,6 +197,54 @@ typedef struct parser_branch_node_t
   parser_branch_t branch;                     /**< branch */
 } parser_branch_node_t;
 
+/**
+ * Instruction which pushes a constant value onto the stack.
+ * These instructions can be removed by constant folding.
+ */
+typedef struct
+{
+  uint32_t end_offset;                        /**< byte code size after the instruction
+                                               *   (zero if the item is unused) */
+  uint16_t opcode;                            /**< opcode of the instruction */
+  uint16_t value;                             /**< literal index or number argument */
+} parser_pushed_constant_t;
+
+/**
+ * Maximum number of recorded constant pushing instructions.
+ */
+#define PARSER_MAXIMUM_PUSHED_CONSTANTS 4
+
+/**
+ * Start of a byte code range which is removed when it is unreachable.
+ */
+typedef struct
+{
+  parser_mem_data_t byte_code;                /**< byte code stream at the start */
+  uint32_t byte_code_size;                    /**< byte code size at the start */
+  uint32_t branch_item_count;                 /**< number of branch items at the start */
+  uint32_t no_end_label;                      /**< PARSER_NO_END_LABEL flag at the start */
+} parser_dead_code_t;
+
+/**
+ * Value of a condition known at parse time.
+ */
+typedef enum
+{
+  PARSER_CONDITION_UNKNOWN,                   /**< value is not known */
+  PARSER_CONDITION_TRUE,                      /**< value is always true */
+  PARSER_CONDITION_FALSE,                     /**< value is always false */
+} parser_condition_t;
+
+/**
+ * Type of a constant case value of a switch statement.
+ */
+typedef enum
+{
+  PARSER_SWITCH_KEY_NONE,                     /**< value is not a suitable constant */
+  PARSER_SWITCH_KEY_INTEGER,                  /**< value is a small integer number */
+  PARSER_SWITCH_KEY_STRING,                   /**< value is a string literal */
+} parser_switch_key_t;
+
 /**
  * Those members of a context which needs
  * to be saved when a sub-function is parsed.
@@ -262,6 +316,12 @@ typedef struct
   parser_mem_page_t *free_page_p;             /**< space for fast allocation */
   uint8_t stack_top_uint8;                    /**< top byte stored on the stack */
 
+  /* Constant folding and dead code removal. */
+  parser_pushed_constant_t pushed_constants[PARSER_MAXIMUM_PUSHED_CONSTANTS]; /**< consecutive instructions
+                                                                              *   which pushed a constant */
+  uint8_t pushed_constant_count;              /**< number of items in pushed_constants */
+  uint32_t branch_item_count;                 /**< number of branch items created so far */
+
 #ifndef JERRY_NDEBUG
   /* Variables for debugging / logging. */
   uint16_t context_stack_depth;               /**< current context stack depth */
@@ -275,8 +335,11 @@ typedef struct
 
 /* Memory management.
  * Note: throws an error if unsuccessful. */
+void parser_arena_init (void);
+void parser_arena_release (void);
 void *parser_malloc (parser_context_t *, size_t);
 void parser_free (void *, size_t);
+void *parser_malloc_code (parser_context_t *, size_t);
 void *parser_malloc_local (parser_context_t *, size_t);
 void parser_free_local (void *, size_t);
 
@@ -285,6 +348,7 @@ void parser_free_local (void *, size_t);
 void parser_cbc_stream_init (parser_mem_data_t *);
 void parser_cbc_stream_free (parser_mem_data_t *);
 void parser_cbc_stream_alloc_page (parser_context_t *, parser_mem_data_t *);
+void parser_cbc_stream_truncate (parser_mem_data_t *, const parser_mem_data_t *);
 
 /* Parser list. Ensures pointer alignment. */
 
@@ -300,7 +364,6 @@ void *parser_list_iterator_next (parser_list_iterator_t *);
  * Pop functions never throws error. */
 
 void parser_stack_init (parser_context_t *);
-void parser_stack_free (parser_context_t *);
 void parser_stack_push_uint8 (parser_context_t *, uint8_t);
 void parser_stack_pop_uint8 (parser_context_t *);
 void parser_stack_push_uint16 (parser_context_t *, uint16_t);
@@ -323,9 +386,19 @@ void parser_emit_cbc_forward_branch (parser_context_t *, uint16_t, parser_branch
 parser_branch_node_t *parser_emit_cbc_forward_branch_item (parser_context_t *, uint16_t, parser_branch_node_t *);
 void parser_emit_cbc_backward_branch (parser_context_t *, uint16_t, uint32_t);
 void parser_set_branch_to_current_position (parser_context_t *, parser_branch_t *);
+void parser_set_branch_to_offset (parser_branch_t *, uint32_t);
 void parser_set_breaks_to_current_position (parser_context_t *, parser_branch_node_t *);
 void parser_set_continues_to_current_position (parser_context_t *, parser_branch_node_t *);
 
+/* Constant folding and dead code removal. */
+
+void parser_clear_pushed_constants (parser_context_t *);
+uint32_t parser_count_pushed_constants (parser_context_t *);
+void parser_remove_pushed_constants (parser_context_t *, uint32_t);
+const parser_pushed_constant_t *parser_get_pushed_constant (parser_context_t *, uint32_t);
+void parser_dead_code_start (parser_context_t *, parser_dead_code_t *);
+bool parser_dead_code_end (parser_context_t *, const parser_dead_code_t *);
+
 /* Convenience macros. */
 #define parser_emit_cbc_ext(context_p, opcode) \
   parser_emit_cbc ((context_p), PARSER_TO_EXT_OPCODE (opcode))
@@ -347,6 +420,8 @@ ecma_char_t lexer_hex_to_character (parser_context_t *context_p, const uint8_t *
 void lexer_expect_object_literal_id (parser_context_t *, bool);
 void lexer_construct_literal_object (parser_context_t *, lexer_lit_location_t *, uint8_t);
 bool lexer_construct_number_object (parser_context_t *, bool, bool);
+void lexer_construct_number_literal (parser_context_t *, ecma_number_t);
+void lexer_construct_string_literal (parser_context_t *, const uint8_t *, size_t);
 void lexer_construct_function_object (parser_context_t *, uint32_t);
 void lexer_construct_regexp_object (parser_context_t *, bool);
 bool lexer_compare_identifier_to_current (parser_context_t *, const lexer_lit_location_t *);
@@ -354,6 +429,8 @@ bool lexer_compare_identifier_to_current (parser_context_t *, const lexer_lit_lo
 /* Parser functions. */
 
 void parser_parse_expression (parser_context_t *, int);
+parser_condition_t parser_check_constant_condition (parser_context_t *);
+parser_switch_key_t parser_get_switch_key (parser_context_t *, uint32_t, uint32_t *);
 void parser_parse_statements (parser_context_t *);
 void parser_scan_until (parser_context_t *, lexer_range_t *, lexer_token_type_t);
 ecma_compiled_code_t *parser_parse_function (parser_context_t *, uint32_t);
@@ -39,6 +39,24 @@
 #define PARSER_MAXIMUM_STRING_LENGTH 65535
 #endif /* !PARSER_MAXIMUM_STRING_LENGTH */
 
+/* Maximum length of a string created by constant folding.
+ * Limit: PARSER_MAXIMUM_STRING_LENGTH. */
+#ifndef PARSER_MAXIMUM_FOLDED_STRING_LENGTH
+#define PARSER_MAXIMUM_FOLDED_STRING_LENGTH 256
+#endif /* !PARSER_MAXIMUM_FOLDED_STRING_LENGTH */
+
+/* Minimum number of constant cases of a switch statement compiled to a jump table.
+ * Limit: 2. */
+#ifndef PARSER_MINIMUM_SWITCH_TABLE_CASES
+#define PARSER_MINIMUM_SWITCH_TABLE_CASES 4
+#endif /* !PARSER_MINIMUM_SWITCH_TABLE_CASES */
+
+/* Maximum number of entries of a switch jump table.
+ * Limit: 256, must be a power of 2. */
+#ifndef PARSER_MAXIMUM_SWITCH_TABLE_SIZE
+#define PARSER_MAXIMUM_SWITCH_TABLE_SIZE 256
+#endif /* !PARSER_MAXIMUM_SWITCH_TABLE_SIZE */
+
 /* Maximum number of literals.
  * Limit: 32767. Recommended: 510, 32767 */
 #ifndef PARSER_MAXIMUM_NUMBER_OF_LITERALS
@@ -74,6 +92,20 @@
 #error "Maximum identifier length is not within range."
 #endif /* (PARSER_MAXIMUM_IDENT_LENGTH < 1) || (PARSER_MAXIMUM_IDENT_LENGTH > PARSER_MAXIMUM_STRING_LENGTH) */
 
+#if PARSER_MAXIMUM_FOLDED_STRING_LENGTH > PARSER_MAXIMUM_STRING_LENGTH
+#error "Maximum folded string length is not within range."
+#endif /* PARSER_MAXIMUM_FOLDED_STRING_LENGTH > PARSER_MAXIMUM_STRING_LENGTH */
+
+#if PARSER_MINIMUM_SWITCH_TABLE_CASES < 2
+#error "Minimum number of switch table cases is not within range."
+#endif /* PARSER_MINIMUM_SWITCH_TABLE_CASES < 2 */
+
+#if ((PARSER_MAXIMUM_SWITCH_TABLE_SIZE < PARSER_MINIMUM_SWITCH_TABLE_CASES) \
+     || (PARSER_MAXIMUM_SWITCH_TABLE_SIZE > 256) \
+     || (PARSER_MAXIMUM_SWITCH_TABLE_SIZE & (PARSER_MAXIMUM_SWITCH_TABLE_SIZE - 1)))
+#error "Maximum switch table size is not within range."
+#endif /* PARSER_MAXIMUM_SWITCH_TABLE_SIZE checks */
+
 #if (PARSER_MAXIMUM_NUMBER_OF_LITERALS < 1) || (PARSER_MAXIMUM_NUMBER_OF_LITERALS > 32767)
 #error "Maximum number of literals is not within range."
 #endif /* (PARSER_MAXIMUM_NUMBER_OF_LITERALS < 1) || (PARSER_MAXIMUM_NUMBER_OF_LITERALS > 32767) */
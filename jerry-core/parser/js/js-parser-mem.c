@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "jcontext.h"
 #include "js-parser-internal.h"
 
 /** \addtogroup mem Memory allocation
@@ -27,8 +28,100 @@
 /* Memory allocation                                                  */
 /**********************************************************************/
 
+/* The temporary data of a parse (byte code stream pages, lists, stack pages,
+ * branch lists) is allocated from an arena. The arena grows by chunks taken
+ * from the heap, and the blocks are bump allocated in the current chunk. The
+ * released blocks are reused by later allocations of the same or smaller
+ * size. All chunks are returned to the heap in one step after the parse
+ * except one, which is kept for the next parse. */
+
+/**
+ * Size of the heap block of a parser arena chunk
+ */
+#define PARSER_ARENA_CHUNK_BLOCK_SIZE \
+  (JERRY_ALIGNUP (sizeof (parser_arena_chunk_t), JMEM_ALIGNMENT) + PARSER_ARENA_CHUNK_SIZE)
+
+/**
+ * Get the start of the usable space of a parser arena chunk
+ */
+#define PARSER_ARENA_CHUNK_DATA(chunk_p) \
+  (((uint8_t *) (chunk_p)) + JERRY_ALIGNUP (sizeof (parser_arena_chunk_t), JMEM_ALIGNMENT))
+
+/**
+ * Prepare the parser arena for a new parse.
+ */
+void
+parser_arena_init (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (parser_arena_chunk_p) == NULL);
+
+  /* The spare chunk is taken by the parse, so it is not released by a memory pressure callback. */
+  JERRY_CONTEXT (parser_arena_chunk_p) = JERRY_CONTEXT (parser_arena_spare_chunk_p);
+  JERRY_CONTEXT (parser_arena_spare_chunk_p) = NULL;
+  JERRY_CONTEXT (parser_arena_free_block_p) = NULL;
+  JERRY_CONTEXT (parser_arena_position) = 0;
+
+  if (JERRY_CONTEXT (parser_arena_chunk_p) != NULL)
+  {
+    JERRY_CONTEXT (parser_arena_chunk_p)->next_p = NULL;
+    JERRY_CONTEXT (parser_arena_size) = PARSER_ARENA_CHUNK_BLOCK_SIZE;
+  }
+  else
+  {
+    /* Forces the allocation of a chunk. */
+    JERRY_CONTEXT (parser_arena_position) = PARSER_ARENA_CHUNK_SIZE;
+    JERRY_CONTEXT (parser_arena_size) = 0;
+  }
+
+  JERRY_CONTEXT (parser_arena_peak_size) = JERRY_CONTEXT (parser_arena_size);
+} /* parser_arena_init */
+
 /**
- * Allocate memory.
+ * Release the memory of the parser arena at the end of a parse.
+ */
+void
+parser_arena_release (void)
+{
+  parser_arena_chunk_t *chunk_p = JERRY_CONTEXT (parser_arena_chunk_p);
+
+  JERRY_CONTEXT (parser_arena_chunk_p) = NULL;
+  JERRY_CONTEXT (parser_arena_free_block_p) = NULL;
+  JERRY_CONTEXT (parser_arena_size) = 0;
+
+  if (chunk_p == NULL)
+  {
+    return;
+  }
+
+  JERRY_ASSERT (JERRY_CONTEXT (parser_arena_spare_chunk_p) == NULL);
+
+  JERRY_CONTEXT (parser_arena_spare_chunk_p) = chunk_p;
+  chunk_p = chunk_p->next_p;
+
+  while (chunk_p != NULL)
+  {
+    parser_arena_chunk_t *next_p = chunk_p->next_p;
+
+    jmem_heap_free_block (chunk_p, PARSER_ARENA_CHUNK_BLOCK_SIZE);
+    chunk_p = next_p;
+  }
+} /* parser_arena_release */
+
+/**
+ * Return the chunk kept for the next parse to the heap.
+ */
+void
+parser_arena_free_unused (void)
+{
+  if (JERRY_CONTEXT (parser_arena_spare_chunk_p) != NULL)
+  {
+    jmem_heap_free_block (JERRY_CONTEXT (parser_arena_spare_chunk_p), PARSER_ARENA_CHUNK_BLOCK_SIZE);
+    JERRY_CONTEXT (parser_arena_spare_chunk_p) = NULL;
+  }
+} /* parser_arena_free_unused */
+
+/**
+ * Allocate temporary memory from the parser arena.
  *
  * @return allocated memory.
  */
@@ -36,16 +129,74 @@ void *
 parser_malloc (parser_context_t *context_p, /**< context */
                size_t size) /**< size of the memory block */
 {
-  void *result;
-
   JERRY_ASSERT (size > 0);
-  result = jmem_heap_alloc_block_null_on_error (size);
 
-  if (result == NULL)
+  uint32_t aligned_size = (uint32_t) JERRY_ALIGNUP (size, JMEM_ALIGNMENT);
+
+  JERRY_ASSERT (aligned_size >= sizeof (parser_arena_free_block_t)
+                && aligned_size <= PARSER_ARENA_CHUNK_SIZE);
+
+  parser_arena_free_block_t **free_block_p = &JERRY_CONTEXT (parser_arena_free_block_p);
+
+  while (*free_block_p != NULL)
   {
-    parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+    uint32_t block_size = (*free_block_p)->size;
+
+    if (block_size == aligned_size)
+    {
+      void *result_p = *free_block_p;
+      *free_block_p = (*free_block_p)->next_p;
+      return result_p;
+    }
+
+    if (block_size >= aligned_size + sizeof (parser_arena_free_block_t))
+    {
+      /* The end of a larger block is allocated, the rest remains on the list. */
+      (*free_block_p)->size = block_size - aligned_size;
+      return ((uint8_t *) *free_block_p) + block_size - aligned_size;
+    }
+
+    free_block_p = &(*free_block_p)->next_p;
   }
-  return result;
+
+  if (JERRY_CONTEXT (parser_arena_position) + aligned_size > PARSER_ARENA_CHUNK_SIZE)
+  {
+    uint32_t remaining_size = PARSER_ARENA_CHUNK_SIZE - JERRY_CONTEXT (parser_arena_position);
+
+    if (remaining_size >= sizeof (parser_arena_free_block_t))
+    {
+      /* The end of the current chunk can still be used by smaller blocks. */
+      parser_arena_free_block_t *remaining_block_p;
+      remaining_block_p = (parser_arena_free_block_t *) (PARSER_ARENA_CHUNK_DATA (JERRY_CONTEXT (parser_arena_chunk_p))
+                                                         + JERRY_CONTEXT (parser_arena_position));
+      remaining_block_p->next_p = JERRY_CONTEXT (parser_arena_free_block_p);
+      remaining_block_p->size = remaining_size;
+      JERRY_CONTEXT (parser_arena_free_block_p) = remaining_block_p;
+    }
+
+    parser_arena_chunk_t *chunk_p;
+    chunk_p = (parser_arena_chunk_t *) jmem_heap_alloc_block_null_on_error (PARSER_ARENA_CHUNK_BLOCK_SIZE);
+
+    if (chunk_p == NULL)
+    {
+      parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+    }
+
+    chunk_p->next_p = JERRY_CONTEXT (parser_arena_chunk_p);
+    JERRY_CONTEXT (parser_arena_chunk_p) = chunk_p;
+    JERRY_CONTEXT (parser_arena_position) = 0;
+    JERRY_CONTEXT (parser_arena_size) += PARSER_ARENA_CHUNK_BLOCK_SIZE;
+
+    if (JERRY_CONTEXT (parser_arena_size) > JERRY_CONTEXT (parser_arena_peak_size))
+    {
+      JERRY_CONTEXT (parser_arena_peak_size) = JERRY_CONTEXT (parser_arena_size);
+    }
+  }
+
+  uint8_t *result_p = PARSER_ARENA_CHUNK_DATA (JERRY_CONTEXT (parser_arena_chunk_p));
+  result_p += JERRY_CONTEXT (parser_arena_position);
+  JERRY_CONTEXT (parser_arena_position) += aligned_size;
+  return result_p;
 } /* parser_malloc */
 
 /**
@@ -54,9 +205,44 @@ parser_malloc (parser_context_t *context_p, /**< context */
 void parser_free (void *ptr, /**< pointer to free */
                   size_t size) /**< size of the memory block */
 {
-  jmem_heap_free_block (ptr, size);
+  uint32_t aligned_size = (uint32_t) JERRY_ALIGNUP (size, JMEM_ALIGNMENT);
+  uint8_t *chunk_data_p = PARSER_ARENA_CHUNK_DATA (JERRY_CONTEXT (parser_arena_chunk_p));
+
+  if ((uint8_t *) ptr + aligned_size == chunk_data_p + JERRY_CONTEXT (parser_arena_position))
+  {
+    /* The last allocated block is simply given back. */
+    JERRY_CONTEXT (parser_arena_position) -= aligned_size;
+    return;
+  }
+
+  parser_arena_free_block_t *free_block_p = (parser_arena_free_block_t *) ptr;
+
+  free_block_p->next_p = JERRY_CONTEXT (parser_arena_free_block_p);
+  free_block_p->size = aligned_size;
+  JERRY_CONTEXT (parser_arena_free_block_p) = free_block_p;
 } /* parser_free */
 
+/**
+ * Allocate memory for data which is kept after the parse (e.g. byte code).
+ *
+ * @return allocated memory.
+ */
+void *
+parser_malloc_code (parser_context_t *context_p, /**< context */
+                    size_t size) /**< size of the memory block */
+{
+  void *result;
+
+  JERRY_ASSERT (size > 0);
+  result = jmem_heap_alloc_block_null_on_error (size);
+
+  if (result == NULL)
+  {
+    parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+  }
+  return result;
+} /* parser_malloc_code */
+
 /**
  * Allocate local memory for short term use.
  *
@@ -167,6 +353,32 @@ parser_cbc_stream_alloc_page (parser_context_t *context_p, /**< context */
   data_p->last_p = page_p;
 } /* parser_cbc_stream_alloc_page */
 
+/**
+ * Truncate the byte stream to a previous state of the stream.
+ */
+void
+parser_cbc_stream_truncate (parser_mem_data_t *data_p, /**< memory manager */
+                            const parser_mem_data_t *saved_data_p) /**< previous state of the stream */
+{
+  parser_mem_page_t *page_p = data_p->first_p;
+
+  if (saved_data_p->last_p != NULL)
+  {
+    page_p = saved_data_p->last_p->next_p;
+    saved_data_p->last_p->next_p = NULL;
+  }
+
+  while (page_p != NULL)
+  {
+    parser_mem_page_t *next_p = page_p->next_p;
+
+    parser_free (page_p, sizeof (parser_mem_page_t *) + PARSER_CBC_STREAM_PAGE_SIZE);
+    page_p = next_p;
+  }
+
+  *data_p = *saved_data_p;
+} /* parser_cbc_stream_truncate */
+
 /**********************************************************************/
 /* Parser list management functions                                   */
 /**********************************************************************/
@@ -330,22 +542,6 @@ parser_stack_init (parser_context_t *context_p) /**< context */
   context_p->free_page_p = NULL;
 } /* parser_stack_init */
 
-/**
- * Free parser stack.
- */
-void
-parser_stack_free (parser_context_t *context_p) /**< context */
-{
-  parser_data_free (&context_p->stack,
-                    sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE);
-
-  if (context_p->free_page_p != NULL)
-  {
-    parser_free (context_p->free_page_p,
-                 sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE);
-  }
-} /* parser_stack_free */
-
 /**
  * Pushes an uint8_t value onto the stack.
  */
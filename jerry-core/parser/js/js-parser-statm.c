@@ -15,6 +15,7 @@
  */
 
 #include "js-parser-internal.h"
+#include "lit-strings.h"
 
 /** \addtogroup parser Parser
  * @{
@@ -83,12 +84,24 @@ typedef struct
   parser_branch_node_t *break_list_p;     /**< list of breaks targeting this label */
 } parser_label_statement_t;
 
+/**
+ * Code generation mode of an if or else statement body.
+ */
+typedef enum
+{
+  PARSER_IF_ELSE_BRANCH,                  /**< the body is skipped by a branch at runtime */
+  PARSER_IF_ELSE_ALWAYS,                  /**< the body is always executed, no branch is emitted */
+  PARSER_IF_ELSE_NEVER,                   /**< the body is never executed, its byte code is removed if possible */
+} parser_if_else_mode_t;
+
 /**
  * If/else statement.
  */
 typedef struct
 {
   parser_branch_t branch;                 /**< branch to the end */
+  parser_dead_code_t dead_code;           /**< start of the body if it is never executed */
+  uint8_t mode;                           /**< code generation mode (parser_if_else_mode_t) */
 } parser_if_else_statement_t;
 
 /**
@@ -98,6 +111,12 @@ typedef struct
 {
   parser_branch_t default_branch;         /**< branch to the default case */
   parser_branch_node_t *branch_list_p;    /**< branches of case statements */
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+  uint32_t *case_keys_p;                  /**< constant case values (only used while
+                                           *   the case expressions are parsed) */
+  uint16_t case_key_count;                /**< number of constant case values */
+  uint16_t case_key_capacity;             /**< allocated size of case_keys_p */
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
 } parser_switch_statement_t;
 
 /**
@@ -430,15 +449,56 @@ parser_parse_if_statement_start (parser_context_t *context_p) /**< context */
 
   parser_parse_enclosed_expr (context_p);
 
-  parser_emit_cbc_forward_branch (context_p,
-                                  CBC_BRANCH_IF_FALSE_FORWARD,
-                                  &if_statement.branch);
+  switch (parser_check_constant_condition (context_p))
+  {
+    case PARSER_CONDITION_TRUE:
+    {
+      if_statement.mode = PARSER_IF_ELSE_ALWAYS;
+      break;
+    }
+    case PARSER_CONDITION_FALSE:
+    {
+      if_statement.mode = PARSER_IF_ELSE_NEVER;
+      parser_dead_code_start (context_p, &if_statement.dead_code);
+      parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &if_statement.branch);
+      break;
+    }
+    default:
+    {
+      if_statement.mode = PARSER_IF_ELSE_BRANCH;
+      parser_emit_cbc_forward_branch (context_p,
+                                      CBC_BRANCH_IF_FALSE_FORWARD,
+                                      &if_statement.branch);
+      break;
+    }
+  }
 
   parser_stack_push (context_p, &if_statement, sizeof (parser_if_else_statement_t));
   parser_stack_push_uint8 (context_p, PARSER_STATEMENT_IF);
   parser_stack_iterator_init (context_p, &context_p->last_statement);
 } /* parser_parse_if_statement_start */
 
+/**
+ * Terminate the body of an if or else statement.
+ */
+static void
+parser_end_if_else_body (parser_context_t *context_p, /**< context */
+                         parser_if_else_statement_t *statement_p) /**< if or else statement */
+{
+  if (statement_p->mode == PARSER_IF_ELSE_ALWAYS)
+  {
+    return;
+  }
+
+  if (statement_p->mode == PARSER_IF_ELSE_NEVER
+      && parser_dead_code_end (context_p, &statement_p->dead_code))
+  {
+    return;
+  }
+
+  parser_set_branch_to_current_position (context_p, &statement_p->branch);
+} /* parser_end_if_else_body */
+
 /**
  * Parse if statement (ending part).
  */
@@ -457,7 +517,7 @@ parser_parse_if_statement_end (parser_context_t *context_p) /**< context */
     parser_stack_pop (context_p, &if_statement, sizeof (parser_if_else_statement_t));
     parser_stack_iterator_init (context_p, &context_p->last_statement);
 
-    parser_set_branch_to_current_position (context_p, &if_statement.branch);
+    parser_end_if_else_body (context_p, &if_statement);
 
     return false;
   }
@@ -467,11 +527,32 @@ parser_parse_if_statement_end (parser_context_t *context_p) /**< context */
   parser_stack_iterator_skip (&iterator, 1);
   parser_stack_iterator_read (&iterator, &if_statement, sizeof (parser_if_else_statement_t));
 
-  parser_emit_cbc_forward_branch (context_p,
-                                  CBC_JUMP_FORWARD,
-                                  &else_statement.branch);
+  switch (if_statement.mode)
+  {
+    case PARSER_IF_ELSE_ALWAYS:
+    {
+      else_statement.mode = PARSER_IF_ELSE_NEVER;
+      parser_dead_code_start (context_p, &else_statement.dead_code);
+      parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &else_statement.branch);
+      break;
+    }
+    case PARSER_IF_ELSE_NEVER:
+    {
+      else_statement.mode = PARSER_IF_ELSE_ALWAYS;
+      parser_end_if_else_body (context_p, &if_statement);
+      break;
+    }
+    default:
+    {
+      else_statement.mode = PARSER_IF_ELSE_BRANCH;
+      parser_emit_cbc_forward_branch (context_p,
+                                      CBC_JUMP_FORWARD,
+                                      &else_statement.branch);
 
-  parser_set_branch_to_current_position (context_p, &if_statement.branch);
+      parser_set_branch_to_current_position (context_p, &if_statement.branch);
+      break;
+    }
+  }
 
   parser_stack_iterator_write (&iterator, &else_statement, sizeof (parser_if_else_statement_t));
 
@@ -578,7 +659,17 @@ parser_parse_do_while_statement_end (parser_context_t *context_p) /**< context *
 
   parser_parse_enclosed_expr (context_p);
 
-  if (context_p->last_cbc_opcode != CBC_PUSH_FALSE)
+  parser_condition_t condition = parser_check_constant_condition (context_p);
+
+  if (condition == PARSER_CONDITION_TRUE)
+  {
+    parser_emit_cbc_backward_branch (context_p, CBC_JUMP_BACKWARD, do_while_statement.start_offset);
+  }
+  else if (condition == PARSER_CONDITION_FALSE)
+  {
+    /* The loop body is executed once. */
+  }
+  else if (context_p->last_cbc_opcode != CBC_PUSH_FALSE)
   {
     cbc_opcode_t opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
     if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
@@ -669,19 +760,36 @@ parser_parse_while_statement_end (parser_context_t *context_p) /**< context */
     parser_raise_error (context_p, PARSER_ERR_INVALID_EXPRESSION);
   }
 
-  opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
-  if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
+  switch (parser_check_constant_condition (context_p))
   {
-    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-    opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
-  }
-  else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
-  {
-    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-    opcode = CBC_JUMP_BACKWARD;
-  }
+    case PARSER_CONDITION_TRUE:
+    {
+      parser_emit_cbc_backward_branch (context_p, CBC_JUMP_BACKWARD, while_statement.start_offset);
+      break;
+    }
+    case PARSER_CONDITION_FALSE:
+    {
+      /* The loop body is never executed. */
+      break;
+    }
+    default:
+    {
+      opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
+      if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
+      {
+        context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+        opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
+      }
+      else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
+      {
+        context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+        opcode = CBC_JUMP_BACKWARD;
+      }
 
-  parser_emit_cbc_backward_branch (context_p, opcode, while_statement.start_offset);
+      parser_emit_cbc_backward_branch (context_p, opcode, while_statement.start_offset);
+      break;
+    }
+  }
   parser_set_breaks_to_current_position (context_p, loop.branch_list_p);
 
   parser_set_range (context_p, &range);
@@ -926,16 +1034,34 @@ parser_parse_for_statement_end (parser_context_t *context_p) /**< context */
       parser_raise_error (context_p, PARSER_ERR_INVALID_EXPRESSION);
     }
 
-    opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
-    if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
-    {
-      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-      opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
-    }
-    else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
+    switch (parser_check_constant_condition (context_p))
     {
-      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-      opcode = CBC_JUMP_BACKWARD;
+      case PARSER_CONDITION_TRUE:
+      {
+        opcode = CBC_JUMP_BACKWARD;
+        break;
+      }
+      case PARSER_CONDITION_FALSE:
+      {
+        /* The loop body is never executed. */
+        opcode = CBC_EXT_OPCODE;
+        break;
+      }
+      default:
+      {
+        opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
+        if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
+        {
+          context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+          opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
+        }
+        else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
+        {
+          context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+          opcode = CBC_JUMP_BACKWARD;
+        }
+        break;
+      }
     }
   }
   else
@@ -943,13 +1069,314 @@ parser_parse_for_statement_end (parser_context_t *context_p) /**< context */
     opcode = CBC_JUMP_BACKWARD;
   }
 
-  parser_emit_cbc_backward_branch (context_p, opcode, for_statement.start_offset);
+  if (opcode != CBC_EXT_OPCODE)
+  {
+    parser_emit_cbc_backward_branch (context_p, opcode, for_statement.start_offset);
+  }
   parser_set_breaks_to_current_position (context_p, loop.branch_list_p);
 
   parser_set_range (context_p, &range);
   context_p->token = current_token;
 } /* parser_parse_for_statement_end */
 
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+
+/**
+ * Initial number of constant case values allocated for a switch statement.
+ */
+#define PARSER_SWITCH_KEYS_INITIAL_CAPACITY 8
+
+/**
+ * Size of a jump table entry: the extended opcode prefix,
+ * the opcode and the branch offset in its longest form.
+ */
+#if PARSER_MAXIMUM_CODE_SIZE <= 65535
+#define PARSER_SWITCH_TABLE_ENTRY_SIZE 4
+#else /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
+#define PARSER_SWITCH_TABLE_ENTRY_SIZE 5
+#endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
+
+/**
+ * Free the constant case values of a switch statement.
+ */
+static void
+parser_free_switch_keys (parser_switch_statement_t *switch_statement_p) /**< switch statement */
+{
+  if (switch_statement_p->case_keys_p != NULL)
+  {
+    parser_free (switch_statement_p->case_keys_p, switch_statement_p->case_key_capacity * sizeof (uint32_t));
+    switch_statement_p->case_keys_p = NULL;
+    switch_statement_p->case_key_capacity = 0;
+  }
+} /* parser_free_switch_keys */
+
+/**
+ * Append the value of the last parsed case expression to the constant case values.
+ *
+ * @return type of the case values - if all of them are constants of the same type
+ *         PARSER_SWITCH_KEY_NONE - otherwise
+ */
+static parser_switch_key_t
+parser_append_switch_key (parser_context_t *context_p, /**< context */
+                          parser_stack_iterator_t *iterator_p, /**< switch statement on the stack */
+                          parser_switch_statement_t *switch_statement_p, /**< switch statement */
+                          parser_switch_key_t keys_type, /**< type of the previous values */
+                          uint32_t start_offset) /**< byte code size before the case expression */
+{
+  uint32_t key;
+  uint32_t count = switch_statement_p->case_key_count;
+  parser_switch_key_t key_type = parser_get_switch_key (context_p, start_offset, &key);
+
+  if (key_type == PARSER_SWITCH_KEY_NONE
+      || (count > 0 && key_type != keys_type)
+      || count >= PARSER_MAXIMUM_SWITCH_TABLE_SIZE)
+  {
+    parser_free_switch_keys (switch_statement_p);
+    parser_stack_iterator_write (iterator_p, switch_statement_p, sizeof (parser_switch_statement_t));
+    return PARSER_SWITCH_KEY_NONE;
+  }
+
+  if (count == switch_statement_p->case_key_capacity)
+  {
+    uint32_t capacity = (count == 0) ? PARSER_SWITCH_KEYS_INITIAL_CAPACITY : (count * 2);
+    uint32_t *keys_p = (uint32_t *) parser_malloc (context_p, capacity * sizeof (uint32_t));
+
+    if (count > 0)
+    {
+      memcpy (keys_p, switch_statement_p->case_keys_p, count * sizeof (uint32_t));
+    }
+
+    parser_free_switch_keys (switch_statement_p);
+    switch_statement_p->case_keys_p = keys_p;
+    switch_statement_p->case_key_capacity = (uint16_t) capacity;
+  }
+
+  switch_statement_p->case_keys_p[count] = key;
+  switch_statement_p->case_key_count = (uint16_t) (count + 1);
+  parser_stack_iterator_write (iterator_p, switch_statement_p, sizeof (parser_switch_statement_t));
+  return key_type;
+} /* parser_append_switch_key */
+
+/**
+ * Get the jump table entry of a constant case value.
+ *
+ * @return index of the entry
+ */
+static uint32_t
+parser_get_switch_table_index (parser_context_t *context_p, /**< context */
+                               parser_switch_key_t keys_type, /**< type of the case values */
+                               uint32_t key, /**< case value */
+                               int32_t minimum, /**< smallest integer case value */
+                               uint32_t table_size) /**< number of entries */
+{
+  if (keys_type == PARSER_SWITCH_KEY_INTEGER)
+  {
+    return (uint32_t) ((int32_t) key - minimum);
+  }
+
+  /* The execution engine uses the same hash function for any string value. */
+  lexer_literal_t *literal_p = PARSER_GET_LITERAL (key);
+
+  JERRY_ASSERT (literal_p->type == LEXER_STRING_LITERAL);
+
+  return lit_utf8_string_calc_hash (literal_p->u.char_p, literal_p->prop.length) & (table_size - 1);
+} /* parser_get_switch_table_index */
+
+/**
+ * Replace the comparison chain of a switch statement with a jump table.
+ *
+ * Dense integer case values select their entry directly. String case values
+ * select their entry by their hash, and the entries jump to strict equality
+ * checks, since the hash of several strings may select the same entry.
+ *
+ * @return true - if the jump table and the branch to the default case is emitted
+ *         false - otherwise
+ */
+static bool
+parser_emit_switch_table (parser_context_t *context_p, /**< context */
+                          parser_switch_statement_t *switch_statement_p, /**< switch statement */
+                          parser_switch_key_t keys_type, /**< type of the case values */
+                          const parser_dead_code_t *cases_start_p) /**< start of the comparison chain */
+{
+  uint32_t count = switch_statement_p->case_key_count;
+  uint32_t *keys_p = switch_statement_p->case_keys_p;
+  uint8_t used_entries[(PARSER_MAXIMUM_SWITCH_TABLE_SIZE + 7) / 8];
+  uint32_t table_size = 1;
+  int32_t minimum = 0;
+
+  if (keys_type == PARSER_SWITCH_KEY_NONE || count < PARSER_MINIMUM_SWITCH_TABLE_CASES)
+  {
+    return false;
+  }
+
+  if (keys_type == PARSER_SWITCH_KEY_INTEGER)
+  {
+    int32_t maximum = (int32_t) keys_p[0];
+
+    minimum = maximum;
+
+    for (uint32_t i = 1; i < count; i++)
+    {
+      int32_t key = (int32_t) keys_p[i];
+
+      minimum = JERRY_MIN (minimum, key);
+      maximum = JERRY_MAX (maximum, key);
+    }
+
+    /* At least half of the entries must belong to a case. */
+    if ((uint32_t) (maximum - minimum) >= PARSER_MAXIMUM_SWITCH_TABLE_SIZE
+        || (uint32_t) (maximum - minimum) >= 2 * count)
+    {
+      return false;
+    }
+
+    table_size = (uint32_t) (maximum - minimum) + 1;
+  }
+  else
+  {
+    while (table_size < count)
+    {
+      table_size <<= 1;
+    }
+  }
+
+  if (keys_type == PARSER_SWITCH_KEY_INTEGER)
+  {
+    /* Each case must have its own entry: collisions are duplicated case values. */
+    memset (used_entries, 0, sizeof (used_entries));
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+      uint32_t index = (uint32_t) ((int32_t) keys_p[i] - minimum);
+      uint8_t bit = (uint8_t) (1u << (index & 0x7));
+
+      if (used_entries[index >> 3] & bit)
+      {
+        return false;
+      }
+      used_entries[index >> 3] |= bit;
+    }
+  }
+
+  /* From now on the upper 16 bit of a key is its entry index, and
+   * the lower 16 bit is the literal index of a string case value. */
+  for (uint32_t i = 0; i < count; i++)
+  {
+    uint32_t index = parser_get_switch_table_index (context_p, keys_type, keys_p[i], minimum, table_size);
+
+    keys_p[i] = (index << 16) | (keys_p[i] & 0xffff);
+  }
+
+#ifdef PARSER_DUMP_BYTE_CODE
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("  Case comparisons replaced by a jump table of %d entries\n", (int) table_size);
+  }
+#endif /* PARSER_DUMP_BYTE_CODE */
+
+  JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
+
+  /* The comparison chain consumed the switch value. */
+  parser_cbc_stream_truncate (&context_p->byte_code, &cases_start_p->byte_code);
+  context_p->byte_code_size = cases_start_p->byte_code_size;
+  parser_clear_pushed_constants (context_p);
+  PARSER_PLUS_EQUAL_U16 (context_p->stack_depth, 1);
+
+  if (keys_type == PARSER_SWITCH_KEY_INTEGER)
+  {
+    lexer_construct_number_literal (context_p, (ecma_number_t) minimum);
+
+    context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_SWITCH_INTEGER_TABLE);
+    context_p->last_cbc.literal_index = context_p->lit_object.index;
+    context_p->last_cbc.literal_type = LEXER_UNUSED_LITERAL;
+    context_p->last_cbc.literal_object_type = LEXER_LITERAL_OBJECT_ANY;
+  }
+  else
+  {
+    context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_SWITCH_STRING_TABLE);
+  }
+
+  context_p->last_cbc.value = (uint16_t) (table_size - 1);
+  parser_flush_cbc (context_p);
+
+  uint32_t table_end = context_p->byte_code_size + table_size * PARSER_SWITCH_TABLE_ENTRY_SIZE;
+
+  for (uint32_t index = 0; index < table_size; index++)
+  {
+    parser_branch_node_t *case_p = switch_statement_p->branch_list_p;
+    parser_branch_t unused_entry;
+    parser_branch_t *branch_p = &unused_entry;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+      if ((keys_p[i] >> 16) == index)
+      {
+        branch_p = &case_p->branch;
+        break;
+      }
+      case_p = case_p->next_p;
+    }
+
+    parser_emit_cbc_ext_forward_branch (context_p, CBC_EXT_SWITCH_TABLE_ENTRY, branch_p);
+
+    if (branch_p == &unused_entry)
+    {
+      parser_set_branch_to_offset (branch_p, table_end);
+    }
+  }
+
+  JERRY_ASSERT (context_p->byte_code_size == table_end);
+
+  if (keys_type == PARSER_SWITCH_KEY_INTEGER)
+  {
+    parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &switch_statement_p->default_branch);
+    return true;
+  }
+
+  parser_emit_cbc (context_p, CBC_POP);
+  parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &switch_statement_p->default_branch);
+
+  /* The switch value is still on the stack when the strict equality checks are executed. */
+  parser_branch_node_t *case_p;
+
+  PARSER_PLUS_EQUAL_U16 (context_p->stack_depth, 1);
+
+  /* Strings with the same entry are checked in the order of their cases,
+   * so the first one is selected when a string is duplicated. */
+  for (uint32_t index = 0; index < table_size; index++)
+  {
+    bool is_first = true;
+
+    case_p = switch_statement_p->branch_list_p;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+      if ((keys_p[i] >> 16) == index)
+      {
+        if (is_first)
+        {
+          parser_set_branch_to_current_position (context_p, &case_p->branch);
+          is_first = false;
+        }
+
+        parser_emit_cbc_literal (context_p, CBC_PUSH_LITERAL, (uint16_t) (keys_p[i] & 0xffff));
+        parser_emit_cbc_forward_branch (context_p, CBC_BRANCH_IF_STRICT_EQUAL, &case_p->branch);
+      }
+      case_p = case_p->next_p;
+    }
+
+    if (!is_first)
+    {
+      parser_emit_cbc_backward_branch (context_p, CBC_JUMP_BACKWARD, table_end);
+    }
+  }
+
+  PARSER_MINUS_EQUAL_U16 (context_p->stack_depth, 1);
+  return true;
+} /* parser_emit_switch_table */
+
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
 /**
  * Parse switch statement (starting part).
  */
@@ -963,7 +1390,14 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
   lexer_range_t unused_range;
   bool switch_case_was_found;
   bool default_case_was_found;
+  bool is_jump_table = false;
   parser_branch_node_t *cases_p = NULL;
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+  parser_dead_code_t cases_start;
+  uint32_t case_start_offset = 0;
+  /* The first case value decides the type. */
+  parser_switch_key_t keys_type = PARSER_SWITCH_KEY_INTEGER;
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
 
   JERRY_ASSERT (context_p->token.type == LEXER_KEYW_SWITCH);
 
@@ -1001,6 +1435,11 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
    * are done using the iterator. */
 
   switch_statement.branch_list_p = NULL;
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+  switch_statement.case_keys_p = NULL;
+  switch_statement.case_key_count = 0;
+  switch_statement.case_key_capacity = 0;
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
   loop.branch_list_p = NULL;
 
   parser_stack_push (context_p, &switch_statement, sizeof (parser_switch_statement_t));
@@ -1066,8 +1505,28 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
 
       lexer_next_token (context_p);
 
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+      if (keys_type != PARSER_SWITCH_KEY_NONE)
+      {
+        if (!switch_case_was_found)
+        {
+          parser_dead_code_start (context_p, &cases_start);
+        }
+
+        parser_flush_cbc (context_p);
+        case_start_offset = context_p->byte_code_size;
+      }
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
       parser_parse_expression (context_p, PARSE_EXPR);
 
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+      if (keys_type != PARSER_SWITCH_KEY_NONE)
+      {
+        keys_type = parser_append_switch_key (context_p, &iterator, &switch_statement, keys_type, case_start_offset);
+      }
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
       if (context_p->token.type != LEXER_COLON)
       {
         parser_raise_error (context_p, PARSER_ERR_COLON_EXPECTED);
@@ -1086,8 +1545,20 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
      * of the switch must be popped from the stack */
     parser_emit_cbc (context_p, CBC_POP);
   }
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+  else
+  {
+    is_jump_table = parser_emit_switch_table (context_p, &switch_statement, keys_type, &cases_start);
+  }
 
-  parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &switch_statement.default_branch);
+  parser_free_switch_keys (&switch_statement);
+  parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
+  if (!is_jump_table)
+  {
+    parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &switch_statement.default_branch);
+  }
   parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
 
   if (!default_case_was_found)
@@ -1975,7 +2446,7 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
           parser_stack_pop (context_p, &else_statement, sizeof (parser_if_else_statement_t));
           parser_stack_iterator_init (context_p, &context_p->last_statement);
 
-          parser_set_branch_to_current_position (context_p, &else_statement.branch);
+          parser_end_if_else_body (context_p, &else_statement);
           continue;
         }
 
@@ -2098,6 +2569,10 @@ parser_free_jumps (parser_stack_iterator_t iterator) /**< iterator position */
         parser_stack_iterator_read (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
         parser_stack_iterator_skip (&iterator, sizeof (parser_switch_statement_t));
 
+#ifdef CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
+        parser_free_switch_keys (&switch_statement);
+#endif /* CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER */
+
         branch_list_p = switch_statement.branch_list_p;
         while (branch_list_p != NULL)
         {
@@ -74,6 +74,158 @@ parser_emit_two_bytes (parser_context_t *context_p, /**< context */
   } \
   (context_p)->byte_code.last_p->bytes[(context_p)->byte_code.last_position++] = (uint8_t) (byte)
 
+/**
+ * Get the byte code size of an instruction which pushes a constant.
+ *
+ * @return size of the instruction
+ */
+static inline uint32_t
+parser_pushed_constant_size (uint16_t opcode) /**< opcode */
+{
+  if (opcode == CBC_PUSH_LITERAL)
+  {
+    /* Literal arguments are always two bytes long before post processing. */
+    return 3;
+  }
+
+  if (opcode == CBC_PUSH_NUMBER_POS_BYTE || opcode == CBC_PUSH_NUMBER_NEG_BYTE)
+  {
+    return 2;
+  }
+
+  return 1;
+} /* parser_pushed_constant_size */
+
+/**
+ * Record an instruction which has just been appended to the
+ * stream and pushes a (possibly) constant value onto the stack.
+ */
+static void
+parser_record_pushed_constant (parser_context_t *context_p, /**< context */
+                               uint16_t opcode, /**< opcode */
+                               uint16_t value) /**< literal index or number argument */
+{
+  uint32_t count = context_p->pushed_constant_count;
+  uint32_t start_offset = context_p->byte_code_size - parser_pushed_constant_size (opcode);
+
+  if (count == 0 || context_p->pushed_constants[count - 1].end_offset != start_offset)
+  {
+    /* The recorded instructions are not followed by this instruction. */
+    count = 0;
+  }
+  else if (count == PARSER_MAXIMUM_PUSHED_CONSTANTS)
+  {
+    memmove (context_p->pushed_constants,
+             context_p->pushed_constants + 1,
+             (PARSER_MAXIMUM_PUSHED_CONSTANTS - 1) * sizeof (parser_pushed_constant_t));
+    count--;
+  }
+
+  context_p->pushed_constants[count].end_offset = context_p->byte_code_size;
+  context_p->pushed_constants[count].opcode = opcode;
+  context_p->pushed_constants[count].value = value;
+  context_p->pushed_constant_count = (uint8_t) (count + 1);
+} /* parser_record_pushed_constant */
+
+/**
+ * Forget the recorded constant pushing instructions.
+ */
+void
+parser_clear_pushed_constants (parser_context_t *context_p) /**< context */
+{
+  context_p->pushed_constant_count = 0;
+} /* parser_clear_pushed_constants */
+
+/**
+ * Count the recorded constant pushing instructions at the end of the byte code
+ * stream. These instructions are directly followed by each other, and no branch
+ * targets them, so they push the topmost values of the stack.
+ *
+ * @return number of instructions
+ */
+uint32_t
+parser_count_pushed_constants (parser_context_t *context_p) /**< context */
+{
+  uint32_t count = context_p->pushed_constant_count;
+
+  if (count == 0 || context_p->pushed_constants[count - 1].end_offset != context_p->byte_code_size)
+  {
+    return 0;
+  }
+
+  uint32_t size = 0;
+  uint32_t result = 0;
+
+  while (result < count)
+  {
+    size += parser_pushed_constant_size (context_p->pushed_constants[count - 1 - result].opcode);
+
+    /* Only the last page of the stream can be shortened. */
+    if (size > context_p->byte_code.last_position)
+    {
+      break;
+    }
+
+    result++;
+  }
+
+  return result;
+} /* parser_count_pushed_constants */
+
+/**
+ * Remove the last recorded constant pushing instructions from the byte code stream.
+ */
+void
+parser_remove_pushed_constants (parser_context_t *context_p, /**< context */
+                                uint32_t count) /**< number of instructions */
+{
+  JERRY_ASSERT (count > 0 && count <= parser_count_pushed_constants (context_p));
+  JERRY_ASSERT (context_p->stack_depth >= count);
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    context_p->pushed_constant_count--;
+
+    uint16_t opcode = context_p->pushed_constants[context_p->pushed_constant_count].opcode;
+    uint32_t size = parser_pushed_constant_size (opcode);
+
+    context_p->byte_code.last_position -= size;
+    context_p->byte_code_size -= size;
+  }
+
+  PARSER_MINUS_EQUAL_U16 (context_p->stack_depth, count);
+} /* parser_remove_pushed_constants */
+
+/**
+ * Get the recorded instruction if it is the only instruction
+ * appended to the byte code stream since the given offset.
+ *
+ * @return the recorded instruction - if it is found
+ *         NULL - otherwise
+ */
+const parser_pushed_constant_t *
+parser_get_pushed_constant (parser_context_t *context_p, /**< context */
+                            uint32_t start_offset) /**< byte code size before the instruction */
+{
+  uint32_t count = context_p->pushed_constant_count;
+
+  JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
+
+  if (count == 0 || context_p->pushed_constants[count - 1].end_offset != context_p->byte_code_size)
+  {
+    return NULL;
+  }
+
+  const parser_pushed_constant_t *constant_p = context_p->pushed_constants + count - 1;
+
+  if (constant_p->end_offset - parser_pushed_constant_size (constant_p->opcode) != start_offset)
+  {
+    return NULL;
+  }
+
+  return constant_p;
+} /* parser_get_pushed_constant */
+
 /**
  * Append the current byte code to the stream
  */
@@ -215,6 +367,18 @@ parser_flush_cbc (parser_context_t *context_p) /**< context */
     }
   }
 
+  switch (context_p->last_cbc_opcode)
+  {
+    case CBC_PUSH_LITERAL:
+    case CBC_PUSH_TRUE:
+    case CBC_PUSH_FALSE:
+    case CBC_PUSH_NUMBER_0:
+    {
+      parser_record_pushed_constant (context_p, context_p->last_cbc_opcode, context_p->last_cbc.literal_index);
+      break;
+    }
+  }
+
   context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
 } /* parser_flush_cbc */
 
@@ -337,6 +501,7 @@ parser_emit_cbc_push_number (parser_context_t *context_p, /**< context */
   parser_emit_two_bytes (context_p, opcode, (uint8_t) (value - 1));
 
   context_p->byte_code_size += 2;
+  parser_record_pushed_constant (context_p, (uint16_t) opcode, value);
 
   if (context_p->stack_depth > context_p->stack_limit)
   {
@@ -451,6 +616,7 @@ parser_emit_cbc_forward_branch_item (parser_context_t *context_p, /**< context *
   new_item = (parser_branch_node_t *) parser_malloc (context_p, sizeof (parser_branch_node_t));
   new_item->branch = branch;
   new_item->next_p = next_p;
+  context_p->branch_item_count++;
   return new_item;
 } /* parser_emit_cbc_forward_branch_item */
 
@@ -560,10 +726,6 @@ void
 parser_set_branch_to_current_position (parser_context_t *context_p, /**< context */
                                        parser_branch_t *branch_p) /**< branch result */
 {
-  uint32_t delta;
-  size_t offset;
-  parser_mem_page_t *page_p = branch_p->page_p;
-
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
@@ -571,9 +733,28 @@ parser_set_branch_to_current_position (parser_context_t *context_p, /**< context
 
   context_p->status_flags &= ~PARSER_NO_END_LABEL;
 
-  JERRY_ASSERT (context_p->byte_code_size > (branch_p->offset >> 8));
+  /* The values pushed before a branch target are not constants. */
+  parser_clear_pushed_constants (context_p);
+
+  parser_set_branch_to_offset (branch_p, context_p->byte_code_size);
+} /* parser_set_branch_to_current_position */
 
-  delta = context_p->byte_code_size - (branch_p->offset >> 8);
+/**
+ * Set a forward branch to a byte code offset. The offset can be
+ * greater than the current byte code size if the caller emits an
+ * instruction there later (e.g. the end of a switch jump table).
+ */
+void
+parser_set_branch_to_offset (parser_branch_t *branch_p, /**< branch result */
+                             uint32_t target_offset) /**< byte code offset of the target */
+{
+  uint32_t delta;
+  size_t offset;
+  parser_mem_page_t *page_p = branch_p->page_p;
+
+  JERRY_ASSERT (target_offset > (branch_p->offset >> 8));
+
+  delta = target_offset - (branch_p->offset >> 8);
   offset = (branch_p->offset & CBC_LOWER_SEVEN_BIT_MASK);
 
   JERRY_ASSERT (delta <= PARSER_MAXIMUM_CODE_SIZE);
@@ -600,7 +781,61 @@ parser_set_branch_to_current_position (parser_context_t *context_p, /**< context
   }
 #endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
   page_p->bytes[offset++] = delta & 0xff;
-} /* parser_set_branch_to_current_position */
+} /* parser_set_branch_to_offset */
+
+/**
+ * Start a byte code range which is unreachable. The caller should emit a
+ * forward jump over the range in case parser_dead_code_end cannot remove it.
+ */
+void
+parser_dead_code_start (parser_context_t *context_p, /**< context */
+                        parser_dead_code_t *dead_code_p) /**< [out] start of the range */
+{
+  parser_flush_cbc (context_p);
+
+  dead_code_p->byte_code = context_p->byte_code;
+  dead_code_p->byte_code_size = context_p->byte_code_size;
+  dead_code_p->branch_item_count = context_p->branch_item_count;
+  dead_code_p->no_end_label = context_p->status_flags & PARSER_NO_END_LABEL;
+} /* parser_dead_code_start */
+
+/**
+ * Remove an unreachable byte code range started by parser_dead_code_start.
+ *
+ * The range is kept when it contains a branch item (e.g. a break statement),
+ * since the item may belong to a statement outside of the range.
+ *
+ * @return true - if the range is removed
+ *         false - otherwise
+ */
+bool
+parser_dead_code_end (parser_context_t *context_p, /**< context */
+                      const parser_dead_code_t *dead_code_p) /**< start of the range */
+{
+  parser_flush_cbc (context_p);
+
+  if (context_p->branch_item_count != dead_code_p->branch_item_count)
+  {
+    return false;
+  }
+
+#ifdef PARSER_DUMP_BYTE_CODE
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("  Dead code removed: %d bytes\n",
+                     (int) (context_p->byte_code_size - dead_code_p->byte_code_size));
+  }
+#endif /* PARSER_DUMP_BYTE_CODE */
+
+  parser_cbc_stream_truncate (&context_p->byte_code, &dead_code_p->byte_code);
+  context_p->byte_code_size = dead_code_p->byte_code_size;
+
+  context_p->status_flags &= (uint32_t) ~PARSER_NO_END_LABEL;
+  context_p->status_flags |= dead_code_p->no_end_label;
+
+  parser_clear_pushed_constants (context_p);
+  return true;
+} /* parser_dead_code_end */
 
 /**
  * Set breaks to the current byte code position
@@ -20,6 +20,9 @@
 #include "jcontext.h"
 #include "js-parser-internal.h"
 
+JERRY_STATIC_ASSERT ((sizeof (cbc_lazy_function_t) % JMEM_ALIGNMENT) == 0,
+                     size_of_cbc_lazy_function_t_must_be_aligned);
+
 /** \addtogroup parser Parser
  * @{
  *
@@ -1300,6 +1303,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     uint8_t *opcode_p;
     uint8_t flags;
     size_t branch_offset_length;
+    bool is_fixed_length_branch = false;
 
     opcode_p = page_p->bytes + offset;
     last_opcode = (cbc_opcode_t) (*opcode_p);
@@ -1315,6 +1319,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       ext_opcode = (cbc_ext_opcode_t) page_p->bytes[offset];
       branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (ext_opcode);
       flags = cbc_ext_flags[ext_opcode];
+      is_fixed_length_branch = CBC_EXT_IS_SWITCH_TABLE_ENTRY (ext_opcode);
       PARSER_NEXT_BYTE (page_p, offset);
       length++;
     }
@@ -1390,7 +1395,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
     if (flags & CBC_HAS_BRANCH_ARG)
     {
-      bool prefix_zero = true;
+      bool prefix_zero = !is_fixed_length_branch;
 #if PARSER_MAXIMUM_CODE_SIZE <= 65535
       cbc_opcode_t jump_forward = CBC_JUMP_FORWARD_2;
 #else /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
@@ -1400,7 +1405,8 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       /* The leading zeroes are dropped from the stream.
        * Although dropping these zeroes for backward
        * branches are unnecessary, we use the same
-       * code path for simplicity. */
+       * code path for simplicity. Switch table entries
+       * are the only exception. */
       JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
 
       while (--branch_offset_length > 0)
@@ -1460,7 +1466,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   total_size += length + context_p->literal_count * sizeof (jmem_cpointer_t);
   total_size = JERRY_ALIGNUP (total_size, JMEM_ALIGNMENT);
 
-  compiled_code_p = (ecma_compiled_code_t *) parser_malloc (context_p, total_size);
+  compiled_code_p = (ecma_compiled_code_t *) parser_malloc_code (context_p, total_size);
 
   byte_code_p = (uint8_t *) compiled_code_p;
   compiled_code_p->size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
@@ -1541,6 +1547,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     uint8_t *branch_mark_p;
     cbc_opcode_t opcode;
     size_t branch_offset_length;
+    bool is_fixed_length_branch = false;
 
     opcode_p = dst_p;
     branch_mark_p = page_p->bytes + offset;
@@ -1578,6 +1585,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       ext_opcode = (cbc_ext_opcode_t) page_p->bytes[offset];
       flags = cbc_ext_flags[ext_opcode];
       branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (ext_opcode);
+      is_fixed_length_branch = CBC_EXT_IS_SWITCH_TABLE_ENTRY (ext_opcode);
 
       /* Storing the extended opcode */
       *dst_p++ = ext_opcode;
@@ -1637,7 +1645,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
     if (flags & CBC_HAS_BRANCH_ARG)
     {
-      bool prefix_zero = true;
+      bool prefix_zero = !is_fixed_length_branch;
 
       /* The leading zeroes are dropped from the stream. */
       JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
@@ -1803,6 +1811,9 @@ static ecma_compiled_code_t *
 parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
                      size_t size, /**< size of the source code */
                      int strict_mode, /**< strict mode */
+                     bool is_lazy, /**< compile inner functions on their first call */
+                     const cbc_lazy_function_t *lazy_function_p, /**< compile the body of this function
+                                                                  *   instead of the source (can be NULL) */
                      parser_error_location_t *error_location_p) /**< error location */
 {
   parser_context_t context;
@@ -1827,19 +1838,36 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
     context.status_flags |= PARSER_IS_STRICT;
   }
 
+  if (is_lazy)
+  {
+    context.status_flags |= PARSER_LAZY_FUNCTIONS;
+  }
+
   context.source_p = source_p;
   context.source_end_p = source_p + size;
   context.line = 1;
   context.column = 1;
 
+  if (lazy_function_p != NULL)
+  {
+    context.status_flags |= lazy_function_p->parser_status_flags & PARSER_IS_STRICT;
+    context.source_p = lazy_function_p->source_p;
+    context.source_end_p = lazy_function_p->source_end_p;
+    context.line = lazy_function_p->line;
+    context.column = lazy_function_p->column;
+  }
+
   context.last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
 
   context.argument_count = 0;
   context.register_count = 0;
   context.literal_count = 0;
 
+  parser_arena_init ();
   parser_cbc_stream_init (&context.byte_code);
   context.byte_code_size = 0;
+  parser_clear_pushed_constants (&context);
+  context.branch_item_count = 0;
   parser_list_init (&context.literal_pool,
                     sizeof (lexer_literal_t),
                     (uint32_t) ((128 - sizeof (void *)) / sizeof (lexer_literal_t)));
@@ -1864,33 +1892,45 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
     /* Pushing a dummy value ensures the stack is never empty.
      * This simplifies the stack management routines. */
     parser_stack_push_uint8 (&context, CBC_MAXIMUM_BYTE_VALUE);
-    /* The next token must always be present to make decisions
-     * in the parser. Therefore when a token is consumed, the
-     * lexer_next_token() must be immediately called. */
-    lexer_next_token (&context);
 
-    parser_parse_statements (&context);
-
-    /* When the parsing is successful, only the
-     * dummy value can be remained on the stack. */
-    JERRY_ASSERT (context.stack_top_uint8 == CBC_MAXIMUM_BYTE_VALUE
-                  && context.stack.last_position == 1
-                  && context.stack.first_p != NULL
-                  && context.stack.first_p->next_p == NULL
-                  && context.stack.last_p == NULL);
-    JERRY_ASSERT (context.last_statement.current_p == NULL);
-
-    JERRY_ASSERT (context.last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
-    JERRY_ASSERT (context.allocated_buffer_p == NULL);
-
-    compiled_code = parser_post_processing (&context);
-    parser_list_free (&context.literal_pool);
+    if (lazy_function_p != NULL)
+    {
+      uint32_t status_flags = lazy_function_p->parser_status_flags | PARSER_NO_LAZY_COMPILE;
+      compiled_code = parser_parse_function (&context, status_flags);
+      parser_list_free (&context.literal_pool);
+    }
+    else
+    {
+      /* The next token must always be present to make decisions
+       * in the parser. Therefore when a token is consumed, the
+       * lexer_next_token() must be immediately called. */
+      lexer_next_token (&context);
+
+      parser_parse_statements (&context);
+
+      /* When the parsing is successful, only the
+       * dummy value can be remained on the stack. */
+      JERRY_ASSERT (context.stack_top_uint8 == CBC_MAXIMUM_BYTE_VALUE
+                    && context.stack.last_position == 1
+                    && context.stack.first_p != NULL
+                    && context.stack.first_p->next_p == NULL
+                    && context.stack.last_p == NULL);
+      JERRY_ASSERT (context.last_statement.current_p == NULL);
+
+      JERRY_ASSERT (context.last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
+      JERRY_ASSERT (context.allocated_buffer_p == NULL);
+
+      compiled_code = parser_post_processing (&context);
+      parser_list_free (&context.literal_pool);
+    }
 
 #ifdef PARSER_DUMP_BYTE_CODE
     if (context.is_show_opcodes)
     {
       JERRY_DEBUG_MSG ("\nScript parsing successfully completed. Total byte code size: %d bytes\n",
                        (int) context.total_byte_code_size);
+      JERRY_DEBUG_MSG ("Peak parser arena size: %d bytes\n",
+                       (int) JERRY_CONTEXT (parser_arena_peak_size));
     }
 #endif /* PARSER_DUMP_BYTE_CODE */
   }
@@ -1927,7 +1967,8 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
   }
 #endif /* PARSER_DUMP_BYTE_CODE */
 
-  parser_stack_free (&context);
+  /* The stack pages and any other temporary data are released together. */
+  parser_arena_release ();
 
   return compiled_code;
 } /* parser_parse_source */
@@ -1935,7 +1976,12 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
 /**
  * Parse function code
  *
- * @return compiled code
+ * Note:
+ *      when lazy compilation is enabled, the function body is only checked for
+ *      syntax errors and a cbc_lazy_function_t placeholder is returned instead
+ *
+ * @return compiled code - if the function is not nested into a pre-parsed function,
+ *         NULL - otherwise
  */
 ecma_compiled_code_t *
 parser_parse_function (parser_context_t *context_p, /**< context */
@@ -1943,6 +1989,9 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 {
   parser_saved_context_t saved_context;
   ecma_compiled_code_t *compiled_code_p;
+  const uint8_t *source_start_p = context_p->source_p;
+  parser_line_counter_t start_line = context_p->line;
+  parser_line_counter_t start_column = context_p->column;
 
   JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
 
@@ -1970,8 +2019,18 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   JERRY_ASSERT (status_flags & PARSER_IS_FUNCTION);
 
-  context_p->status_flags &= PARSER_IS_STRICT;
+  context_p->status_flags &= PARSER_IS_STRICT | PARSER_LAZY_FUNCTIONS | PARSER_PRE_PARSE;
   context_p->status_flags |= status_flags;
+
+  /* Only the syntax of the function body is checked when the function is
+   * compiled lazily. Inner functions of such a body are pre-parsed as well. */
+  const uint32_t lazy_status_flags = PARSER_LAZY_FUNCTIONS | PARSER_PRE_PARSE | PARSER_NO_LAZY_COMPILE;
+  bool is_lazy_function = ((context_p->status_flags & lazy_status_flags) == PARSER_LAZY_FUNCTIONS);
+
+  if (is_lazy_function)
+  {
+    context_p->status_flags |= PARSER_PRE_PARSE;
+  }
   context_p->stack_depth = 0;
   context_p->stack_limit = 0;
   context_p->last_context_p = &saved_context;
@@ -1983,6 +2042,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   parser_cbc_stream_init (&context_p->byte_code);
   context_p->byte_code_size = 0;
+  parser_clear_pushed_constants (context_p);
   parser_list_reset (&context_p->literal_pool);
 
 #ifndef JERRY_NDEBUG
@@ -1990,6 +2050,14 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 #endif /* !JERRY_NDEBUG */
 
 #ifdef PARSER_DUMP_BYTE_CODE
+  int is_show_opcodes = context_p->is_show_opcodes;
+
+  if (is_lazy_function && is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("\n--- Function pre-parsed, compiled on its first call ---\n\n");
+    context_p->is_show_opcodes = 0;
+  }
+
   if (context_p->is_show_opcodes)
   {
     JERRY_DEBUG_MSG ("\n--- Function parsing start ---\n\n");
@@ -2150,16 +2218,66 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   lexer_next_token (context_p);
   parser_parse_statements (context_p);
-  compiled_code_p = parser_post_processing (context_p);
+
+  if (context_p->status_flags & PARSER_PRE_PARSE)
+  {
+    if ((size_t) context_p->stack_limit + (size_t) context_p->register_count > PARSER_MAXIMUM_STACK_LIMIT)
+    {
+      parser_raise_error (context_p, PARSER_ERR_STACK_LIMIT_REACHED);
+    }
+
+    compiled_code_p = NULL;
+
+    if (is_lazy_function)
+    {
+      cbc_lazy_function_t *lazy_function_p;
+      lazy_function_p = (cbc_lazy_function_t *) parser_malloc_code (context_p, sizeof (cbc_lazy_function_t));
+
+      uint16_t argument_count = context_p->argument_count;
+      uint16_t code_flags = CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_UINT16_ARGUMENTS | CBC_CODE_FLAGS_LAZY_FUNCTION;
+
+      if (context_p->status_flags & PARSER_IS_STRICT)
+      {
+        code_flags |= CBC_CODE_FLAGS_STRICT_MODE;
+      }
+
+      lazy_function_p->header.header.size = (uint16_t) (sizeof (cbc_lazy_function_t) >> JMEM_ALIGNMENT_LOG);
+      lazy_function_p->header.header.refs = 1;
+      lazy_function_p->header.header.status_flags = code_flags;
+      lazy_function_p->header.stack_limit = 0;
+      lazy_function_p->header.argument_end = argument_count;
+      lazy_function_p->header.register_end = argument_count;
+      lazy_function_p->header.ident_end = argument_count;
+      lazy_function_p->header.const_literal_end = argument_count;
+      lazy_function_p->header.literal_end = argument_count;
+
+      lazy_function_p->bytecode_cp = JMEM_CP_NULL;
+      lazy_function_p->parser_status_flags = status_flags | (saved_context.status_flags & PARSER_IS_STRICT);
+      lazy_function_p->line = start_line;
+      lazy_function_p->column = start_column;
+      lazy_function_p->source_p = source_start_p;
+      lazy_function_p->source_end_p = context_p->source_p;
+
+      compiled_code_p = (ecma_compiled_code_t *) lazy_function_p;
+    }
+
+    parser_cbc_stream_free (&context_p->byte_code);
+    parser_free_literals (&context_p->literal_pool);
+  }
+  else
+  {
+    compiled_code_p = parser_post_processing (context_p);
+    parser_list_free (&context_p->literal_pool);
+  }
 
 #ifdef PARSER_DUMP_BYTE_CODE
   if (context_p->is_show_opcodes)
   {
     JERRY_DEBUG_MSG ("\n--- Function parsing end ---\n\n");
   }
-#endif /* PARSER_DUMP_BYTE_CODE */
 
-  parser_list_free (&context_p->literal_pool);
+  context_p->is_show_opcodes = is_show_opcodes;
+#endif /* PARSER_DUMP_BYTE_CODE */
 
   /* Restore private part of the context. */
 
@@ -2178,6 +2296,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   context_p->byte_code = saved_context.byte_code;
   context_p->byte_code_size = saved_context.byte_code_size;
   context_p->literal_pool.data = saved_context.literal_pool_data;
+  parser_clear_pushed_constants (context_p);
 
 #ifndef JERRY_NDEBUG
   context_p->context_stack_depth = saved_context.context_stack_depth;
@@ -2229,86 +2348,133 @@ parser_raise_error (parser_context_t *context_p, /**< context */
 #define PARSE_ERR_POS_END_SIZE    ((uint32_t) sizeof (PARSE_ERR_POS_END))
 
 /**
- * Parse EcamScript source code
+ * Create the error value of a parse error
  *
  * Note:
  *      returned value must be freed with ecma_free_value
  *
- * @return true - if success
- *         syntax error - otherwise
+ * @return syntax error
  */
-ecma_value_t
-parser_parse_script (const uint8_t *source_p, /**< source code */
-                     size_t size, /**< size of the source code */
-                     bool is_strict, /**< strict mode */
-                     ecma_compiled_code_t **bytecode_data_p) /**< [out] JS bytecode */
+static ecma_value_t
+parser_create_error_value (parser_error_location_t *parser_error_p) /**< parse error */
 {
-  parser_error_location_t parser_error;
-  *bytecode_data_p = parser_parse_source (source_p, size, is_strict, &parser_error);
-
-  if (!*bytecode_data_p)
+  if (parser_error_p->error == PARSER_ERR_OUT_OF_MEMORY)
   {
-    if (parser_error.error == PARSER_ERR_OUT_OF_MEMORY)
-    {
-      /* It is unlikely that memory can be allocated in an out-of-memory
-       * situation. However, a simple value can still be thrown. */
-      return ecma_make_error_value (ecma_make_simple_value (ECMA_SIMPLE_VALUE_NULL));
-    }
+    /* It is unlikely that memory can be allocated in an out-of-memory
+     * situation. However, a simple value can still be thrown. */
+    return ecma_make_error_value (ecma_make_simple_value (ECMA_SIMPLE_VALUE_NULL));
+  }
 #if JERRY_ENABLE_ERROR_MESSAGES
-    const char *err_str_p = parser_error_to_string (parser_error.error);
-    uint32_t err_str_size = lit_zt_utf8_string_size ((const lit_utf8_byte_t *) err_str_p);
+  const char *err_str_p = parser_error_to_string (parser_error_p->error);
+  uint32_t err_str_size = lit_zt_utf8_string_size ((const lit_utf8_byte_t *) err_str_p);
 
-    char line_str_p[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
-    uint32_t line_len = ecma_uint32_to_utf8_string (parser_error.line,
-                                                    (lit_utf8_byte_t *) line_str_p,
-                                                    ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32);
+  char line_str_p[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+  uint32_t line_len = ecma_uint32_to_utf8_string (parser_error_p->line,
+                                                  (lit_utf8_byte_t *) line_str_p,
+                                                  ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32);
 
-    char col_str_p[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
-    uint32_t col_len = ecma_uint32_to_utf8_string (parser_error.column,
-                                                   (lit_utf8_byte_t *) col_str_p,
-                                                   ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32);
+  char col_str_p[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+  uint32_t col_len = ecma_uint32_to_utf8_string (parser_error_p->column,
+                                                 (lit_utf8_byte_t *) col_str_p,
+                                                 ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32);
 
-    uint32_t msg_size = (err_str_size
-                         + line_len
-                         + col_len
-                         + PARSE_ERR_POS_START_SIZE
-                         + PARSE_ERR_POS_MIDDLE_SIZE
-                         + PARSE_ERR_POS_END_SIZE);
+  uint32_t msg_size = (err_str_size
+                       + line_len
+                       + col_len
+                       + PARSE_ERR_POS_START_SIZE
+                       + PARSE_ERR_POS_MIDDLE_SIZE
+                       + PARSE_ERR_POS_END_SIZE);
 
-    ecma_value_t error_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_value_t error_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
-    JMEM_DEFINE_LOCAL_ARRAY (error_msg_p, msg_size, char);
-    char *err_msg_pos_p = error_msg_p;
+  JMEM_DEFINE_LOCAL_ARRAY (error_msg_p, msg_size, char);
+  char *err_msg_pos_p = error_msg_p;
 
-    strncpy (err_msg_pos_p, err_str_p, err_str_size);
-    err_msg_pos_p += err_str_size;
+  strncpy (err_msg_pos_p, err_str_p, err_str_size);
+  err_msg_pos_p += err_str_size;
 
-    strncpy (err_msg_pos_p, PARSE_ERR_POS_START, PARSE_ERR_POS_START_SIZE);
-    err_msg_pos_p += PARSE_ERR_POS_START_SIZE;
+  strncpy (err_msg_pos_p, PARSE_ERR_POS_START, PARSE_ERR_POS_START_SIZE);
+  err_msg_pos_p += PARSE_ERR_POS_START_SIZE;
 
-    strncpy (err_msg_pos_p, line_str_p, line_len);
-    err_msg_pos_p += line_len;
+  strncpy (err_msg_pos_p, line_str_p, line_len);
+  err_msg_pos_p += line_len;
 
-    strncpy (err_msg_pos_p, PARSE_ERR_POS_MIDDLE, PARSE_ERR_POS_MIDDLE_SIZE);
-    err_msg_pos_p += PARSE_ERR_POS_MIDDLE_SIZE;
+  strncpy (err_msg_pos_p, PARSE_ERR_POS_MIDDLE, PARSE_ERR_POS_MIDDLE_SIZE);
+  err_msg_pos_p += PARSE_ERR_POS_MIDDLE_SIZE;
 
-    strncpy (err_msg_pos_p, col_str_p, col_len);
-    err_msg_pos_p += col_len;
+  strncpy (err_msg_pos_p, col_str_p, col_len);
+  err_msg_pos_p += col_len;
 
-    strncpy (err_msg_pos_p, PARSE_ERR_POS_END, PARSE_ERR_POS_END_SIZE);
+  strncpy (err_msg_pos_p, PARSE_ERR_POS_END, PARSE_ERR_POS_END_SIZE);
 
-    error_value = ecma_raise_syntax_error (error_msg_p);
-    JMEM_FINALIZE_LOCAL_ARRAY (error_msg_p);
+  error_value = ecma_raise_syntax_error (error_msg_p);
+  JMEM_FINALIZE_LOCAL_ARRAY (error_msg_p);
 
-    return error_value;
+  return error_value;
 #else /* !JERRY_ENABLE_ERROR_MESSAGES */
-    return ecma_raise_syntax_error ("");
+  return ecma_raise_syntax_error ("");
 #endif /* JERRY_ENABLE_ERROR_MESSAGES */
+} /* parser_create_error_value */
+
+/**
+ * Parse EcamScript source code
+ *
+ * Note:
+ *      returned value must be freed with ecma_free_value
+ *
+ * @return true - if success
+ *         syntax error - otherwise
+ */
+ecma_value_t
+parser_parse_script (const uint8_t *source_p, /**< source code */
+                     size_t size, /**< size of the source code */
+                     bool is_strict, /**< strict mode */
+                     bool is_lazy, /**< compile the inner functions on their first call
+                                    *   (the source code must be kept until the engine stops) */
+                     ecma_compiled_code_t **bytecode_data_p) /**< [out] JS bytecode */
+{
+  parser_error_location_t parser_error;
+  *bytecode_data_p = parser_parse_source (source_p, size, is_strict, is_lazy, NULL, &parser_error);
+
+  if (!*bytecode_data_p)
+  {
+    return parser_create_error_value (&parser_error);
   }
 
   return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
 } /* parser_parse_script */
 
+/**
+ * Compile the body of a function which was pre-parsed by parser_parse_script
+ *
+ * Note:
+ *      returned value must be freed with ecma_free_value
+ *
+ * @return true - if success
+ *         syntax error - otherwise
+ */
+ecma_value_t
+parser_parse_lazy_function (const ecma_compiled_code_t *lazy_function_p, /**< lazy function */
+                            ecma_compiled_code_t **bytecode_data_p) /**< [out] JS bytecode */
+{
+  JERRY_ASSERT (lazy_function_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION);
+
+  parser_error_location_t parser_error;
+  *bytecode_data_p = parser_parse_source (NULL,
+                                          0,
+                                          false,
+                                          true,
+                                          (const cbc_lazy_function_t *) lazy_function_p,
+                                          &parser_error);
+
+  if (!*bytecode_data_p)
+  {
+    return parser_create_error_value (&parser_error);
+  }
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+} /* parser_parse_lazy_function */
+
 /**
  * @}
  * @}
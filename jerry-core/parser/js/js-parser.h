@@ -128,8 +128,28 @@ typedef struct
   parser_line_counter_t column;                       /**< column where the error occured */
 } parser_error_location_t;
 
+/**
+ * Chunk of the parser arena, followed by the allocated blocks
+ */
+typedef struct parser_arena_chunk_t
+{
+  struct parser_arena_chunk_t *next_p;                /**< previously allocated chunk */
+} parser_arena_chunk_t;
+
+/**
+ * Released block of the parser arena, which can be reused by an allocation of the same size
+ */
+typedef struct parser_arena_free_block_t
+{
+  struct parser_arena_free_block_t *next_p;           /**< next released block */
+  uint32_t size;                                      /**< size of the block */
+} parser_arena_free_block_t;
+
+extern void parser_arena_free_unused (void);
+
 /* Note: source must be a valid UTF-8 string */
-extern ecma_value_t parser_parse_script (const uint8_t *, size_t, bool, ecma_compiled_code_t **);
+extern ecma_value_t parser_parse_script (const uint8_t *, size_t, bool, bool, ecma_compiled_code_t **);
+extern ecma_value_t parser_parse_lazy_function (const ecma_compiled_code_t *, ecma_compiled_code_t **);
 
 const char *parser_error_to_string (parser_error_t);
 
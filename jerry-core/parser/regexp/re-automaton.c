@@ -0,0 +1,765 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jmem-heap.h"
+#include "re-automaton.h"
+#include "re-parser.h"
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup regexparser Regular expression
+ * @{
+ *
+ * \addtogroup regexparser_automaton Automaton
+ * @{
+ *
+ * Patterns without backreferences and lookaheads are also compiled to a
+ * Thompson-style automaton, which is executed by a Pike VM. The VM runs all
+ * possible paths in parallel in priority order, so it finds the same match as
+ * the backtracking matcher, but the matching time is linear. The automaton
+ * resets the captures inside a quantified atom or group at the start of each
+ * iteration as ECMA-262 v5, 15.10.2.5 requires, while the backtracking matcher
+ * keeps the captures of the earlier iterations, so these captures may differ.
+ */
+
+/**
+ * Marker of an instruction target which is not resolved yet
+ */
+#define RE_AUTOMATON_PENDING UINT16_MAX
+
+/**
+ * Context of the RegExp automaton compiler
+ */
+typedef struct
+{
+  re_automaton_inst_t *inst_p;       /**< instruction buffer */
+  const uint8_t *bytecode_start_p;   /**< start of the compiled code */
+  uint32_t length;                   /**< number of instructions */
+  bool is_supported;                 /**< the RegExp can be matched by the automaton */
+} re_automaton_ctx_t;
+
+/**
+ * Skip the operands of an opcode
+ *
+ * @return true - if the opcode is supported by the automaton
+ *         false - otherwise
+ */
+static bool
+re_automaton_skip_operands (re_opcode_t op, /**< opcode */
+                            uint8_t **bytecode_p) /**< [in/out] position of the operands */
+{
+  /* The operands are read in the same way as in re_dump_bytecode. */
+  switch (op)
+  {
+    case RE_OP_CHAR:
+    {
+      re_get_char (bytecode_p);
+      break;
+    }
+    case RE_OP_CAPTURE_GREEDY_GROUP_END:
+    case RE_OP_CAPTURE_NON_GREEDY_GROUP_END:
+    case RE_OP_NON_CAPTURE_GREEDY_GROUP_END:
+    case RE_OP_NON_CAPTURE_NON_GREEDY_GROUP_END:
+    {
+      *bytecode_p += sizeof (uint32_t);
+      /* FALLTHRU */
+    }
+    case RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START:
+    case RE_OP_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+    case RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START:
+    case RE_OP_NON_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+    case RE_OP_GREEDY_ITERATOR:
+    case RE_OP_NON_GREEDY_ITERATOR:
+    {
+      *bytecode_p += sizeof (uint32_t);
+      /* FALLTHRU */
+    }
+    case RE_OP_CAPTURE_GROUP_START:
+    case RE_OP_NON_CAPTURE_GROUP_START:
+    {
+      *bytecode_p += sizeof (uint32_t);
+      /* FALLTHRU */
+    }
+    case RE_OP_SAVE_AT_START:
+    case RE_OP_ALTERNATIVE:
+    {
+      *bytecode_p += sizeof (uint32_t);
+      break;
+    }
+    case RE_OP_CHAR_CLASS:
+    case RE_OP_INV_CHAR_CLASS:
+    {
+      uint32_t num_of_ranges = re_get_value (bytecode_p);
+      *bytecode_p += num_of_ranges * 2 * sizeof (ecma_char_t);
+      break;
+    }
+    case RE_OP_MATCH:
+    case RE_OP_SAVE_AND_MATCH:
+    case RE_OP_PERIOD:
+    case RE_OP_ASSERT_START:
+    case RE_OP_ASSERT_END:
+    case RE_OP_ASSERT_WORD_BOUNDARY:
+    case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+    {
+      break;
+    }
+    default:
+    {
+      /* Backreferences and lookaheads. */
+      return false;
+    }
+  }
+
+  return true;
+} /* re_automaton_skip_operands */
+
+/**
+ * Check whether the bytecode contains only opcodes which are supported by the automaton
+ *
+ * @return true - if the automaton can be built for the bytecode
+ *         false - otherwise
+ */
+static bool
+re_automaton_is_supported_bytecode (uint8_t *bytecode_p) /**< RegExp bytecode */
+{
+  re_opcode_t op;
+
+  while ((op = re_get_opcode (&bytecode_p)))
+  {
+    if (!re_automaton_skip_operands (op, &bytecode_p))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* re_automaton_is_supported_bytecode */
+
+/**
+ * Find the capture groups which are opened in a part of the bytecode
+ *
+ * Note:
+ *      the indices of these groups are consecutive
+ *
+ * @return number of the capture groups
+ */
+static uint32_t
+re_automaton_find_captures (uint8_t *bytecode_p, /**< start of the bytecode */
+                            uint8_t *bytecode_end_p, /**< end of the bytecode */
+                            uint32_t *first_idx_p) /**< [out] index of the first capture group */
+{
+  uint32_t count = 0;
+
+  while (bytecode_p < bytecode_end_p)
+  {
+    re_opcode_t op = re_get_opcode (&bytecode_p);
+
+    if (op == RE_OP_CAPTURE_GROUP_START
+        || op == RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START
+        || op == RE_OP_CAPTURE_NON_GREEDY_ZERO_GROUP_START)
+    {
+      uint8_t *operand_p = bytecode_p;
+      uint32_t idx = re_get_value (&operand_p);
+
+      if (count == 0)
+      {
+        *first_idx_p = idx;
+      }
+
+      count = idx - *first_idx_p + 1;
+    }
+
+    re_automaton_skip_operands (op, &bytecode_p);
+  }
+
+  return count;
+} /* re_automaton_find_captures */
+
+/**
+ * Append an instruction to the automaton
+ *
+ * @return index of the instruction
+ */
+static uint32_t
+re_automaton_emit (re_automaton_ctx_t *ctx_p, /**< automaton compiler context */
+                   re_automaton_opcode_t opcode, /**< opcode */
+                   uint32_t arg, /**< first argument */
+                   uint32_t value) /**< second argument */
+{
+  if (ctx_p->length >= RE_AUTOMATON_MAX_LENGTH)
+  {
+    /* The instructions are not used anymore, so the first one can be overwritten. */
+    ctx_p->is_supported = false;
+    return 0;
+  }
+
+  re_automaton_inst_t *inst_p = ctx_p->inst_p + ctx_p->length;
+  inst_p->opcode = (uint8_t) opcode;
+  inst_p->arg = (uint16_t) arg;
+  inst_p->value = value;
+
+  return ctx_p->length++;
+} /* re_automaton_emit */
+
+/**
+ * Resolve the pending jump and split targets starting from an instruction
+ */
+static void
+re_automaton_resolve_pending (re_automaton_ctx_t *ctx_p, /**< automaton compiler context */
+                              uint32_t start_idx, /**< first instruction to check */
+                              uint32_t target_idx) /**< target instruction */
+{
+  for (uint32_t i = start_idx; i < ctx_p->length; i++)
+  {
+    re_automaton_inst_t *inst_p = ctx_p->inst_p + i;
+
+    if (inst_p->opcode == RE_AUTOMATON_JUMP || inst_p->opcode == RE_AUTOMATON_SPLIT)
+    {
+      if (inst_p->arg == RE_AUTOMATON_PENDING)
+      {
+        inst_p->arg = (uint16_t) target_idx;
+      }
+
+      if (inst_p->opcode == RE_AUTOMATON_SPLIT && inst_p->value == RE_AUTOMATON_PENDING)
+      {
+        inst_p->value = target_idx;
+      }
+    }
+  }
+} /* re_automaton_resolve_pending */
+
+/**
+ * Skip the alternatives of a group
+ *
+ * @return pointer to the opcode after the alternatives
+ */
+static uint8_t *
+re_automaton_skip_alternatives (uint8_t *bytecode_p) /**< start of the first alternative */
+{
+  while (true)
+  {
+    uint32_t length = re_get_value (&bytecode_p);
+    bytecode_p += length;
+
+    if (*bytecode_p != RE_OP_ALTERNATIVE)
+    {
+      return bytecode_p;
+    }
+
+    bytecode_p++;
+  }
+} /* re_automaton_skip_alternatives */
+
+static uint8_t *re_automaton_compile_alternatives (re_automaton_ctx_t *ctx_p, uint8_t *bytecode_p,
+                                                   bool *is_nullable_p);
+static uint8_t *re_automaton_compile_sequence (re_automaton_ctx_t *ctx_p, uint8_t *bytecode_p,
+                                               uint8_t *bytecode_end_p, bool *is_nullable_p);
+
+/**
+ * Compile the body of a quantified atom or group once
+ */
+static void
+re_automaton_compile_body (re_automaton_ctx_t *ctx_p, /**< automaton compiler context */
+                           uint8_t *body_p, /**< start of the body */
+                           uint8_t *body_end_p, /**< end of the body if it is an atom,
+                                                 *   NULL if it is a group */
+                           uint32_t capture_idx, /**< index of the capture group, 0 if the body is not captured */
+                           uint32_t nested_idx, /**< index of the first capture group inside the body */
+                           uint32_t nested_count, /**< number of the capture groups which are reset
+                                                   *   before the body is matched */
+                           bool *is_nullable_p) /**< [out] the body can match the empty string */
+{
+  /* ECMA-262 v5, 15.10.2.5 (RepeatMatcher, step 4) */
+  for (uint32_t i = nested_idx * 2; i < (nested_idx + nested_count) * 2; i++)
+  {
+    re_automaton_emit (ctx_p, RE_AUTOMATON_CLEAR, i, 0);
+  }
+
+  if (capture_idx > 0)
+  {
+    re_automaton_emit (ctx_p, RE_AUTOMATON_SAVE, capture_idx * 2, 0);
+  }
+
+  if (body_end_p != NULL)
+  {
+    re_automaton_compile_sequence (ctx_p, body_p, body_end_p, is_nullable_p);
+  }
+  else
+  {
+    re_automaton_compile_alternatives (ctx_p, body_p, is_nullable_p);
+  }
+
+  if (capture_idx > 0)
+  {
+    re_automaton_emit (ctx_p, RE_AUTOMATON_SAVE, capture_idx * 2 + 1, 0);
+  }
+} /* re_automaton_compile_body */
+
+/**
+ * Compile a quantified atom or group
+ *
+ * The body is emitted min times, followed by a loop for infinite
+ * iterations or (max - min) optional copies otherwise. Each copy except
+ * the first one resets the capture groups inside the body.
+ */
+static void
+re_automaton_compile_quantified (re_automaton_ctx_t *ctx_p, /**< automaton compiler context */
+                                 uint8_t *body_p, /**< start of the body */
+                                 uint8_t *body_end_p, /**< end of the body if it is an atom,
+                                                       *   NULL if it is a group */
+                                 uint32_t capture_idx, /**< index of the capture group,
+                                                        *   0 if the body is not captured */
+                                 uint32_t min, /**< minimum number of iterations */
+                                 uint32_t max, /**< maximum number of iterations */
+                                 bool is_greedy, /**< greedy iteration */
+                                 bool *is_nullable_p) /**< [out] the quantified body can match the empty string */
+{
+  bool is_body_nullable = false;
+  bool is_body_compiled = false;
+  uint32_t nested_idx = 0;
+  uint32_t nested_count = 0;
+
+  if (max > 1 && body_end_p != NULL)
+  {
+    nested_count = re_automaton_find_captures (body_p, body_end_p, &nested_idx);
+  }
+  else if (max > 1)
+  {
+    /* The length of the first alternative is skipped. */
+    nested_count = re_automaton_find_captures (body_p + sizeof (uint32_t),
+                                               re_automaton_skip_alternatives (body_p),
+                                               &nested_idx);
+  }
+
+  for (uint32_t i = 0; i < min && ctx_p->is_supported; i++)
+  {
+    re_automaton_compile_body (ctx_p,
+                               body_p,
+                               body_end_p,
+                               capture_idx,
+                               nested_idx,
+                               (i > 0) ? nested_count : 0,
+                               &is_body_nullable);
+    is_body_compiled = true;
+  }
+
+  *is_nullable_p = (min == 0 || is_body_nullable);
+
+  if (max == RE_ITERATOR_INFINITE)
+  {
+    uint32_t split_idx = re_automaton_emit (ctx_p, RE_AUTOMATON_SPLIT, 0, 0);
+    re_automaton_compile_body (ctx_p,
+                               body_p,
+                               body_end_p,
+                               capture_idx,
+                               nested_idx,
+                               nested_count,
+                               &is_body_nullable);
+    re_automaton_emit (ctx_p, RE_AUTOMATON_JUMP, split_idx, 0);
+    is_body_compiled = true;
+
+    uint32_t body_idx = split_idx + 1;
+    ctx_p->inst_p[split_idx].arg = (uint16_t) (is_greedy ? body_idx : ctx_p->length);
+    ctx_p->inst_p[split_idx].value = is_greedy ? ctx_p->length : body_idx;
+  }
+  else
+  {
+    uint32_t first_idx = ctx_p->length;
+
+    for (uint32_t i = min; i < max && ctx_p->is_supported; i++)
+    {
+      uint32_t body_idx = ctx_p->length + 1;
+
+      re_automaton_emit (ctx_p,
+                         RE_AUTOMATON_SPLIT,
+                         is_greedy ? body_idx : RE_AUTOMATON_PENDING,
+                         is_greedy ? RE_AUTOMATON_PENDING : body_idx);
+      re_automaton_compile_body (ctx_p,
+                                 body_p,
+                                 body_end_p,
+                                 capture_idx,
+                                 nested_idx,
+                                 nested_count,
+                                 &is_body_nullable);
+      is_body_compiled = true;
+    }
+
+    re_automaton_resolve_pending (ctx_p, first_idx, ctx_p->length);
+  }
+
+  /* The backtracking matcher rejects the empty iterations above the minimum,
+   * which cannot be expressed by the automaton. */
+  if (is_body_compiled && is_body_nullable && min < max)
+  {
+    ctx_p->is_supported = false;
+  }
+} /* re_automaton_compile_quantified */
+
+/**
+ * Compile a sequence of terms
+ *
+ * @return pointer to the end of the sequence
+ */
+static uint8_t *
+re_automaton_compile_sequence (re_automaton_ctx_t *ctx_p, /**< automaton compiler context */
+                               uint8_t *bytecode_p, /**< start of the sequence */
+                               uint8_t *bytecode_end_p, /**< end of the sequence */
+                               bool *is_nullable_p) /**< [out] the sequence can match the empty string */
+{
+  bool is_nullable = true;
+
+  while (bytecode_p < bytecode_end_p && ctx_p->is_supported)
+  {
+    re_opcode_t op = re_get_opcode (&bytecode_p);
+
+    switch (op)
+    {
+      case RE_OP_CHAR:
+      {
+        re_automaton_emit (ctx_p, RE_AUTOMATON_CHAR, re_get_char (&bytecode_p), 0);
+        is_nullable = false;
+        break;
+      }
+      case RE_OP_PERIOD:
+      {
+        re_automaton_emit (ctx_p, RE_AUTOMATON_PERIOD, 0, 0);
+        is_nullable = false;
+        break;
+      }
+      case RE_OP_CHAR_CLASS:
+      case RE_OP_INV_CHAR_CLASS:
+      {
+        re_automaton_emit (ctx_p,
+                           (op == RE_OP_CHAR_CLASS) ? RE_AUTOMATON_CHAR_CLASS : RE_AUTOMATON_INV_CHAR_CLASS,
+                           0,
+                           (uint32_t) (bytecode_p - ctx_p->bytecode_start_p));
+
+        uint32_t num_of_ranges = re_get_value (&bytecode_p);
+        bytecode_p += num_of_ranges * 2 * sizeof (ecma_char_t);
+        is_nullable = false;
+        break;
+      }
+      case RE_OP_ASSERT_START:
+      {
+        re_automaton_emit (ctx_p, RE_AUTOMATON_ASSERT_START, 0, 0);
+        break;
+      }
+      case RE_OP_ASSERT_END:
+      {
+        re_automaton_emit (ctx_p, RE_AUTOMATON_ASSERT_END, 0, 0);
+        break;
+      }
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      {
+        re_automaton_emit (ctx_p, RE_AUTOMATON_ASSERT_WORD_BOUNDARY, 0, 0);
+        break;
+      }
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        re_automaton_emit (ctx_p, RE_AUTOMATON_ASSERT_NOT_WORD_BOUNDARY, 0, 0);
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_NON_GREEDY_ITERATOR:
+      {
+        uint32_t min = re_get_value (&bytecode_p);
+        uint32_t max = re_get_value (&bytecode_p);
+        uint32_t length = re_get_value (&bytecode_p);
+        uint8_t *atom_p = bytecode_p;
+        bool is_atom_nullable;
+
+        bytecode_p += length;
+
+        /* The atom is closed by an RE_OP_MATCH opcode. */
+        re_automaton_compile_quantified (ctx_p,
+                                         atom_p,
+                                         bytecode_p - 1,
+                                         0,
+                                         min,
+                                         max,
+                                         op == RE_OP_GREEDY_ITERATOR,
+                                         &is_atom_nullable);
+        is_nullable = is_nullable && is_atom_nullable;
+        break;
+      }
+      case RE_OP_CAPTURE_GROUP_START:
+      case RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START:
+      case RE_OP_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+      case RE_OP_NON_CAPTURE_GROUP_START:
+      case RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START:
+      case RE_OP_NON_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+      {
+        uint32_t idx = re_get_value (&bytecode_p);
+
+        if (op != RE_OP_CAPTURE_GROUP_START && op != RE_OP_NON_CAPTURE_GROUP_START)
+        {
+          re_get_value (&bytecode_p); /* end offset */
+        }
+
+        uint8_t *group_p = bytecode_p;
+        bytecode_p = re_automaton_skip_alternatives (bytecode_p);
+
+        re_opcode_t end_op = re_get_opcode (&bytecode_p);
+        JERRY_ASSERT (end_op >= RE_OP_CAPTURE_GREEDY_GROUP_END && end_op <= RE_OP_NON_CAPTURE_NON_GREEDY_GROUP_END);
+
+        re_get_value (&bytecode_p); /* group index */
+        uint32_t min = re_get_value (&bytecode_p);
+        uint32_t max = re_get_value (&bytecode_p);
+        re_get_value (&bytecode_p); /* start offset */
+
+        bool is_capture = (op < RE_OP_NON_CAPTURE_GROUP_START);
+        bool is_group_nullable;
+
+        re_automaton_compile_quantified (ctx_p,
+                                         group_p,
+                                         NULL,
+                                         is_capture ? idx : 0,
+                                         min,
+                                         max,
+                                         (end_op == RE_OP_CAPTURE_GREEDY_GROUP_END
+                                          || end_op == RE_OP_NON_CAPTURE_GREEDY_GROUP_END),
+                                         &is_group_nullable);
+        is_nullable = is_nullable && is_group_nullable;
+        break;
+      }
+      default:
+      {
+        ctx_p->is_supported = false;
+        break;
+      }
+    }
+  }
+
+  *is_nullable_p = is_nullable;
+  return bytecode_p;
+} /* re_automaton_compile_sequence */
+
+/**
+ * Compile the alternatives of a group or of the whole pattern
+ *
+ * @return pointer to the opcode after the alternatives
+ */
+static uint8_t *
+re_automaton_compile_alternatives (re_automaton_ctx_t *ctx_p, /**< automaton compiler context */
+                                   uint8_t *bytecode_p, /**< start of the first alternative */
+                                   bool *is_nullable_p) /**< [out] the alternatives can match the empty string */
+{
+  uint32_t first_idx = ctx_p->length;
+  bool is_nullable = false;
+
+  while (ctx_p->is_supported)
+  {
+    uint32_t length = re_get_value (&bytecode_p);
+    uint8_t *alternative_end_p = bytecode_p + length;
+    bool has_next = (*alternative_end_p == RE_OP_ALTERNATIVE);
+    uint32_t split_idx = 0;
+    bool is_alternative_nullable;
+
+    if (has_next)
+    {
+      split_idx = re_automaton_emit (ctx_p, RE_AUTOMATON_SPLIT, ctx_p->length + 1, RE_AUTOMATON_PENDING);
+    }
+
+    bytecode_p = re_automaton_compile_sequence (ctx_p, bytecode_p, alternative_end_p, &is_alternative_nullable);
+    is_nullable = is_nullable || is_alternative_nullable;
+
+    if (!has_next || !ctx_p->is_supported)
+    {
+      break;
+    }
+
+    /* Jump to the end of the alternatives. */
+    re_automaton_emit (ctx_p, RE_AUTOMATON_JUMP, RE_AUTOMATON_PENDING, 0);
+    ctx_p->inst_p[split_idx].value = ctx_p->length;
+
+    JERRY_ASSERT (*bytecode_p == RE_OP_ALTERNATIVE);
+    bytecode_p++;
+  }
+
+  re_automaton_resolve_pending (ctx_p, first_idx, ctx_p->length);
+
+  *is_nullable_p = is_nullable;
+  return bytecode_p;
+} /* re_automaton_compile_alternatives */
+
+/**
+ * Compile the linear-time automaton of a RegExp and append it to the compiled code
+ *
+ * Note:
+ *      the automaton is not created for RegExps with backreferences or lookaheads,
+ *      and for RegExps whose automaton would be too large
+ */
+void
+re_compile_automaton (re_bytecode_ctx_t *bc_ctx_p) /**< RegExp bytecode context */
+{
+  re_compiled_code_t *compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+  uint8_t *bytecode_p = (uint8_t *) (compiled_code_p + 1);
+
+  JERRY_ASSERT (compiled_code_p->automaton_offset == 0);
+
+  if (!re_automaton_is_supported_bytecode (bytecode_p))
+  {
+    return;
+  }
+
+  re_automaton_ctx_t ctx;
+  ctx.inst_p = (re_automaton_inst_t *) jmem_heap_alloc_block (RE_AUTOMATON_MAX_LENGTH * sizeof (re_automaton_inst_t));
+  ctx.bytecode_start_p = bc_ctx_p->block_start_p;
+  ctx.length = 0;
+  ctx.is_supported = true;
+
+  JERRY_ASSERT (*bytecode_p == RE_OP_SAVE_AT_START);
+  bytecode_p++;
+
+  bool is_nullable;
+
+  re_automaton_emit (&ctx, RE_AUTOMATON_SAVE, 0, 0);
+  bytecode_p = re_automaton_compile_alternatives (&ctx, bytecode_p, &is_nullable);
+  re_automaton_emit (&ctx, RE_AUTOMATON_SAVE, 1, 0);
+  re_automaton_emit (&ctx, RE_AUTOMATON_MATCH, 0, 0);
+
+  if (ctx.is_supported
+      && ctx.length * compiled_code_p->num_of_captures <= RE_AUTOMATON_MAX_SAVED_POINTERS)
+  {
+    JERRY_ASSERT (*bytecode_p == RE_OP_SAVE_AND_MATCH);
+
+    uint32_t automaton_offset = re_get_bytecode_length (bc_ctx_p);
+
+    while (automaton_offset % sizeof (uint32_t) != 0)
+    {
+      uint8_t padding = 0;
+      re_bytecode_list_append (bc_ctx_p, &padding, sizeof (uint8_t));
+      automaton_offset++;
+    }
+
+    for (uint32_t i = 0; i < ctx.length; i++)
+    {
+      re_bytecode_list_append (bc_ctx_p, (uint8_t *) (ctx.inst_p + i), sizeof (re_automaton_inst_t));
+    }
+
+    /* The bytecode block might be reallocated. */
+    compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+    compiled_code_p->automaton_offset = automaton_offset;
+    compiled_code_p->automaton_length = ctx.length;
+  }
+
+  jmem_heap_free_block (ctx.inst_p, RE_AUTOMATON_MAX_LENGTH * sizeof (re_automaton_inst_t));
+} /* re_compile_automaton */
+
+#ifdef REGEXP_DUMP_BYTE_CODE
+/**
+ * RegExp automaton dumper
+ */
+void
+re_dump_automaton (const re_compiled_code_t *compiled_code_p) /**< compiled RegExp */
+{
+  if (compiled_code_p->automaton_offset == 0)
+  {
+    JERRY_DEBUG_MSG ("No automaton\n");
+    return;
+  }
+
+  const re_automaton_inst_t *inst_p = RE_AUTOMATON_GET_INSTRUCTIONS (compiled_code_p);
+
+  JERRY_DEBUG_MSG ("Automaton:\n");
+
+  for (uint32_t i = 0; i < compiled_code_p->automaton_length; i++, inst_p++)
+  {
+    JERRY_DEBUG_MSG ("  %3d: ", (int) i);
+
+    switch (inst_p->opcode)
+    {
+      case RE_AUTOMATON_MATCH:
+      {
+        JERRY_DEBUG_MSG ("MATCH\n");
+        break;
+      }
+      case RE_AUTOMATON_CHAR:
+      {
+        JERRY_DEBUG_MSG ("CHAR %d\n", (int) inst_p->arg);
+        break;
+      }
+      case RE_AUTOMATON_PERIOD:
+      {
+        JERRY_DEBUG_MSG ("PERIOD\n");
+        break;
+      }
+      case RE_AUTOMATON_CHAR_CLASS:
+      {
+        JERRY_DEBUG_MSG ("CHAR_CLASS %d\n", (int) inst_p->value);
+        break;
+      }
+      case RE_AUTOMATON_INV_CHAR_CLASS:
+      {
+        JERRY_DEBUG_MSG ("INV_CHAR_CLASS %d\n", (int) inst_p->value);
+        break;
+      }
+      case RE_AUTOMATON_ASSERT_START:
+      {
+        JERRY_DEBUG_MSG ("ASSERT_START\n");
+        break;
+      }
+      case RE_AUTOMATON_ASSERT_END:
+      {
+        JERRY_DEBUG_MSG ("ASSERT_END\n");
+        break;
+      }
+      case RE_AUTOMATON_ASSERT_WORD_BOUNDARY:
+      {
+        JERRY_DEBUG_MSG ("ASSERT_WORD_BOUNDARY\n");
+        break;
+      }
+      case RE_AUTOMATON_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        JERRY_DEBUG_MSG ("ASSERT_NOT_WORD_BOUNDARY\n");
+        break;
+      }
+      case RE_AUTOMATON_SAVE:
+      {
+        JERRY_DEBUG_MSG ("SAVE %d\n", (int) inst_p->arg);
+        break;
+      }
+      case RE_AUTOMATON_CLEAR:
+      {
+        JERRY_DEBUG_MSG ("CLEAR %d\n", (int) inst_p->arg);
+        break;
+      }
+      case RE_AUTOMATON_JUMP:
+      {
+        JERRY_DEBUG_MSG ("JUMP %d\n", (int) inst_p->arg);
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (inst_p->opcode == RE_AUTOMATON_SPLIT);
+        JERRY_DEBUG_MSG ("SPLIT %d %d\n", (int) inst_p->arg, (int) inst_p->value);
+        break;
+      }
+    }
+  }
+} /* re_dump_automaton */
+#endif /* REGEXP_DUMP_BYTE_CODE */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
@@ -0,0 +1,103 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RE_AUTOMATON_H
+#define RE_AUTOMATON_H
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+
+#include "ecma-globals.h"
+#include "re-bytecode.h"
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup regexparser Regular expression
+ * @{
+ *
+ * \addtogroup regexparser_automaton Automaton
+ * @{
+ */
+
+/**
+ * Maximum number of instructions of a RegExp automaton
+ */
+#define RE_AUTOMATON_MAX_LENGTH 256u
+
+/**
+ * Maximum number of saved string pointers in a thread list of the automaton
+ * (number of instructions multiplied by the number of capture pointers)
+ */
+#define RE_AUTOMATON_MAX_SAVED_POINTERS 1024u
+
+/**
+ * RegExp automaton opcodes
+ */
+typedef enum
+{
+  RE_AUTOMATON_MATCH,                     /**< match */
+  RE_AUTOMATON_CHAR,                      /**< character (already canonicalized) */
+  RE_AUTOMATON_PERIOD,                    /**< "." */
+  RE_AUTOMATON_CHAR_CLASS,                /**< "[ ]" */
+  RE_AUTOMATON_INV_CHAR_CLASS,            /**< "[^ ]" */
+  RE_AUTOMATON_ASSERT_START,              /**< "^" */
+  RE_AUTOMATON_ASSERT_END,                /**< "$" */
+  RE_AUTOMATON_ASSERT_WORD_BOUNDARY,      /**< "\b" */
+  RE_AUTOMATON_ASSERT_NOT_WORD_BOUNDARY,  /**< "\B" */
+  RE_AUTOMATON_SAVE,                      /**< save current position into a capture pointer */
+  RE_AUTOMATON_JUMP,                      /**< jump */
+  RE_AUTOMATON_SPLIT,                     /**< continue on two paths, the first one has higher priority */
+  RE_AUTOMATON_CLEAR,                     /**< reset a capture pointer to undefined */
+} re_automaton_opcode_t;
+
+/**
+ * RegExp automaton instruction
+ *
+ * Meaning of the arguments:
+ *   RE_AUTOMATON_CHAR:                 arg is the character
+ *   RE_AUTOMATON_[INV_]CHAR_CLASS:     value is the offset of the ranges from the start of the compiled code
+ *   RE_AUTOMATON_SAVE:                 arg is the index of the capture pointer
+ *   RE_AUTOMATON_CLEAR:                arg is the index of the capture pointer
+ *   RE_AUTOMATON_JUMP:                 arg is the target instruction
+ *   RE_AUTOMATON_SPLIT:                arg is the preferred, value is the other target instruction
+ */
+typedef struct
+{
+  uint8_t opcode;                    /**< re_automaton_opcode_t */
+  uint16_t arg;                      /**< first argument */
+  uint32_t value;                    /**< second argument */
+} re_automaton_inst_t;
+
+/**
+ * Get the first instruction of the automaton of a compiled RegExp
+ */
+#define RE_AUTOMATON_GET_INSTRUCTIONS(bytecode_p) \
+  ((const re_automaton_inst_t *) (((const uint8_t *) (bytecode_p)) + (bytecode_p)->automaton_offset))
+
+void re_compile_automaton (re_bytecode_ctx_t *);
+
+#ifdef REGEXP_DUMP_BYTE_CODE
+void re_dump_automaton (const re_compiled_code_t *);
+#endif /* REGEXP_DUMP_BYTE_CODE */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+#endif /* !RE_AUTOMATON_H */
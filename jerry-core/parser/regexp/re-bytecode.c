@@ -70,7 +70,7 @@ re_realloc_regexp_bytecode_block (re_bytecode_ctx_t *bc_ctx_p) /**< RegExp bytec
 /**
  * Append a new bytecode to the and of the bytecode container
  */
-static void
+void
 re_bytecode_list_append (re_bytecode_ctx_t *bc_ctx_p, /**< RegExp bytecode context */
                          uint8_t *bytecode_p, /**< input bytecode */
                          size_t length) /**< length of input */
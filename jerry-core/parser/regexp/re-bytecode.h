@@ -31,16 +31,21 @@
  * @{
  */
 
-/**
-  * Size of the RegExp bytecode cache
-  */
-#define RE_CACHE_SIZE 8u
-
 /**
   * RegExp flags mask (first 10 bits are for reference count and the rest for the actual RegExp flags)
   */
 #define RE_FLAGS_MASK 0x3F
 
+/**
+ * Maximum size of the literal prefix of a compiled RegExp
+ */
+#define RE_PREFIX_MAX_SIZE 32u
+
+/**
+ * Size of the first character set of a compiled RegExp (one bit for each possible first byte of a match)
+ */
+#define RE_FIRST_CHAR_SET_SIZE (256u / 8u)
+
 /**
  * RegExp opcodes
  */
@@ -89,6 +94,14 @@ typedef struct
   jmem_cpointer_t pattern_cp;        /**< original RegExp pattern */
   uint32_t num_of_captures;          /**< number of capturing brackets */
   uint32_t num_of_non_captures;      /**< number of non capturing brackets */
+  uint32_t automaton_offset;         /**< offset of the linear-time automaton from the start of
+                                      *   the compiled code (0 - if the RegExp has no automaton) */
+  uint32_t automaton_length;         /**< number of automaton instructions */
+  uint32_t prefix_offset;            /**< offset of the literal prefix of all matches from the start
+                                      *   of the compiled code (0 - if the RegExp has no prefix) */
+  uint32_t prefix_size;              /**< size of the literal prefix in bytes */
+  uint32_t first_char_set_offset;    /**< offset of the set of the possible first bytes of a match from
+                                      *   the start of the compiled code (0 - if a match can start anywhere) */
 } re_compiled_code_t;
 
 /**
@@ -113,6 +126,7 @@ void re_append_jump_offset (re_bytecode_ctx_t *, uint32_t);
 
 void re_insert_opcode (re_bytecode_ctx_t *, uint32_t, re_opcode_t);
 void re_insert_u32 (re_bytecode_ctx_t *, uint32_t, uint32_t);
+void re_bytecode_list_append (re_bytecode_ctx_t *, uint8_t *, size_t);
 void re_bytecode_list_insert (re_bytecode_ctx_t *, size_t, uint8_t *, size_t);
 
 #ifdef REGEXP_DUMP_BYTE_CODE
@@ -0,0 +1,403 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jmem-heap.h"
+#include "re-cache.h"
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+
+JERRY_STATIC_ASSERT (CONFIG_REGEXP_CACHE_SIZE <= RE_CACHE_MAX_SIZE,
+                     config_regexp_cache_size_must_not_exceed_re_cache_max_size);
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup regexparser Regular expression
+ * @{
+ *
+ * \addtogroup regexparser_cache Bytecode cache
+ * @{
+ */
+
+/**
+ * Get the bucket heads of the RegExp cache, which are stored after the entries
+ */
+#define RE_CACHE_GET_BUCKETS() \
+  ((uint16_t *) (JERRY_CONTEXT (re_cache_p) + JERRY_CONTEXT (re_cache_size)))
+
+/**
+ * Calculate the number of hash buckets (a power of 2, not less than the capacity)
+ *
+ * @return number of buckets
+ */
+static uint32_t
+re_cache_get_bucket_count (uint32_t size) /**< capacity of the cache */
+{
+  uint32_t bucket_count = 1;
+
+  while (bucket_count < size)
+  {
+    bucket_count <<= 1;
+  }
+
+  return bucket_count;
+} /* re_cache_get_bucket_count */
+
+/**
+ * Calculate the size of the memory block of the RegExp cache
+ *
+ * @return size in bytes
+ */
+static size_t
+re_cache_get_block_size (uint32_t size) /**< capacity of the cache */
+{
+  return (size * sizeof (re_cache_entry_t) + re_cache_get_bucket_count (size) * sizeof (uint16_t));
+} /* re_cache_get_block_size */
+
+/**
+ * Get the hash bucket of a pattern and flags pair
+ *
+ * @return bucket index
+ */
+static inline uint32_t __attr_always_inline___
+re_cache_get_bucket (ecma_string_t *pattern_str_p, /**< pattern string */
+                     uint16_t flags) /**< flags */
+{
+  uint32_t hash = (uint32_t) ecma_string_hash (pattern_str_p) ^ ((uint32_t) flags * 0x9e5u);
+  return hash & (re_cache_get_bucket_count (JERRY_CONTEXT (re_cache_size)) - 1);
+} /* re_cache_get_bucket */
+
+/**
+ * Allocate the entries and the bucket heads of the RegExp cache
+ *
+ * @return true - if the cache is available
+ *         false - otherwise
+ */
+static bool
+re_cache_alloc (void)
+{
+  if (JERRY_CONTEXT (re_cache_p) != NULL)
+  {
+    return true;
+  }
+
+  uint32_t size = JERRY_CONTEXT (re_cache_size);
+
+  if (size == 0)
+  {
+    return false;
+  }
+
+  re_cache_entry_t *entries_p;
+  entries_p = (re_cache_entry_t *) jmem_heap_alloc_block_null_on_error (re_cache_get_block_size (size));
+
+  if (entries_p == NULL)
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < size; i++)
+  {
+    entries_p[i].bytecode_p = NULL;
+    entries_p[i].lru_next = (uint16_t) (i + 1 < size ? i + 1 : RE_CACHE_INVALID_INDEX);
+  }
+
+  JERRY_CONTEXT (re_cache_p) = entries_p;
+  JERRY_CONTEXT (re_cache_lru_first) = RE_CACHE_INVALID_INDEX;
+  JERRY_CONTEXT (re_cache_lru_last) = RE_CACHE_INVALID_INDEX;
+  JERRY_CONTEXT (re_cache_free_first) = 0;
+
+  uint16_t *buckets_p = RE_CACHE_GET_BUCKETS ();
+  uint32_t bucket_count = re_cache_get_bucket_count (size);
+
+  for (uint32_t i = 0; i < bucket_count; i++)
+  {
+    buckets_p[i] = RE_CACHE_INVALID_INDEX;
+  }
+
+  return true;
+} /* re_cache_alloc */
+
+/**
+ * Unlink an entry from the recency list
+ */
+static void
+re_cache_lru_unlink (uint16_t idx) /**< entry index */
+{
+  re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
+  re_cache_entry_t *entry_p = entries_p + idx;
+
+  if (entry_p->lru_prev != RE_CACHE_INVALID_INDEX)
+  {
+    entries_p[entry_p->lru_prev].lru_next = entry_p->lru_next;
+  }
+  else
+  {
+    JERRY_CONTEXT (re_cache_lru_first) = entry_p->lru_next;
+  }
+
+  if (entry_p->lru_next != RE_CACHE_INVALID_INDEX)
+  {
+    entries_p[entry_p->lru_next].lru_prev = entry_p->lru_prev;
+  }
+  else
+  {
+    JERRY_CONTEXT (re_cache_lru_last) = entry_p->lru_prev;
+  }
+} /* re_cache_lru_unlink */
+
+/**
+ * Insert an entry to the front (most recently used end) of the recency list
+ */
+static void
+re_cache_lru_push_front (uint16_t idx) /**< entry index */
+{
+  re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
+  uint16_t first = JERRY_CONTEXT (re_cache_lru_first);
+
+  entries_p[idx].lru_prev = RE_CACHE_INVALID_INDEX;
+  entries_p[idx].lru_next = first;
+
+  if (first != RE_CACHE_INVALID_INDEX)
+  {
+    entries_p[first].lru_prev = idx;
+  }
+  else
+  {
+    JERRY_CONTEXT (re_cache_lru_last) = idx;
+  }
+
+  JERRY_CONTEXT (re_cache_lru_first) = idx;
+} /* re_cache_lru_push_front */
+
+/**
+ * Remove an entry from the cache and release its bytecode
+ */
+static void
+re_cache_remove (uint16_t idx) /**< entry index */
+{
+  re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
+  re_cache_entry_t *entry_p = entries_p + idx;
+  const re_compiled_code_t *bytecode_p = entry_p->bytecode_p;
+
+  JERRY_ASSERT (bytecode_p != NULL);
+
+  ecma_string_t *pattern_str_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, bytecode_p->pattern_cp);
+  uint16_t flags = (uint16_t) (bytecode_p->header.status_flags & RE_FLAGS_MASK);
+  uint16_t *link_p = RE_CACHE_GET_BUCKETS () + re_cache_get_bucket (pattern_str_p, flags);
+
+  while (*link_p != idx)
+  {
+    JERRY_ASSERT (*link_p != RE_CACHE_INVALID_INDEX);
+    link_p = &entries_p[*link_p].bucket_next;
+  }
+
+  *link_p = entry_p->bucket_next;
+
+  re_cache_lru_unlink (idx);
+
+  entry_p->bytecode_p = NULL;
+  entry_p->lru_next = JERRY_CONTEXT (re_cache_free_first);
+  JERRY_CONTEXT (re_cache_free_first) = idx;
+  JERRY_CONTEXT (re_cache_count)--;
+
+  ecma_bytecode_deref ((ecma_compiled_code_t *) bytecode_p);
+} /* re_cache_remove */
+
+/**
+ * Remove all entries and free the memory of the RegExp cache
+ */
+static void
+re_cache_free (void)
+{
+  if (JERRY_CONTEXT (re_cache_p) == NULL)
+  {
+    return;
+  }
+
+  while (JERRY_CONTEXT (re_cache_lru_first) != RE_CACHE_INVALID_INDEX)
+  {
+    re_cache_remove (JERRY_CONTEXT (re_cache_lru_first));
+  }
+
+  JERRY_ASSERT (JERRY_CONTEXT (re_cache_count) == 0);
+
+  jmem_heap_free_block (JERRY_CONTEXT (re_cache_p), re_cache_get_block_size (JERRY_CONTEXT (re_cache_size)));
+  JERRY_CONTEXT (re_cache_p) = NULL;
+} /* re_cache_free */
+
+/**
+ * Initialize the RegExp cache
+ *
+ * Note:
+ *      memory is allocated only when the first bytecode is inserted
+ */
+void
+re_cache_init (void)
+{
+  JERRY_CONTEXT (re_cache_p) = NULL;
+  JERRY_CONTEXT (re_cache_size) = CONFIG_REGEXP_CACHE_SIZE;
+  JERRY_CONTEXT (re_cache_count) = 0;
+} /* re_cache_init */
+
+/**
+ * Release all cached bytecodes and free the RegExp cache
+ */
+void
+re_cache_finalize (void)
+{
+  re_cache_free ();
+} /* re_cache_finalize */
+
+/**
+ * Change the capacity of the RegExp cache
+ *
+ * Note:
+ *      the cached bytecodes are released, zero size disables the cache,
+ *      sizes above RE_CACHE_MAX_SIZE are reduced to RE_CACHE_MAX_SIZE
+ */
+void
+re_cache_set_size (uint32_t size) /**< new capacity */
+{
+  re_cache_free ();
+  JERRY_CONTEXT (re_cache_size) = JERRY_MIN (size, RE_CACHE_MAX_SIZE);
+} /* re_cache_set_size */
+
+/**
+ * Search for the given pattern and flags in the RegExp cache
+ *
+ * @return referenced bytecode - if found
+ *         NULL                - otherwise
+ */
+const re_compiled_code_t *
+re_cache_lookup (ecma_string_t *pattern_str_p, /**< pattern string */
+                 uint16_t flags) /**< flags */
+{
+  if (JERRY_CONTEXT (re_cache_p) != NULL)
+  {
+    re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
+    uint16_t idx = RE_CACHE_GET_BUCKETS ()[re_cache_get_bucket (pattern_str_p, flags)];
+
+    while (idx != RE_CACHE_INVALID_INDEX)
+    {
+      const re_compiled_code_t *cached_bytecode_p = entries_p[idx].bytecode_p;
+      ecma_string_t *cached_pattern_str_p;
+      cached_pattern_str_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, cached_bytecode_p->pattern_cp);
+
+      if ((cached_bytecode_p->header.status_flags & RE_FLAGS_MASK) == flags
+          && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
+      {
+        JERRY_TRACE_MSG ("RegExp is found in cache\n");
+
+        if (JERRY_CONTEXT (re_cache_lru_first) != idx)
+        {
+          re_cache_lru_unlink (idx);
+          re_cache_lru_push_front (idx);
+        }
+
+        JERRY_CONTEXT (re_cache_stats).hits++;
+        ecma_bytecode_ref ((ecma_compiled_code_t *) cached_bytecode_p);
+        return cached_bytecode_p;
+      }
+
+      idx = entries_p[idx].bucket_next;
+    }
+  }
+
+  JERRY_TRACE_MSG ("RegExp is NOT found in cache\n");
+  JERRY_CONTEXT (re_cache_stats).misses++;
+  return NULL;
+} /* re_cache_lookup */
+
+/**
+ * Insert a newly compiled bytecode into the RegExp cache
+ *
+ * Note:
+ *      the least recently used entry is evicted if the cache is full
+ */
+void
+re_cache_insert (const re_compiled_code_t *bytecode_p) /**< bytecode */
+{
+  if (!re_cache_alloc ())
+  {
+    return;
+  }
+
+  if (JERRY_CONTEXT (re_cache_free_first) == RE_CACHE_INVALID_INDEX)
+  {
+    JERRY_TRACE_MSG ("RegExp cache is full! Remove the least recently used element (idx: %d)\n",
+                     JERRY_CONTEXT (re_cache_lru_last));
+
+    re_cache_remove (JERRY_CONTEXT (re_cache_lru_last));
+    JERRY_CONTEXT (re_cache_stats).evictions++;
+  }
+
+  re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
+  uint16_t idx = JERRY_CONTEXT (re_cache_free_first);
+  JERRY_CONTEXT (re_cache_free_first) = entries_p[idx].lru_next;
+
+  JERRY_TRACE_MSG ("Insert bytecode into RegExp cache (idx: %d).\n", idx);
+
+  ecma_string_t *pattern_str_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, bytecode_p->pattern_cp);
+  uint16_t flags = (uint16_t) (bytecode_p->header.status_flags & RE_FLAGS_MASK);
+  uint16_t *bucket_p = RE_CACHE_GET_BUCKETS () + re_cache_get_bucket (pattern_str_p, flags);
+
+  ecma_bytecode_ref ((ecma_compiled_code_t *) bytecode_p);
+  entries_p[idx].bytecode_p = bytecode_p;
+  entries_p[idx].bucket_next = *bucket_p;
+  *bucket_p = idx;
+
+  re_cache_lru_push_front (idx);
+  JERRY_CONTEXT (re_cache_count)++;
+} /* re_cache_insert */
+
+/**
+ * Run garbage collection in RegExp cache
+ */
+void
+re_cache_gc_run (void)
+{
+  if (JERRY_CONTEXT (re_cache_p) == NULL)
+  {
+    return;
+  }
+
+  uint16_t idx = JERRY_CONTEXT (re_cache_lru_first);
+
+  while (idx != RE_CACHE_INVALID_INDEX)
+  {
+    re_cache_entry_t *entry_p = JERRY_CONTEXT (re_cache_p) + idx;
+    uint16_t next_idx = entry_p->lru_next;
+
+    if (entry_p->bytecode_p->header.refs == 1)
+    {
+      /* Only the cache has reference for the bytecode */
+      re_cache_remove (idx);
+    }
+
+    idx = next_idx;
+  }
+} /* re_cache_gc_run */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
@@ -0,0 +1,87 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RE_CACHE_H
+#define RE_CACHE_H
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+
+#include "ecma-globals.h"
+#include "re-bytecode.h"
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup regexparser Regular expression
+ * @{
+ *
+ * \addtogroup regexparser_cache Bytecode cache
+ * @{
+ */
+
+/**
+ * Maximum capacity of the RegExp cache
+ *
+ * Note:
+ *      CONFIG_REGEXP_CACHE_SIZE must not exceed this value,
+ *      larger sizes passed to re_cache_set_size are reduced to it
+ */
+#define RE_CACHE_MAX_SIZE 1024u
+
+/**
+ * Marks the end of the bucket and recency lists of the RegExp cache
+ */
+#define RE_CACHE_INVALID_INDEX UINT16_MAX
+
+/**
+ * Entry of the RegExp cache
+ *
+ * Used entries are linked into a hash bucket (by pattern and flags) and
+ * into the recency list, free entries are linked by their lru_next field.
+ */
+typedef struct
+{
+  const re_compiled_code_t *bytecode_p; /**< cached bytecode */
+  uint16_t bucket_next;                 /**< next entry in the same hash bucket */
+  uint16_t lru_prev;                    /**< more recently used entry */
+  uint16_t lru_next;                    /**< less recently used entry */
+} re_cache_entry_t;
+
+/**
+ * Usage statistics of the RegExp cache
+ */
+typedef struct
+{
+  uint32_t hits;                        /**< number of lookups found in the cache */
+  uint32_t misses;                      /**< number of lookups not found in the cache */
+  uint32_t evictions;                   /**< number of entries dropped to make room for a new one */
+} re_cache_stats_t;
+
+void re_cache_init (void);
+void re_cache_finalize (void);
+void re_cache_set_size (uint32_t);
+const re_compiled_code_t *re_cache_lookup (ecma_string_t *, uint16_t);
+void re_cache_insert (const re_compiled_code_t *);
+void re_cache_gc_run (void);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+#endif /* !RE_CACHE_H */
@@ -21,7 +21,10 @@
 #include "jcontext.h"
 #include "jrt-libc-includes.h"
 #include "jmem-heap.h"
+#include "lit-char-helpers.h"
+#include "re-automaton.h"
 #include "re-bytecode.h"
+#include "re-cache.h"
 #include "re-compiler.h"
 #include "re-parser.h"
 
@@ -446,63 +449,313 @@ re_parse_alternative (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context
 } /* re_parse_alternative */
 
 /**
- * Search for the given pattern in the RegExp cache
+ * Context of the first character set computation
+ */
+typedef struct
+{
+  uint8_t set[RE_FIRST_CHAR_SET_SIZE];   /**< possible first bytes of a match */
+  bool is_ignorecase;                    /**< IgnoreCase flag */
+  bool is_supported;                     /**< the set can be computed for the RegExp */
+} re_first_char_ctx_t;
+
+/**
+ * Add the first bytes of the characters, whose canonicalized value is in a range, to the first character set
  *
- * @return index of bytecode in cache - if found
- *         RE_CACHE_SIZE              - otherwise
+ * Note:
+ *      the CESU-8 representation of non-ASCII characters never starts with an ASCII byte,
+ *      and the lead bytes are increasing with the code units
  */
-static uint8_t
-re_find_bytecode_in_cache (ecma_string_t *pattern_str_p, /**< pattern string */
-                           uint16_t flags) /**< flags */
+static void
+re_first_char_set_add_range (re_first_char_ctx_t *ctx_p, /**< first character set context */
+                             ecma_char_t from, /**< canonicalized range from */
+                             ecma_char_t to) /**< canonicalized range to */
 {
-  uint8_t free_idx = RE_CACHE_SIZE;
+  for (ecma_char_t ch = 0; ch <= LIT_UTF8_1_BYTE_CODE_POINT_MAX; ch++)
+  {
+    ecma_char_t canonical_ch = re_canonicalize (ch, ctx_p->is_ignorecase);
+
+    if (canonical_ch >= from && canonical_ch <= to)
+    {
+      ctx_p->set[ch >> 3] = (uint8_t) (ctx_p->set[ch >> 3] | (1u << (ch & 0x7)));
+    }
+  }
+
+  if (to <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    return;
+  }
+
+  lit_utf8_byte_t first_lead_byte = LIT_UTF8_2_BYTE_MARKER;
+  lit_utf8_byte_t last_lead_byte = 0xff;
 
-  for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
+  if (!ctx_p->is_ignorecase)
   {
-    const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[idx];
+    /* Other characters might have the same canonical value, so all lead bytes are possible with ignore case. */
+    lit_utf8_byte_t buf[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
 
-    if (cached_bytecode_p != NULL)
+    if (from > LIT_UTF8_1_BYTE_CODE_POINT_MAX)
     {
-      ecma_string_t *cached_pattern_str_p;
-      cached_pattern_str_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, cached_bytecode_p->pattern_cp);
+      lit_code_unit_to_utf8 (from, buf);
+      first_lead_byte = buf[0];
+    }
+
+    lit_code_unit_to_utf8 (to, buf);
+    last_lead_byte = buf[0];
+  }
+
+  for (uint32_t byte = first_lead_byte; byte <= last_lead_byte; byte++)
+  {
+    ctx_p->set[byte >> 3] = (uint8_t) (ctx_p->set[byte >> 3] | (1u << (byte & 0x7)));
+  }
+} /* re_first_char_set_add_range */
+
+static uint8_t *re_first_char_set_add_alternatives (re_first_char_ctx_t *ctx_p, uint8_t *bytecode_p,
+                                                    bool *is_nullable_p);
+
+/**
+ * Add the possible first characters of a sequence of terms to the first character set
+ *
+ * @return true - if the sequence can match the empty string
+ *         false - otherwise
+ */
+static bool
+re_first_char_set_add_sequence (re_first_char_ctx_t *ctx_p, /**< first character set context */
+                                uint8_t *bytecode_p, /**< start of the sequence */
+                                uint8_t *bytecode_end_p) /**< end of the sequence */
+{
+  while (bytecode_p < bytecode_end_p && ctx_p->is_supported)
+  {
+    re_opcode_t op = re_get_opcode (&bytecode_p);
 
-      if ((cached_bytecode_p->header.status_flags & RE_FLAGS_MASK) == flags
-          && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
+    switch (op)
+    {
+      case RE_OP_CHAR:
       {
-        JERRY_TRACE_MSG ("RegExp is found in cache\n");
-        return idx;
+        /* Already canonicalized. */
+        ecma_char_t ch = re_get_char (&bytecode_p);
+        re_first_char_set_add_range (ctx_p, ch, ch);
+        return false;
+      }
+      case RE_OP_CHAR_CLASS:
+      {
+        uint32_t num_of_ranges = re_get_value (&bytecode_p);
+
+        while (num_of_ranges--)
+        {
+          ecma_char_t from = re_canonicalize (re_get_char (&bytecode_p), ctx_p->is_ignorecase);
+          ecma_char_t to = re_canonicalize (re_get_char (&bytecode_p), ctx_p->is_ignorecase);
+          re_first_char_set_add_range (ctx_p, from, to);
+        }
+        return false;
+      }
+      case RE_OP_ASSERT_START:
+      case RE_OP_ASSERT_END:
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_NON_GREEDY_ITERATOR:
+      {
+        uint32_t min = re_get_value (&bytecode_p);
+        re_get_value (&bytecode_p); /* max */
+        uint32_t length = re_get_value (&bytecode_p);
+
+        /* The atom is closed by an RE_OP_MATCH opcode. */
+        bool is_atom_nullable = re_first_char_set_add_sequence (ctx_p, bytecode_p, bytecode_p + length - 1);
+        bytecode_p += length;
+
+        if (min > 0 && !is_atom_nullable)
+        {
+          return false;
+        }
+        break;
+      }
+      case RE_OP_CAPTURE_GROUP_START:
+      case RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START:
+      case RE_OP_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+      case RE_OP_NON_CAPTURE_GROUP_START:
+      case RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START:
+      case RE_OP_NON_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+      {
+        re_get_value (&bytecode_p); /* group index */
+
+        if (op != RE_OP_CAPTURE_GROUP_START && op != RE_OP_NON_CAPTURE_GROUP_START)
+        {
+          re_get_value (&bytecode_p); /* end offset */
+        }
+
+        bool is_group_nullable;
+        bytecode_p = re_first_char_set_add_alternatives (ctx_p, bytecode_p, &is_group_nullable);
+
+        re_opcode_t end_op = re_get_opcode (&bytecode_p);
+        JERRY_ASSERT (end_op >= RE_OP_CAPTURE_GREEDY_GROUP_END && end_op <= RE_OP_NON_CAPTURE_NON_GREEDY_GROUP_END);
+        JERRY_UNUSED (end_op);
+
+        re_get_value (&bytecode_p); /* group index */
+        uint32_t min = re_get_value (&bytecode_p);
+        re_get_value (&bytecode_p); /* max */
+        re_get_value (&bytecode_p); /* start offset */
+
+        if (min > 0 && !is_group_nullable)
+        {
+          return false;
+        }
+        break;
+      }
+      default:
+      {
+        /* A match can start with any character after a period, an inverted class,
+         * a backreference or a lookahead, so the set is not computed. */
+        ctx_p->is_supported = false;
+        break;
       }
     }
-    else
+  }
+
+  return true;
+} /* re_first_char_set_add_sequence */
+
+/**
+ * Add the possible first characters of the alternatives of a group or
+ * of the whole pattern to the first character set
+ *
+ * @return pointer to the opcode after the alternatives
+ */
+static uint8_t *
+re_first_char_set_add_alternatives (re_first_char_ctx_t *ctx_p, /**< first character set context */
+                                    uint8_t *bytecode_p, /**< start of the first alternative */
+                                    bool *is_nullable_p) /**< [out] the alternatives can match the empty string */
+{
+  bool is_nullable = false;
+
+  while (true)
+  {
+    uint32_t length = re_get_value (&bytecode_p);
+    uint8_t *alternative_end_p = bytecode_p + length;
+
+    if (ctx_p->is_supported && re_first_char_set_add_sequence (ctx_p, bytecode_p, alternative_end_p))
+    {
+      is_nullable = true;
+    }
+
+    bytecode_p = alternative_end_p;
+
+    if (*bytecode_p != RE_OP_ALTERNATIVE)
     {
-      /* mark as free, so it can be overridden if the cache is full */
-      free_idx = idx;
+      break;
     }
+
+    bytecode_p++;
+  }
+
+  *is_nullable_p = is_nullable;
+  return bytecode_p;
+} /* re_first_char_set_add_alternatives */
+
+/**
+ * Compute the literal prefix or the first character set of a RegExp and append it to the compiled code,
+ * so the matcher is started only at the positions where a match can begin
+ */
+static void
+re_compile_first_char_info (re_bytecode_ctx_t *bc_ctx_p) /**< RegExp bytecode context */
+{
+  re_compiled_code_t *compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+  uint8_t *bytecode_p = (uint8_t *) (compiled_code_p + 1);
+  bool is_ignorecase = (compiled_code_p->header.status_flags & RE_FLAG_IGNORE_CASE) != 0;
+
+  JERRY_ASSERT (*bytecode_p == RE_OP_SAVE_AT_START);
+  bytecode_p++;
+
+  /* 1. The characters at the start of the pattern form the prefix, if the pattern has no alternatives. */
+  lit_utf8_byte_t prefix[RE_PREFIX_MAX_SIZE];
+  lit_utf8_size_t prefix_size = 0;
+  uint8_t *alternative_p = bytecode_p;
+  uint32_t length = re_get_value (&alternative_p);
+  uint8_t *alternative_end_p = alternative_p + length;
+
+  if (!is_ignorecase && *alternative_end_p != RE_OP_ALTERNATIVE)
+  {
+    while (alternative_p < alternative_end_p && *alternative_p == RE_OP_CHAR)
+    {
+      alternative_p++;
+      ecma_char_t ch = re_get_char (&alternative_p);
+
+      if (prefix_size + lit_char_get_utf8_length (ch) > RE_PREFIX_MAX_SIZE)
+      {
+        break;
+      }
+
+      prefix_size += lit_code_unit_to_utf8 (ch, prefix + prefix_size);
+    }
+  }
+
+  if (prefix_size > 0)
+  {
+    uint32_t prefix_offset = re_get_bytecode_length (bc_ctx_p);
+    re_bytecode_list_append (bc_ctx_p, prefix, prefix_size);
+
+    /* The bytecode block might be reallocated. */
+    compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+    compiled_code_p->prefix_offset = prefix_offset;
+    compiled_code_p->prefix_size = prefix_size;
+    return;
   }
 
-  JERRY_TRACE_MSG ("RegExp is NOT found in cache\n");
-  return free_idx;
-} /* re_find_bytecode_in_cache */
+  /* 2. Otherwise the set of the possible first bytes is computed. */
+  re_first_char_ctx_t ctx;
+  memset (ctx.set, 0, sizeof (ctx.set));
+  ctx.is_ignorecase = is_ignorecase;
+  ctx.is_supported = true;
+
+  bool is_nullable;
+  bytecode_p = re_first_char_set_add_alternatives (&ctx, bytecode_p, &is_nullable);
+  JERRY_ASSERT (*bytecode_p == RE_OP_SAVE_AND_MATCH);
+
+  if (ctx.is_supported && !is_nullable)
+  {
+    uint32_t first_char_set_offset = re_get_bytecode_length (bc_ctx_p);
+    re_bytecode_list_append (bc_ctx_p, ctx.set, sizeof (ctx.set));
+
+    compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+    compiled_code_p->first_char_set_offset = first_char_set_offset;
+  }
+} /* re_compile_first_char_info */
 
+#ifdef REGEXP_DUMP_BYTE_CODE
 /**
- * Run gerbage collection in RegExp cache
+ * RegExp literal prefix and first character set dumper
  */
-void
-re_cache_gc_run ()
+static void
+re_dump_first_char_info (const re_compiled_code_t *compiled_code_p) /**< compiled code */
 {
-  for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
+  const uint8_t *compiled_code_start_p = (const uint8_t *) compiled_code_p;
+
+  if (compiled_code_p->prefix_offset != 0)
+  {
+    JERRY_DEBUG_MSG ("Literal prefix: %.*s\n",
+                     (int) compiled_code_p->prefix_size,
+                     (const char *) compiled_code_start_p + compiled_code_p->prefix_offset);
+  }
+  else if (compiled_code_p->first_char_set_offset != 0)
   {
-    const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[i];
+    const uint8_t *set_p = compiled_code_start_p + compiled_code_p->first_char_set_offset;
+
+    JERRY_DEBUG_MSG ("First byte set: ");
 
-    if (cached_bytecode_p != NULL
-        && cached_bytecode_p->header.refs == 1)
+    for (uint32_t byte = 0; byte < 256; byte++)
     {
-      /* Only the cache has reference for the bytecode */
-      ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
-      JERRY_CONTEXT (re_cache)[i] = NULL;
+      if (set_p[byte >> 3] & (1u << (byte & 0x7)))
+      {
+        JERRY_DEBUG_MSG ("%02x ", byte);
+      }
     }
+
+    JERRY_DEBUG_MSG ("\n");
   }
-} /* re_cache_gc_run */
+} /* re_dump_first_char_info */
+#endif /* REGEXP_DUMP_BYTE_CODE */
 
 /**
  * Compilation of RegExp bytecode
@@ -518,17 +771,11 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
                      uint16_t flags) /**< flags */
 {
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
-  uint8_t cache_idx = re_find_bytecode_in_cache (pattern_str_p, flags);
+  *out_bytecode_p = re_cache_lookup (pattern_str_p, flags);
 
-  if (cache_idx < RE_CACHE_SIZE)
+  if (*out_bytecode_p != NULL)
   {
-    *out_bytecode_p = JERRY_CONTEXT (re_cache)[cache_idx];
-
-    if (*out_bytecode_p != NULL)
-    {
-      ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-      return ret_value;
-    }
+    return ret_value;
   }
 
   /* not in the RegExp cache, so compile it */
@@ -578,11 +825,22 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
     ECMA_SET_NON_NULL_POINTER (re_compiled_code.pattern_cp, pattern_str_p);
     re_compiled_code.num_of_captures = re_ctx.num_of_captures * 2;
     re_compiled_code.num_of_non_captures = re_ctx.num_of_non_captures;
+    re_compiled_code.automaton_offset = 0;
+    re_compiled_code.automaton_length = 0;
+    re_compiled_code.prefix_offset = 0;
+    re_compiled_code.prefix_size = 0;
+    re_compiled_code.first_char_set_offset = 0;
 
     re_bytecode_list_insert (&bc_ctx,
                              0,
                              (uint8_t *) &re_compiled_code,
                              sizeof (re_compiled_code_t));
+
+    /* 4. Build the linear-time automaton if the pattern allows it */
+    re_compile_automaton (&bc_ctx);
+
+    /* 5. Compute the prefix or the first characters of the matches */
+    re_compile_first_char_info (&bc_ctx);
   }
 
   ECMA_FINALIZE (empty);
@@ -604,37 +862,33 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
     if (JERRY_CONTEXT (jerry_init_flags) & JERRY_INIT_SHOW_REGEXP_OPCODES)
     {
       re_dump_bytecode (&bc_ctx);
+      re_dump_automaton ((re_compiled_code_t *) bc_ctx.block_start_p);
+      re_dump_first_char_info ((re_compiled_code_t *) bc_ctx.block_start_p);
     }
 #endif /* REGEXP_DUMP_BYTE_CODE */
 
     /* The RegExp bytecode contains at least a RE_OP_SAVE_AT_START opdoce, so it cannot be NULL. */
     JERRY_ASSERT (bc_ctx.block_start_p != NULL);
-    *out_bytecode_p = (re_compiled_code_t *) bc_ctx.block_start_p;
 
-    ((re_compiled_code_t *) bc_ctx.block_start_p)->header.size = (uint16_t) (byte_code_size >> JMEM_ALIGNMENT_LOG);
+    /* Release the unused part of the last allocated block, so the compiled
+     * code can be stored in snapshots without padding. */
+    size_t compact_size = JERRY_ALIGNUP (re_get_bytecode_length (&bc_ctx), JMEM_ALIGNMENT);
 
-    if (cache_idx == RE_CACHE_SIZE)
+    if (compact_size < byte_code_size)
     {
-      if (JERRY_CONTEXT (re_cache_idx) == RE_CACHE_SIZE)
-      {
-        JERRY_CONTEXT (re_cache_idx) = 0;
-      }
+      uint8_t *compact_block_p = (uint8_t *) jmem_heap_alloc_block (compact_size);
+      memcpy (compact_block_p, bc_ctx.block_start_p, compact_size);
+      jmem_heap_free_block (bc_ctx.block_start_p, byte_code_size);
 
-      JERRY_TRACE_MSG ("RegExp cache is full! Remove the element on idx: %d\n", JERRY_CONTEXT (re_cache_idx));
+      bc_ctx.block_start_p = compact_block_p;
+      byte_code_size = compact_size;
+    }
 
-      cache_idx = JERRY_CONTEXT (re_cache_idx)++;
+    *out_bytecode_p = (re_compiled_code_t *) bc_ctx.block_start_p;
 
-      /* The garbage collector might run during the byte code
-       * allocations above and it may free this entry. */
-      if (JERRY_CONTEXT (re_cache)[cache_idx] != NULL)
-      {
-        ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[cache_idx]);
-      }
-    }
+    ((re_compiled_code_t *) bc_ctx.block_start_p)->header.size = (uint16_t) (byte_code_size >> JMEM_ALIGNMENT_LOG);
 
-    JERRY_TRACE_MSG ("Insert bytecode into RegExp cache (idx: %d).\n", cache_idx);
-    ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-    JERRY_CONTEXT (re_cache)[cache_idx] = *out_bytecode_p;
+    re_cache_insert (*out_bytecode_p);
   }
 
   return ret_value;
@@ -50,8 +50,6 @@ typedef struct
 ecma_value_t
 re_compile_bytecode (const re_compiled_code_t **, ecma_string_t *, uint16_t);
 
-void re_cache_gc_run ();
-
 /**
  * @}
  * @}
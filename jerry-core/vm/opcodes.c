@@ -17,6 +17,7 @@
 #include "ecma-alloc.h"
 #include "ecma-builtins.h"
 #include "ecma-conversion.h"
+#include "ecma-enum-cache.h"
 #include "ecma-exceptions.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
@@ -291,15 +292,15 @@ vm_op_delete_var (jmem_cpointer_t name_literal, /**< name literal */
  * See also:
  *          ECMA-262 v5, 12.6.4
  *
- * @return completion value
- *         Returned value must be freed with ecma_free_value
+ * @return enumeration cache entry of the property names, or NULL if there is nothing to enumerate
+ *         Returned entry must be released with ecma_enum_cache_deref_entry
  */
-ecma_collection_header_t *
+ecma_enum_cache_entry_t *
 opfunc_for_in (ecma_value_t left_value, /**< left value */
                ecma_value_t *result_obj_p) /**< expression object */
 {
   ecma_value_t compl_val = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
-  ecma_collection_header_t *prop_names_p = NULL;
+  ecma_enum_cache_entry_t *prop_names_p = NULL;
 
   /* 3. */
   if (!ecma_is_value_undefined (left_value)
@@ -311,16 +312,16 @@ opfunc_for_in (ecma_value_t left_value, /**< left value */
                     compl_val);
 
     ecma_object_t *obj_p = ecma_get_object_from_value (obj_expr_value);
-    prop_names_p = ecma_op_object_get_property_names (obj_p, false, true, true);
+    prop_names_p = ecma_enum_cache_get_entry (obj_p, true);
 
-    if (prop_names_p->unit_number != 0)
+    if (prop_names_p->name_count != 0)
     {
       ecma_ref_object (obj_p);
       *result_obj_p = ecma_make_object_value (obj_p);
     }
     else
     {
-      ecma_dealloc_collection_header (prop_names_p);
+      ecma_enum_cache_deref_entry (prop_names_p);
       prop_names_p = NULL;
     }
 
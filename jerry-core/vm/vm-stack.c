@@ -15,6 +15,7 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-enum-cache.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "vm-defines.h"
@@ -68,21 +69,9 @@ vm_stack_context_abort (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     }
     case VM_CONTEXT_FOR_IN:
     {
-      jmem_cpointer_t current = (jmem_cpointer_t) vm_stack_top_p[-2];
-
-      while (current != JMEM_CP_NULL)
-      {
-        ecma_collection_chunk_t *chunk_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                                                         current);
-
-        lit_utf8_byte_t *data_ptr = chunk_p->data;
-        ecma_free_value (*(ecma_value_t *) data_ptr);
-
-        current = chunk_p->next_chunk_cp;
-        ecma_dealloc_collection_chunk (chunk_p);
-      }
-
-      ecma_free_value (vm_stack_top_p[-3]);
+      ecma_enum_cache_deref_entry (JMEM_CP_GET_NON_NULL_POINTER (ecma_enum_cache_entry_t,
+                                                                 vm_stack_top_p[-2]));
+      ecma_free_value (vm_stack_top_p[-4]);
 
       VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
       vm_stack_top_p -= PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION;
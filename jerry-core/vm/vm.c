@@ -21,6 +21,7 @@
 #include "ecma-builtins.h"
 #include "ecma-comparison.h"
 #include "ecma-conversion.h"
+#include "ecma-enum-cache.h"
 #include "ecma-exceptions.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
@@ -32,6 +33,7 @@
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
+#include "jerry-snapshot.h"
 #include "opcodes.h"
 #include "vm.h"
 #include "vm-stack.h"
@@ -94,14 +96,23 @@ vm_op_get_value (ecma_value_t object, /**< base object */
     return ecma_raise_type_error (ECMA_ERR_MSG (""));
   }
 
-  ecma_value_t prop_to_string_result = ecma_op_to_string (property);
+  ecma_string_t *property_name_p;
 
-  if (ECMA_IS_VALUE_ERROR (prop_to_string_result))
+  if (ecma_is_value_number (property))
   {
-    return prop_to_string_result;
+    property_name_p = ecma_new_ecma_string_from_number_cached (ecma_get_number_from_value (property));
   }
+  else
+  {
+    ecma_value_t prop_to_string_result = ecma_op_to_string (property);
 
-  ecma_string_t *property_name_p = ecma_get_string_from_value (prop_to_string_result);
+    if (ECMA_IS_VALUE_ERROR (prop_to_string_result))
+    {
+      return prop_to_string_result;
+    }
+
+    property_name_p = ecma_get_string_from_value (prop_to_string_result);
+  }
 
   ecma_value_t get_value_result = ecma_op_get_value_object_base (object, property_name_p);
 
@@ -138,7 +149,13 @@ vm_op_set_value (ecma_value_t object, /**< base object */
     object = to_object;
   }
 
-  if (!ecma_is_value_string (property))
+  if (ecma_is_value_number (property))
+  {
+    ecma_string_t *property_name_p = ecma_new_ecma_string_from_number_cached (ecma_get_number_from_value (property));
+    ecma_fast_free_value (property);
+    property = ecma_make_string_value (property_name_p);
+  }
+  else if (!ecma_is_value_string (property))
   {
     ecma_value_t to_string = ecma_op_to_string (property);
     ecma_fast_free_value (property);
@@ -269,10 +286,34 @@ vm_run_eval (ecma_compiled_code_t *bytecode_data_p, /**< byte-code data */
  */
 static ecma_value_t
 vm_construct_literal_object (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
-                             jmem_cpointer_t lit_cp) /**< literal */
+                             jmem_cpointer_t *lit_cp_p) /**< [in, out] literal */
 {
   ecma_compiled_code_t *bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
-                                                                lit_cp);
+                                                                *lit_cp_p);
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  if (unlikely (bytecode_p->status_flags & CBC_CODE_FLAGS_SNAPSHOT_FUNCTION_STUB))
+  {
+    /* The function is loaded from the snapshot when its first object is created. */
+    bytecode_p = jerry_snapshot_load_function_stub (bytecode_p);
+    ECMA_SET_NON_NULL_POINTER (*lit_cp_p, bytecode_p);
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+  {
+    cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+
+    /* The literal is redirected to the byte code once the function is compiled. */
+    if (lazy_function_p->bytecode_cp != JMEM_CP_NULL)
+    {
+      *lit_cp_p = lazy_function_p->bytecode_cp;
+      bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, lazy_function_p->bytecode_cp);
+      ecma_bytecode_ref (bytecode_p);
+      ecma_bytecode_deref ((ecma_compiled_code_t *) lazy_function_p);
+    }
+  }
+
   bool is_function = ((bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION) != 0);
 
   if (is_function)
@@ -509,7 +550,7 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     else \
     { \
       /* Object construction. */ \
-      (target_value) = vm_construct_literal_object (frame_ctx_p, literal_start_p[literal_index]); \
+      (target_value) = vm_construct_literal_object (frame_ctx_p, literal_start_p + (literal_index)); \
     } \
   } \
   while (0)
@@ -613,7 +654,7 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           else
           {
             lit_value = vm_construct_literal_object (frame_ctx_p,
-                                                     literal_start_p[value_index]);
+                                                     literal_start_p + value_index);
           }
 
           if (self_reference == literal_start_p[value_index])
@@ -810,7 +851,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           default:
           {
-            JERRY_ASSERT (CBC_BRANCH_OFFSET_LENGTH (opcode) == 2);
+            JERRY_ASSERT (CBC_BRANCH_OFFSET_LENGTH (opcode) >= 2);
 
             branch_offset <<= 8;
             branch_offset |= *(byte_code_p++);
@@ -1479,6 +1520,66 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (value);
           continue;
         }
+        case VM_OC_SWITCH_INTEGER_TABLE:
+        {
+          /* The table entries are jump instructions, and the one selected by
+           * the value is executed next. Other values continue after the table. */
+          uint32_t table_size = (uint32_t) (*byte_code_p++) + 1;
+          uint32_t index = table_size;
+
+          JERRY_ASSERT (byte_code_p[0] == CBC_EXT_OPCODE && CBC_EXT_IS_SWITCH_TABLE_ENTRY (byte_code_p[1]));
+
+          JERRY_ASSERT (ecma_is_value_integer_number (right_value));
+
+          if (ecma_is_value_integer_number (left_value))
+          {
+            index = (uint32_t) (ecma_get_integer_from_value (left_value) - ecma_get_integer_from_value (right_value));
+          }
+          else if (ecma_is_value_number (left_value))
+          {
+            ecma_number_t index_number = ecma_get_number_from_value (left_value);
+
+            index_number -= (ecma_number_t) ecma_get_integer_from_value (right_value);
+
+            if (index_number >= 0 && index_number < (ecma_number_t) table_size)
+            {
+              index = (uint32_t) index_number;
+
+              if ((ecma_number_t) index != index_number)
+              {
+                index = table_size;
+              }
+            }
+          }
+
+          if (index > table_size)
+          {
+            index = table_size;
+          }
+
+          /* Each entry has the same length. */
+          byte_code_p += index * (2 + CBC_BRANCH_OFFSET_LENGTH (byte_code_p[1]));
+          goto free_both_values;
+        }
+        case VM_OC_SWITCH_STRING_TABLE:
+        {
+          /* The value is kept on the stack, since the selected entry jumps to
+           * a strict equality check, which compares it with the case string. */
+          uint32_t hash_mask = *byte_code_p++;
+          uint32_t index = hash_mask + 1;
+          ecma_value_t value = stack_top_p[-1];
+
+          JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
+          JERRY_ASSERT (byte_code_p[0] == CBC_EXT_OPCODE && CBC_EXT_IS_SWITCH_TABLE_ENTRY (byte_code_p[1]));
+
+          if (ecma_is_value_string (value))
+          {
+            index = ecma_get_string_from_value (value)->hash & hash_mask;
+          }
+
+          byte_code_p += index * (2 + CBC_BRANCH_OFFSET_LENGTH (byte_code_p[1]));
+          continue;
+        }
         case VM_OC_BRANCH_IF_TRUE:
         case VM_OC_BRANCH_IF_FALSE:
         case VM_OC_BRANCH_IF_LOGICAL_TRUE:
@@ -2113,10 +2214,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
           ecma_value_t expr_obj_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
-          ecma_collection_header_t *header_p = opfunc_for_in (value, &expr_obj_value);
+          ecma_enum_cache_entry_t *entry_p = opfunc_for_in (value, &expr_obj_value);
           ecma_free_value (value);
 
-          if (header_p == NULL)
+          if (entry_p == NULL)
           {
             byte_code_p = byte_code_start_p + branch_offset;
             continue;
@@ -2127,24 +2228,27 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           VM_PLUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
           stack_top_p += PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION;
           stack_top_p[-1] = (ecma_value_t) VM_CREATE_CONTEXT (VM_CONTEXT_FOR_IN, branch_offset);
-          stack_top_p[-2] = header_p->first_chunk_cp;
-          stack_top_p[-3] = expr_obj_value;
 
-          ecma_dealloc_collection_header (header_p);
+          /* The names are iterated in place, they are shared with the enumeration cache. */
+          jmem_cpointer_t entry_cp;
+          JMEM_CP_SET_NON_NULL_POINTER (entry_cp, entry_p);
+          stack_top_p[-2] = entry_cp;
+          stack_top_p[-3] = 0;
+          stack_top_p[-4] = expr_obj_value;
           continue;
         }
         case VM_OC_FOR_IN_GET_NEXT:
         {
           ecma_value_t *context_top_p = frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth;
-          ecma_collection_chunk_t *chunk_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_collection_chunk_t, context_top_p[-2]);
+          ecma_enum_cache_entry_t *entry_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_enum_cache_entry_t,
+                                                                           context_top_p[-2]);
+          uint32_t name_index = context_top_p[-3];
 
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_IN);
+          JERRY_ASSERT (name_index < entry_p->name_count);
 
-          lit_utf8_byte_t *data_ptr = chunk_p->data;
-          result = *(ecma_value_t *) data_ptr;
-          context_top_p[-2] = chunk_p->next_chunk_cp;
-
-          ecma_dealloc_collection_chunk (chunk_p);
+          result = ecma_copy_value (ECMA_ENUM_CACHE_ENTRY_GET_NAMES (entry_p)[name_index]);
+          context_top_p[-3] = name_index + 1;
 
           *stack_top_p++ = result;
           continue;
@@ -2153,36 +2257,31 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
-          while (true)
-          {
-            if (stack_top_p[-2] == JMEM_CP_NULL)
-            {
-              ecma_free_value (stack_top_p[-3]);
-
-              VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
-              stack_top_p -= PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION;
-              break;
-            }
-
-            ecma_collection_chunk_t *chunk_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_collection_chunk_t, stack_top_p[-2]);
+          ecma_enum_cache_entry_t *entry_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_enum_cache_entry_t,
+                                                                           stack_top_p[-2]);
+          ecma_value_t *names_p = ECMA_ENUM_CACHE_ENTRY_GET_NAMES (entry_p);
+          uint32_t name_index = stack_top_p[-3];
 
-            lit_utf8_byte_t *data_ptr = chunk_p->data;
-            ecma_string_t *prop_name_p = ecma_get_string_from_value (*(ecma_value_t *) data_ptr);
+          /* Properties deleted during the enumeration are skipped. */
+          while (name_index < entry_p->name_count
+                 && ecma_op_object_get_property (ecma_get_object_from_value (stack_top_p[-4]),
+                                                 ecma_get_string_from_value (names_p[name_index])) == NULL)
+          {
+            name_index++;
+          }
 
-            if (ecma_op_object_get_property (ecma_get_object_from_value (stack_top_p[-3]),
-                                             prop_name_p) == NULL)
-            {
-              stack_top_p[-2] = chunk_p->next_chunk_cp;
-              ecma_deref_ecma_string (prop_name_p);
-              ecma_dealloc_collection_chunk (chunk_p);
-            }
-            else
-            {
-              byte_code_p = byte_code_start_p + branch_offset;
-              break;
-            }
+          if (name_index < entry_p->name_count)
+          {
+            stack_top_p[-3] = name_index;
+            byte_code_p = byte_code_start_p + branch_offset;
+            continue;
           }
 
+          ecma_enum_cache_deref_entry (entry_p);
+          ecma_free_value (stack_top_p[-4]);
+
+          VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
+          stack_top_p -= PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION;
           continue;
         }
         case VM_OC_TRY:
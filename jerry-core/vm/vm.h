@@ -156,6 +156,8 @@ typedef enum
 
   VM_OC_JUMP,                    /**< jump */
   VM_OC_BRANCH_IF_STRICT_EQUAL,  /**< branch if stric equal */
+  VM_OC_SWITCH_INTEGER_TABLE,    /**< jump through the integer table of a switch */
+  VM_OC_SWITCH_STRING_TABLE,     /**< jump through the string hash table of a switch */
 
   /* These four opcodes must be in this order. */
   VM_OC_BRANCH_IF_TRUE,          /**< branch if true */
@@ -19,6 +19,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
+
 #include "jerry-api.h"
 #include "jerry-port.h"
 #include "jerry-port-default.h"
@@ -43,29 +50,83 @@ static uint8_t buffer[ JERRY_BUFFER_SIZE ];
 
 static const uint8_t *
 read_file (const char *file_name,
+           size_t buffer_offset,
            size_t *out_size_p)
 {
-  FILE *file = fopen (file_name, "r");
+  bool is_stdin = !strcmp ("-", file_name);
+  FILE *file = is_stdin ? stdin : fopen (file_name, "r");
   if (file == NULL)
   {
     jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to open file: %s\n", file_name);
     return NULL;
   }
 
-  size_t bytes_read = fread (buffer, 1u, sizeof (buffer), file);
+  size_t bytes_read = fread (buffer + buffer_offset, 1u, sizeof (buffer) - buffer_offset, file);
   if (!bytes_read)
   {
     jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to read file: %s\n", file_name);
-    fclose (file);
+    if (!is_stdin)
+    {
+      fclose (file);
+    }
     return NULL;
   }
 
-  fclose (file);
+  if (!is_stdin)
+  {
+    fclose (file);
+  }
 
   *out_size_p = bytes_read;
-  return (const uint8_t *) buffer;
+  return (const uint8_t *) buffer + buffer_offset;
 } /* read_file */
 
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+
+/**
+ * Map a snapshot file into the memory as read-only
+ *
+ * Note:
+ *      the mapping must be kept until jerry_cleanup, since the engine
+ *      references the byte code and the literals of the snapshot in place
+ *
+ * @return pointer to the mapped snapshot - if the file is mapped successfully,
+ *         NULL - otherwise
+ */
+static const uint8_t *
+map_snapshot_file (const char *file_name, /**< snapshot file name */
+                   size_t *out_size_p) /**< [out] size of the snapshot */
+{
+  int fd = open (file_name, O_RDONLY);
+  if (fd < 0)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to open file: %s\n", file_name);
+    return NULL;
+  }
+
+  struct stat file_stat;
+  if (fstat (fd, &file_stat) != 0 || file_stat.st_size <= 0)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to read file: %s\n", file_name);
+    close (fd);
+    return NULL;
+  }
+
+  void *snapshot_p = mmap (NULL, (size_t) file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+
+  if (snapshot_p == MAP_FAILED)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to map file: %s\n", file_name);
+    return NULL;
+  }
+
+  *out_size_p = (size_t) file_stat.st_size;
+  return (const uint8_t *) snapshot_p;
+} /* map_snapshot_file */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
+
 /**
  * Provide the 'assert' implementation for the engine.
  *
@@ -110,6 +171,7 @@ print_help (char *name)
                       "  --mem-stats\n"
                       "  --mem-stats-separate\n"
                       "  --parse-only\n"
+                      "  --lazy-functions\n"
                       "  --show-opcodes\n"
                       "  --show-regexp-opcodes\n"
                       "  --save-snapshot-for-global FILE\n"
@@ -117,6 +179,8 @@ print_help (char *name)
                       "  --exec-snapshot FILE\n"
                       "  --log-level [0-3]\n"
                       "  --abort-on-fail\n"
+                      "\n"
+                      "When FILE is -, the script is read from the standard input.\n"
                       "\n",
                       name);
 } /* print_help */
@@ -177,6 +241,12 @@ main (int argc,
   const char *exec_snapshot_file_names[JERRY_MAX_COMMAND_LINE_ARGS];
   int exec_snapshots_count = 0;
 
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+  const uint8_t *exec_snapshot_maps[JERRY_MAX_COMMAND_LINE_ARGS];
+  size_t exec_snapshot_map_sizes[JERRY_MAX_COMMAND_LINE_ARGS];
+  int exec_snapshot_maps_count = 0;
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
+
   bool is_parse_only = false;
   bool is_save_snapshot_mode = false;
   bool is_save_snapshot_mode_for_global_or_eval = false;
@@ -210,6 +280,10 @@ main (int argc,
     {
       is_parse_only = true;
     }
+    else if (!strcmp ("--lazy-functions", argv[i]))
+    {
+      flags |= JERRY_INIT_LAZY_FUNCTIONS;
+    }
     else if (!strcmp ("--show-opcodes", argv[i]))
     {
       flags |= JERRY_INIT_SHOW_OPCODES;
@@ -276,6 +350,10 @@ main (int argc,
     {
       jerry_port_default_set_abort_on_fail (true);
     }
+    else if (!strcmp ("-", argv[i]))
+    {
+      file_names[files_counter++] = argv[i];
+    }
     else if (!strncmp ("-", argv[i], 1))
     {
       jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: unrecognized option: %s\n", argv[i]);
@@ -290,10 +368,10 @@ main (int argc,
 
   if (is_save_snapshot_mode)
   {
-    if (files_counter != 1)
+    if (files_counter == 0)
     {
       jerry_port_log (JERRY_LOG_LEVEL_ERROR,
-                      "Error: --save-snapshot argument works with exactly one script\n");
+                      "Error: --save-snapshot argument needs at least one script\n");
       return JERRY_STANDALONE_EXIT_CODE_FAIL;
     }
 
@@ -333,7 +411,21 @@ main (int argc,
   for (int i = 0; i < exec_snapshots_count; i++)
   {
     size_t snapshot_size;
-    const uint8_t *snapshot_p = read_file (exec_snapshot_file_names[i], &snapshot_size);
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+    const uint8_t *snapshot_p = map_snapshot_file (exec_snapshot_file_names[i], &snapshot_size);
+    const bool copy_bytecode = false;
+
+    if (snapshot_p != NULL)
+    {
+      exec_snapshot_maps[exec_snapshot_maps_count] = snapshot_p;
+      exec_snapshot_map_sizes[exec_snapshot_maps_count] = snapshot_size;
+      exec_snapshot_maps_count++;
+    }
+#else /* !JERRY_ENABLE_SNAPSHOT_MMAP */
+    /* The buffer is reused by the next file, so the snapshot must be copied. */
+    const uint8_t *snapshot_p = read_file (exec_snapshot_file_names[i], 0, &snapshot_size);
+    const bool copy_bytecode = true;
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
 
     if (snapshot_p == NULL)
     {
@@ -343,7 +435,7 @@ main (int argc,
     {
       ret_value = jerry_exec_snapshot ((void *) snapshot_p,
                                        snapshot_size,
-                                       true);
+                                       copy_bytecode);
     }
 
     if (jerry_value_has_error_flag (ret_value))
@@ -354,10 +446,15 @@ main (int argc,
 
   if (!jerry_value_has_error_flag (ret_value))
   {
+    /* Each script is a module of the saved snapshot bundle, so all of them are kept in the buffer.
+     * Lazily compiled functions also refer to their source code until the engine stops. */
+    jerry_snapshot_source_t snapshot_sources[JERRY_MAX_COMMAND_LINE_ARGS];
+    size_t buffer_offset = 0;
+
     for (int i = 0; i < files_counter; i++)
     {
       size_t source_size;
-      const jerry_char_t *source_p = read_file (file_names[i], &source_size);
+      const jerry_char_t *source_p = read_file (file_names[i], buffer_offset, &source_size);
 
       if (source_p == NULL)
       {
@@ -367,27 +464,17 @@ main (int argc,
 
       if (is_save_snapshot_mode)
       {
-        static uint8_t snapshot_save_buffer[ JERRY_BUFFER_SIZE ];
-
-        size_t snapshot_size = jerry_parse_and_save_snapshot ((jerry_char_t *) source_p,
-                                                              source_size,
-                                                              is_save_snapshot_mode_for_global_or_eval,
-                                                              false,
-                                                              snapshot_save_buffer,
-                                                              JERRY_BUFFER_SIZE);
-        if (snapshot_size == 0)
-        {
-          ret_value = jerry_create_error (JERRY_ERROR_COMMON, (jerry_char_t *) "");
-        }
-        else
-        {
-          FILE *snapshot_file_p = fopen (save_snapshot_file_name_p, "w");
-          fwrite (snapshot_save_buffer, sizeof (uint8_t), snapshot_size, snapshot_file_p);
-          fclose (snapshot_file_p);
-        }
+        snapshot_sources[i].source_p = source_p;
+        snapshot_sources[i].source_size = source_size;
+        buffer_offset += source_size;
       }
       else
       {
+        if (flags & JERRY_INIT_LAZY_FUNCTIONS)
+        {
+          buffer_offset += source_size;
+        }
+
         ret_value = jerry_parse (source_p, source_size, false);
 
         if (!jerry_value_has_error_flag (ret_value) && !is_parse_only)
@@ -403,6 +490,28 @@ main (int argc,
         break;
       }
     }
+
+    if (is_save_snapshot_mode && !jerry_value_has_error_flag (ret_value))
+    {
+      static uint8_t snapshot_save_buffer[ JERRY_BUFFER_SIZE ];
+
+      size_t snapshot_size = jerry_parse_and_save_snapshot_bundle (snapshot_sources,
+                                                                   (size_t) files_counter,
+                                                                   is_save_snapshot_mode_for_global_or_eval,
+                                                                   false,
+                                                                   snapshot_save_buffer,
+                                                                   JERRY_BUFFER_SIZE);
+      if (snapshot_size == 0)
+      {
+        ret_value = jerry_create_error (JERRY_ERROR_COMMON, (jerry_char_t *) "");
+      }
+      else
+      {
+        FILE *snapshot_file_p = fopen (save_snapshot_file_name_p, "w");
+        fwrite (snapshot_save_buffer, sizeof (uint8_t), snapshot_size, snapshot_file_p);
+        fclose (snapshot_file_p);
+      }
+    }
   }
 
   if (is_repl_mode)
@@ -490,6 +599,13 @@ main (int argc,
   jerry_release_value (ret_value);
   jerry_cleanup ();
 
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+  for (int i = 0; i < exec_snapshot_maps_count; i++)
+  {
+    munmap ((void *) exec_snapshot_maps[i], exec_snapshot_map_sizes[i]);
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
+
   return ret_code;
 
 } /* main */
@@ -0,0 +1,42 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Arrays used as queues, and splicing in the middle. */
+var queue = [];
+var sum = 0;
+
+for (var i = 0; i < 250; i++)
+{
+  queue.push (i, "item" + i);
+}
+
+for (var i = 0; i < 1000; i++)
+{
+  queue.push (i);
+  sum += typeof queue.shift () === "number" ? 1 : 0;
+
+  if (i % 4 === 0)
+  {
+    queue.unshift (queue.shift ());
+  }
+
+  if (i % 16 === 0)
+  {
+    queue.splice (i % queue.length, 2, i, i + 1);
+  }
+}
+
+assert (queue.length === 500);
+assert (sum > 0);
@@ -0,0 +1,46 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Sorting random, partially sorted and string arrays. */
+var seed = 1;
+var numbers = [];
+var words = [];
+
+for (var i = 0; i < 2000; i++)
+{
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  numbers.push (seed % 100000);
+  words.push ("w" + (seed % 7919));
+}
+
+for (var i = 0; i < 5; i++)
+{
+  var array = numbers.slice ();
+  array.sort (function (a, b) { return a - b; });
+  assert (array[0] <= array[1]);
+
+  /* Append a few new values to the sorted array and sort it again. */
+  array.push (5, 50000, 3);
+  array.sort (function (a, b) { return a - b; });
+  assert (array[0] <= array[1]);
+
+  array = numbers.slice ();
+  array.sort ();
+  assert (String (array[0]) <= String (array[1]));
+
+  array = words.slice ();
+  array.sort ();
+  assert (array[0] <= array[1]);
+}
@@ -0,0 +1,50 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Repeated for-in and Object.keys enumeration of objects with the same layout. */
+function Record (id)
+{
+  this.id = id;
+  this.name = "record" + id;
+  this.kind = id % 3;
+  this.size = id * 2;
+  this.flags = 0;
+  this.owner = null;
+  this.created = id;
+  this.updated = id;
+}
+
+Record.prototype.describe = function () { return this.name; };
+
+var records = [];
+for (var i = 0; i < 16; i++)
+{
+  records.push (new Record (i));
+}
+
+var count = 0;
+for (var i = 0; i < 50000; i++)
+{
+  var record = records[i % records.length];
+
+  for (var key in record)
+  {
+    count++;
+  }
+
+  count += Object.keys (record).length;
+}
+
+assert (count === 50000 * (9 + 8));
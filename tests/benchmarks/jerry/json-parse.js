@@ -0,0 +1,33 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var records = [];
+for (var i = 0; i < 200; i++)
+{
+  records.push ('{"id":' + i + ',"name":"item ' + i + '","price":' + (i * 1.25) +
+                ',"ratio":-0.' + (i % 10) + ',"tags":["a","b","c"],"active":' + (i % 2 === 0) + '}');
+}
+
+/* The heap is small, so a moderately sized document is parsed repeatedly. */
+var text = '{"count":200,"records":[' + records.join (",") + ']}';
+
+var sum = 0;
+for (var i = 0; i < 100; i++)
+{
+  var doc = JSON.parse (text);
+  sum += doc.records.length + doc.records[doc.count - 1].id;
+}
+
+assert (sum === 100 * 399);
@@ -0,0 +1,36 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Property accesses with number keys which are not array indices. */
+var map = {};
+var keys = [];
+
+for (var i = 0; i < 24; i++)
+{
+  keys.push (i % 2 === 0 ? -i - 1 : i * 0.25);
+}
+
+var sum = 0;
+for (var i = 0; i < 4000; i++)
+{
+  for (var j = 0; j < keys.length; j++)
+  {
+    var key = keys[j];
+    map[key] = (map[key] || 0) + j;
+    sum += map[key];
+  }
+}
+
+assert (sum > 0);
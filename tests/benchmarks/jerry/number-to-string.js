@@ -0,0 +1,41 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Deterministic pseudo random doubles with various magnitudes. */
+var seed = 12345;
+
+function next_random ()
+{
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+}
+
+var values = [];
+for (var i = 0; i < 500; i++)
+{
+  var value = next_random () * Math.pow (10, Math.floor (next_random () * 40) - 20);
+  values.push (i % 5 === 0 ? Math.floor (value * 1000) / 1000 : value);
+}
+
+var length = 0;
+for (var i = 0; i < 100; i++)
+{
+  for (var j = 0; j < values.length; j++)
+  {
+    length += String (values[j]).length;
+  }
+}
+
+assert (length > 0);
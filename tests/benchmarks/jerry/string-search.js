@@ -0,0 +1,33 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var line = "";
+for (var i = 0; i < 64; i++)
+{
+  line += "INFO: request " + i + " served in " + (i * 3) + " ms; ";
+}
+
+var log = line + "ERROR: 404 not found; " + line;
+
+var found = 0;
+for (var i = 0; i < 2000; i++)
+{
+  found += log.indexOf ("ERROR: ");
+  found += log.lastIndexOf ("INFO: request 63");
+  found += log.split ("; ").length;
+  found += log.replace ("ERROR: ", "WARN: ").length;
+}
+
+assert (found > 0);
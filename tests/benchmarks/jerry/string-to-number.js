@@ -0,0 +1,46 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Parse the fields of CSV like rows with Number, parseFloat and parseInt. */
+var seed = 12345;
+
+function next_random ()
+{
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+}
+
+var fields = [];
+for (var i = 0; i < 200; i++)
+{
+  var value = next_random () * Math.pow (10, Math.floor (next_random () * 40) - 20);
+  var row = String (Math.floor (next_random () * 100000000)) + ","
+            + String (value) + ","
+            + (next_random () * 1000).toFixed (2) + ","
+            + "0x" + Math.floor (next_random () * 4294967296).toString (16);
+  fields.push (row.split (","));
+}
+
+var sum = 0;
+for (var i = 0; i < 600; i++)
+{
+  for (var j = 0; j < fields.length; j++)
+  {
+    var row = fields[j];
+    sum += parseInt (row[0], 10) + Number (row[1]) + parseFloat (row[2]) + parseInt (row[3], 16);
+  }
+}
+
+assert (sum > 0);
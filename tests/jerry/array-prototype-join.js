@@ -75,3 +75,15 @@ obj_2[3] = 4;
 obj_2.join = Array.prototype.join;
 
 assert (obj_2.join() === "1,2,3");
+
+var long_array = [];
+for (var i = 0; i < 2000; i++)
+{
+  long_array.push (i);
+}
+
+var joined = long_array.join ("--");
+assert (joined.length === 2000 * 2 - 2 + 10 + 90 * 2 + 900 * 3 + 1000 * 4);
+assert (joined.substring (0, 10) === "0--1--2--3");
+assert ([1, [2, 3], "é"].join ("--") === "1--2,3--é");
+assert (["length"].join () === "length");
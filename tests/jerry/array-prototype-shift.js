@@ -78,3 +78,44 @@ try {
   assert(e.message === "foo");
   assert(e instanceof ReferenceError);
 }
+
+// Queue usage of arrays
+var queue = [];
+for (var i = 0; i < 100; i++) {
+  queue.push(i, "str" + i);
+  var first = queue.shift();
+  assert(i % 2 === 0 ? first === i / 2 : first === "str" + (i - 1) / 2);
+}
+assert(queue.length === 100 && queue[0] === 50 && queue[99] === "str99");
+
+var array = [1.5, "a", { b: 2 }];
+assert(array.shift() === 1.5);
+assert(array.length === 2 && array[0] === "a" && array[1].b === 2);
+assert(!array.hasOwnProperty(2));
+
+// Non-writable elements are not modified
+var array = [1, 2, 3];
+Object.defineProperty(array, '0', { writable: false });
+
+try {
+  array.shift();
+  assert(false);
+} catch (e) {
+  assert(e instanceof TypeError);
+  assert(array[0] === 1 && array.length === 3);
+}
+
+// Holes and accessors are handled as in the specification
+var array = [1, , 3];
+assert(array.shift() === 1);
+assert(array.length === 2 && !array.hasOwnProperty(0) && array[1] === 3);
+
+var setter_value;
+var array = [1, 2, 3];
+Object.defineProperty(array, '1', {
+  get: function () { return "getter"; },
+  set: function (value) { setter_value = value; },
+  configurable: true
+});
+assert(array.shift() === 1);
+assert(array[0] === "getter" && array[1] === "getter" && setter_value === 3 && array.length === 2);
@@ -93,3 +93,135 @@ try {
   assert(e.message === "foo");
   assert(e instanceof ReferenceError);
 }
+
+// Sorting is stable
+var records = [];
+for (i = 0; i < 300; i++) {
+  records.push({ key: (i * 7) % 10, order: i });
+}
+
+records.sort(function (a, b) { return a.key - b.key; });
+for (i = 1; i < records.length; i++) {
+  assert(records[i - 1].key <= records[i].key);
+  if (records[i - 1].key === records[i].key) {
+    assert(records[i - 1].order < records[i].order);
+  }
+}
+
+// Default comparison of integers compares their string forms
+var array = [10, 9, 1, 100, -1, -10, -2, 0, 25, 3, -100, 1000, 2];
+array.sort();
+assert(array.join() === "-1,-10,-100,-2,0,1,10,100,1000,2,25,3,9");
+
+var array = [0.5, 10, 1e21, -0, 2, "1", true, null, NaN, -Infinity];
+array.sort();
+assert(array.join() === "-Infinity,0,0.5,1,10,1e+21,2,NaN,,true" && array[8] === null);
+
+// Equal string forms keep their order
+var array = [1, "1", 2, "2", "1", 1];
+array.sort();
+assert(array[0] === 1 && array[1] === "1" && array[2] === "1" && array[3] === 1);
+assert(array[4] === 2 && array[5] === "2");
+
+// Every value is converted to string only once
+var conversions = 0;
+var array = [];
+for (i = 0; i < 50; i++) {
+  array.push({ value: (i * 13) % 50, toString: function () { conversions++; return String(this.value + 100); } });
+}
+
+array.sort();
+assert(conversions === 50);
+for (i = 0; i < array.length; i++) {
+  assert(array[i].value === i);
+}
+
+// Ascending, descending and partially sorted inputs
+function check_sorted(array, length) {
+  assert(array.length === length);
+  for (var i = 1; i < array.length; i++) {
+    assert(array[i - 1] <= array[i]);
+  }
+}
+
+function numeric(a, b) {
+  return a - b;
+}
+
+var ascending = [];
+var descending = [];
+var sawtooth = [];
+for (i = 0; i < 500; i++) {
+  ascending.push(i);
+  descending.push(500 - i);
+  sawtooth.push((i % 70) * 3 + (i >> 6));
+}
+
+check_sorted(ascending.sort(numeric), 500);
+check_sorted(descending.sort(numeric), 500);
+check_sorted(sawtooth.sort(numeric), 500);
+
+var random = [];
+var seed = 42;
+for (i = 0; i < 700; i++) {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  random.push(seed % 1000 - 500 + 0.5);
+}
+
+check_sorted(random.sort(numeric), 700);
+
+// Non-number and NaN results of the compare function
+var array = [3, 1, 2];
+array.sort(function (a, b) { return String(a - b); });
+assert(array.join() === "1,2,3");
+
+var array = [3, 1, 2];
+array.sort(function (a, b) { return NaN; });
+assert(array.join() === "3,1,2");
+
+// Undefined values are not passed to the compare function
+var array = [undefined, 3, , undefined, 1, , 2];
+array.sort(function (a, b) {
+  assert(a !== undefined && b !== undefined);
+  return a - b;
+});
+assert(array.length === 7);
+assert(array[0] === 1 && array[1] === 2 && array[2] === 3);
+assert(array[3] === undefined && array[4] === undefined && array.hasOwnProperty(4));
+assert(!array.hasOwnProperty(5) && !array.hasOwnProperty(6));
+
+// Exception thrown by the compare function keeps every element
+var array = [];
+for (i = 0; i < 100; i++) {
+  array.push((i * 37) % 100);
+}
+
+var calls = 0;
+try {
+  array.sort(function (a, b) {
+    if (++calls === 300) {
+      throw new RangeError("bar");
+    }
+    return a - b;
+  });
+  assert(false);
+} catch (e) {
+  assert(e instanceof RangeError);
+  assert(e.message === "bar");
+}
+
+assert(array.length === 100);
+array.sort(numeric);
+for (i = 0; i < array.length; i++) {
+  assert(array[i] === i);
+}
+
+// Exception thrown by toString
+var array = [2, { toString: function () { throw new SyntaxError("baz"); } }, 1];
+try {
+  array.sort();
+  assert(false);
+} catch (e) {
+  assert(e instanceof SyntaxError);
+  assert(e.message === "baz");
+}
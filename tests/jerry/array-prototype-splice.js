@@ -174,3 +174,36 @@ try {
   assert (e.message === "foo");
   assert (e instanceof ReferenceError);
 }
+
+// Splicing dense arrays
+var array = [];
+for (var i = 0; i < 20; i++) {
+  array.push(i % 2 === 0 ? i : "s" + i);
+}
+
+var removed = array.splice(5, 10, 0.5, { a: 1 });
+assert(removed.length === 10 && removed[0] === "s5" && removed[9] === 14);
+assert(array.length === 12 && array[5] === 0.5 && array[6].a === 1 && array[7] === "s15" && array[11] === "s19");
+assert(!array.hasOwnProperty(12));
+
+removed = array.splice(1, 1, "x", "y", "z");
+assert(removed.length === 1 && removed[0] === "s1");
+assert(array.length === 14 && array[0] === 0 && array[1] === "x" && array[3] === "z" && array[4] === 2);
+assert(array[13] === "s19");
+
+removed = array.splice(0, 0, -1);
+assert(removed.length === 0 && array.length === 15 && array[0] === -1 && array[1] === 0);
+
+removed = array.splice(3);
+assert(removed.length === 12 && array.length === 3 && array[2] === "x");
+
+// Non-configurable elements cannot be deleted
+var array = [1, 2, 3];
+Object.defineProperty(array, '2', { configurable: false });
+
+try {
+  array.splice(0, 1);
+  assert(false);
+} catch (e) {
+  assert(e instanceof TypeError);
+}
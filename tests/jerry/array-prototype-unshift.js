@@ -102,3 +102,42 @@ assert(obj[0] === "baz");
 assert(obj[1] === "foo");
 assert(obj[2] === undefined);
 assert(obj[3] === "bar");
+
+// Unshift values of different types
+var array = ["a", 2.5];
+assert(array.unshift({ c: 1 }, 4, "d") === 5);
+assert(array[0].c === 1 && array[1] === 4 && array[2] === "d" && array[3] === "a" && array[4] === 2.5);
+
+// Inherited setters of the new indices are called
+var setter_calls = 0;
+Object.defineProperty(Array.prototype, '3', { set: function () { setter_calls++; }, configurable: true });
+
+var array = [1, 2, 3];
+assert(array.unshift(0) === 4);
+assert(setter_calls === 1);
+assert(array.length === 4 && !array.hasOwnProperty(3));
+assert(array[0] === 0 && array[1] === 1 && array[2] === 2);
+delete Array.prototype[3];
+
+// Non-extensible arrays cannot grow
+var array = [1, 2];
+Object.preventExtensions(array);
+
+try {
+  array.unshift(0);
+  assert(false);
+} catch (e) {
+  assert(e instanceof TypeError);
+}
+
+// Arrays with non-writable length cannot grow
+var array = [1, 2];
+Object.defineProperty(array, 'length', { writable: false });
+
+try {
+  array.unshift(0);
+  assert(false);
+} catch (e) {
+  assert(e instanceof TypeError);
+  assert(array.length === 2 && array[0] === 1 && array[1] === 2);
+}
@@ -0,0 +1,249 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Arithmetic
+assert (1 + 2 * 3 === 7);
+assert ((1 + 2) * 3 === 9);
+assert (7 - 10 === -3);
+assert (300 * 300 === 90000);
+assert (7 / 2 === 3.5);
+assert (7 % 3 === 1);
+assert (-7 % 3 === -1);
+assert (1 / 0 === Infinity);
+assert (-1 / 0 === -Infinity);
+assert (1 / (0 * -1) === -Infinity);
+assert (1 / -(0) === -Infinity);
+assert (1 / (0 - 0) === Infinity);
+assert (0.1 + 0.2 === 0.30000000000000004);
+assert (isNaN (0 / 0));
+assert (isNaN (5 % 0));
+assert ((0 / 0) !== (0 / 0));
+assert (-(-(3)) === 3);
+assert (+(4 + 5) === 9);
+
+// Bitwise operators
+assert ((5 | 2) === 7);
+assert ((6 & 3) === 2);
+assert ((6 ^ 3) === 5);
+assert (~5 === -6);
+assert (~(-1) === 0);
+assert (1 << 31 === -2147483648);
+assert (1 << 32 === 1);
+assert (-16 >> 2 === -4);
+assert (-1 >>> 0 === 4294967295);
+assert (-1 >>> 28 === 15);
+assert ((4294967296 + 5 | 0) === 5);
+
+// Strings
+assert ("ab" + "cd" === "abcd");
+assert ("a" + "b" + "c" + "d" === "abcd");
+assert (("" + "") === "");
+assert (("x" + "") .length === 1);
+assert ("árvíz" + "tűrő" === "árvíztűrő");
+assert ("\ud800" + "\udc00" === "𐀀");
+assert (("\ud800" + "\udc00").length === 2);
+assert ("1" + 2 === "12");
+assert (1 + "2" === "12");
+assert ("abc" == "abc");
+assert ("abc" !== "abd");
+assert (!("a" < "a"));
+assert ("a" < "b");
+
+var long_string = "0123456789" + "0123456789" + "0123456789" + "0123456789" + "0123456789"
+                  + "0123456789" + "0123456789" + "0123456789" + "0123456789" + "0123456789"
+                  + "0123456789" + "0123456789" + "0123456789" + "0123456789" + "0123456789"
+                  + "0123456789" + "0123456789" + "0123456789" + "0123456789" + "0123456789"
+                  + "0123456789" + "0123456789" + "0123456789" + "0123456789" + "0123456789"
+                  + "0123456789" + "0123456789" + "0123456789" + "0123456789" + "0123456789";
+assert (long_string.length === 300);
+assert (long_string.charAt (299) === "9");
+
+// Comparisons
+assert (5 < 7);
+assert (!(7 < 5));
+assert (5 <= 5);
+assert (5 >= 5);
+assert (!(5 > 5));
+assert (0 === -0);
+assert (!((0 / 0) < 1));
+assert (!((0 / 0) >= 1));
+assert (true == true);
+assert (true != false);
+assert (!0 === true);
+assert (!"" === true);
+assert (!"0" === false);
+assert (!(0 / 0) === true);
+assert (1 == true);
+assert ("1" == 1);
+
+// Constant conditions
+var a = 0;
+
+if (0)
+{
+  a = 1;
+}
+assert (a === 0);
+
+if (1)
+{
+  a = 2;
+}
+else
+{
+  a = 3;
+}
+assert (a === 2);
+
+if (0)
+{
+  a = 4;
+}
+else
+{
+  a = 5;
+}
+assert (a === 5);
+
+if ("")
+  a = 6;
+else if ("x")
+  a = 7;
+else
+  a = 8;
+assert (a === 7);
+
+if (1 - 1)
+{
+  a = 9;
+}
+assert (a === 7);
+
+// Function declarations in removed code are still hoisted.
+if (0)
+{
+  function dead_function () { return 10; }
+}
+assert (dead_function () === 10);
+
+function f (x)
+{
+  if (0)
+  {
+    return 1;
+  }
+  else
+  {
+    return x;
+  }
+}
+assert (f (11) === 11);
+
+function g ()
+{
+  if (1)
+  {
+    return 12;
+  }
+}
+assert (g () === 12);
+
+// Breaks from unreachable code are kept.
+var i = 0;
+while (true)
+{
+  i++;
+  if (i > 3)
+  {
+    break;
+  }
+  if (0)
+  {
+    break;
+  }
+}
+assert (i === 4);
+
+i = 0;
+outer: for (;;)
+{
+  if (0)
+  {
+    break outer;
+  }
+  if (++i === 5)
+  {
+    break;
+  }
+}
+assert (i === 5);
+
+i = 0;
+do
+{
+  i++;
+}
+while (0);
+assert (i === 1);
+
+i = 0;
+while (1)
+{
+  if (++i === 6)
+  {
+    break;
+  }
+}
+assert (i === 6);
+
+for (i = 0; 0; i++)
+{
+  assert (false);
+}
+assert (i === 0);
+
+label: if (0)
+{
+  a = 13;
+}
+assert (a === 7);
+
+a = 0;
+switch (1)
+{
+  case 1:
+    if (0)
+    {
+      a = 14;
+    }
+  case 2:
+    a++;
+}
+assert (a === 1);
+
+// Conditions with side effects are evaluated.
+a = 0;
+if ((a++, 0))
+{
+  a = 100;
+}
+assert (a === 1);
+
+assert (eval ("1 + 2") === 3);
+assert (eval ("if (0) 5; else 6") === 6);
+assert (eval ("if (1) 5; else 6") === 5);
+assert (eval ("7; if (0) 5;") === 7);
+assert (eval ("7; if (1) ; else 6") === 7);
+assert (eval ("7; do 5; while (0)") === 5);
@@ -0,0 +1,100 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var x = "global";
+var code = "(function () { return typeof this === 'undefined' ? 'strict' : 'sloppy'; }) ()";
+
+function sloppy ()
+{
+  var x = "local";
+  return [eval ("x"), (0, eval) ("x"), eval (code), (0, eval) (code)];
+}
+
+function strict ()
+{
+  "use strict";
+  var x = "local";
+  return [eval ("x"), (0, eval) ("x"), eval (code), (0, eval) (code)];
+}
+
+// The same source is evaluated repeatedly in different contexts
+for (var i = 0; i < 3; i++)
+{
+  assert (sloppy () == "local,global,sloppy,sloppy");
+  assert (strict () == "local,global,strict,sloppy");
+}
+
+// Functions created from a reused byte code are separate objects
+var counters = [];
+for (var i = 0; i < 4; i++)
+{
+  counters.push (eval ("(function () { var n = 0; return function () { return ++n; } }) ()"));
+}
+
+assert (counters[0] !== counters[1]);
+assert (counters[0] () === 1);
+assert (counters[0] () === 2);
+assert (counters[1] () === 1);
+
+// Variables declared by eval are created each time
+for (var i = 0; i < 3; i++)
+{
+  delete evalVariable;
+  assert (typeof evalVariable === "undefined");
+  eval ("var evalVariable = " + "i;".length);
+  assert (evalVariable === 2);
+}
+
+// Errors are reported every time
+for (var i = 0; i < 2; i++)
+{
+  try
+  {
+    eval ("var a = ;");
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+// Strict mode early errors depend on the context of the eval
+function strictError ()
+{
+  "use strict";
+  try
+  {
+    eval ("with ({}) {}");
+    return false;
+  }
+  catch (e)
+  {
+    return e instanceof SyntaxError;
+  }
+}
+
+assert (eval ("with ({}) { 5 }") === 5);
+assert (strictError ());
+assert (eval ("with ({}) { 5 }") === 5);
+
+// More sources than the capacity of the cache
+for (var j = 0; j < 2; j++)
+{
+  for (var i = 0; i < 20; i++)
+  {
+    assert (eval ("" + i + " * 2") === i * 2);
+  }
+}
@@ -281,3 +281,104 @@ assert(count == 1
            || 'base_prop2' in log
            || 'derived_prop1' in log
            || 'derived_prop2' in log));
+
+// 18.
+function keys_of (obj) {
+  var result = [];
+  for (var key in obj) {
+    result.push (key);
+  }
+  return result.join ();
+}
+
+function Point (x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+var points = [];
+for (var i = 0; i < 8; i++) {
+  points.push (new Point (i, i + 1));
+}
+
+for (var i = 0; i < points.length; i++) {
+  assert (keys_of (points[i]) === "x,y");
+}
+
+points[1].z = 3;
+assert (keys_of (points[1]) === "x,y,z");
+assert (keys_of (points[2]) === "x,y");
+
+delete points[2].x;
+assert (keys_of (points[2]) === "y");
+points[2].x = 0;
+assert (keys_of (points[2]) === "y,x");
+
+Object.defineProperty (points[3], "x", { enumerable: false });
+assert (keys_of (points[3]) === "y");
+assert (keys_of (points[4]) === "x,y");
+
+Point.prototype.w = 4;
+assert (keys_of (points[4]) === "x,y,w");
+Object.defineProperty (points[5], "w", { value: 5, enumerable: false });
+assert (keys_of (points[5]) === "x,y");
+assert (keys_of (points[6]) === "x,y,w");
+delete Point.prototype.w;
+assert (keys_of (points[6]) === "x,y");
+
+function OtherPoint (x, y) {
+  this.x = x;
+  this.y = y;
+}
+OtherPoint.prototype.v = 6;
+assert (keys_of (new OtherPoint (1, 2)) === "x,y,v");
+assert (keys_of (points[7]) === "x,y");
+
+var array = [1, 2, 3];
+assert (keys_of (array) === "0,1,2");
+array.push (4);
+assert (keys_of (array) === "0,1,2,3");
+assert (keys_of ([5, 6, 7]) === "0,1,2");
+assert (keys_of ("ab") === "0,1");
+assert (keys_of ("abc") === "0,1,2");
+
+// 19.
+var outer = new Point (1, 2);
+var inner_count = 0;
+log = [];
+
+for (var a in outer) {
+  for (var b in outer) {
+    inner_count++;
+  }
+  log.push (a);
+  delete outer.y;
+}
+
+assert (log.join () === "x");
+assert (inner_count === 2);
+
+function find_key (obj, key) {
+  for (var k in obj) {
+    if (k === key) {
+      return true;
+    }
+  }
+  return false;
+}
+
+for (var i = 0; i < 4; i++) {
+  assert (find_key (points[0], "x"));
+  assert (!find_key (points[0], "q"));
+}
+
+try {
+  for (var k in points[0]) {
+    throw k;
+  }
+  assert (false);
+} catch (e) {
+  assert (e === "x");
+}
+
+assert (keys_of (points[0]) === "x,y");
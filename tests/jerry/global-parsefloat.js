@@ -86,3 +86,24 @@ try {
   assert(e instanceof ReferenceError);
   assert(e.message === "foo");
 }
+
+/* The conversion is correctly rounded, including the half way cases. */
+var epsilon = 1 / 4503599627370496;
+
+assert(parseFloat("1608882928643910.2") === 1608882928643910 + 0.25);
+assert(parseFloat("1.00000000000000011102230246251565404236316680908203125") === 1);
+assert(parseFloat("1.00000000000000011102230246251565404236316680908203125000001") === 1 + epsilon);
+assert(parseFloat("1.00000000000000011102230246251565404236316680908203124999999") === 1);
+assert(parseFloat("1.00000000000000033306690738754696212708950042724609375") === 1 + 2 * epsilon);
+assert(parseFloat("9007199254740993") === 9007199254740992);
+assert(parseFloat("9007199254740993.0000000001") === 9007199254740994);
+assert(parseFloat("0.000001") === 1 / 1000000);
+assert(parseFloat("2.4703282292062327e-324") === 0);
+assert(parseFloat("2.4703282292062328e-324") === Number.MIN_VALUE);
+assert(parseFloat("1.7976931348623158e308") === Number.MAX_VALUE);
+assert(parseFloat("1.7976931348623159e308") === Infinity);
+assert(parseFloat("1e400") === Infinity);
+assert(parseFloat("1e-400") === 0);
+assert(parseFloat("12345678901234567890123.5e-3") === parseFloat("12345678901234567890.1235"));
+assert(String(parseFloat("0.1e-320")) === "1e-321");
+assert(String(parseFloat("000123456789012345678e-5")) === "1234567890123.4568");
@@ -78,3 +78,13 @@ try {
   assert(e instanceof ReferenceError);
   assert(e.message === "foo");
 }
+
+/* Radix 10 and 16 are correctly rounded. */
+assert(parseInt("9007199254740993") === 9007199254740992);
+assert(parseInt("9007199254740995") === 9007199254740996);
+assert(parseInt("-9007199254740995", 10) === -9007199254740996);
+assert(String(parseInt("123456789012345678901234567890")) === "1.2345678901234568e+29");
+assert(parseInt("0x20000000000003") === 9007199254740996);
+assert(parseInt("20000000000001", 16) === 9007199254740992);
+assert(String(parseInt("0x1fffffffffffff8000000000000000001")) === "6.80564733841877e+38");
+assert(parseInt("-00012.5e3") === -12);
@@ -370,3 +370,40 @@ assert (result.a == 1);
 
 result = JSON.parse(str, [1, 2, 3]);
 assert (result.a == 1);
+
+// Checking duplicated and repeated property names
+
+result = JSON.parse ('{"a":1,"b":2,"a":3}');
+assert (result.a === 3);
+assert (Object.keys (result).join () === "a,b");
+
+result = JSON.parse ('{"\\u0061b":1,"ab":2,"a\\u0062":3}');
+assert (result.ab === 3);
+assert (Object.keys (result).length === 1);
+
+str = "[";
+for (var i = 0; i < 1000; i++)
+{
+  str += (i > 0 ? "," : "") + '{"id":' + i + ',"name":"n' + i + '"}';
+}
+result = JSON.parse (str + "]");
+assert (result.length === 1000);
+assert (result[999].id === 999 && result[999].name === "n999");
+assert (Object.keys (result[500]).join () === "id,name");
+
+// Checking number conversion
+
+result = JSON.parse ('[-0, 0, 0.1, -0.000123, 1e5, 2.5E-3, 3.14159265358979, 0.30000000000000004,' +
+                     '123456789012345678, 1234567890.12345, 1.7976931348623157e308, 5e-324]');
+assert (1 / result[0] === -Infinity);
+assert (1 / result[1] === Infinity);
+assert (result[2] === 0.1);
+assert (result[3] === -0.000123);
+assert (result[4] === 100000);
+assert (result[5] === 0.0025);
+assert (result[6] === 3.14159265358979);
+assert (result[7] === 0.1 + 0.2);
+assert (result[8] === 123456789012345678);
+assert (result[9] === 1234567890.12345);
+assert (result[10] === Number.MAX_VALUE);
+assert (result[11] === Number.MIN_VALUE);
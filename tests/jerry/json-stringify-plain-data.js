@@ -0,0 +1,121 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+// Copyright 2015 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Plain data is serialized without calling user code. A replacer function
+ * forces the standard algorithm, which must produce the same result. */
+function identity (key, value)
+{
+  return value;
+}
+
+var seed = 1;
+
+function random (n)
+{
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed % n;
+}
+
+function generate (depth)
+{
+  switch (random (depth > 3 ? 7 : 10))
+  {
+    case 0:
+      return random (1000) - 500;
+    case 1:
+      return (random (100000) - 50000) / 7;
+    case 2:
+      return [ "a", "", "é\n\"\\", "\u0001x", "long string value" ][random (5)];
+    case 3:
+      return [ true, false, null, undefined, NaN, Infinity, -0, 1e21, 1.5e-7, function () {} ][random (10)];
+    case 4:
+      return 2147483647 + random (3);
+    case 5:
+      return -1073741824 - random (3);
+    case 6:
+      return String (random (10));
+    case 7:
+    case 8:
+    {
+      var array = [];
+      var length = random (5);
+
+      for (var i = 0; i < length; i++)
+      {
+        array.push (generate (depth + 1));
+      }
+
+      if (random (4) == 0)
+      {
+        array[length + 1] = 1;
+      }
+      return array;
+    }
+    default:
+    {
+      var object = {};
+      var count = random (5);
+
+      for (var i = 0; i < count; i++)
+      {
+        object[[ "x", "y", "1", "0", "ké", "\"q" ][random (6)] + random (3)] = generate (depth + 1);
+      }
+      return object;
+    }
+  }
+}
+
+var gaps = [ undefined, 2, "--", 0 ];
+
+for (var i = 0; i < 500; i++)
+{
+  var value = generate (0);
+  var gap = gaps[random (4)];
+
+  assert (JSON.stringify (value, null, gap) === JSON.stringify (value, identity, gap));
+}
+
+/* Cyclic structures. */
+var cyclic = { a: 1 };
+cyclic.b = { c: cyclic };
+
+try
+{
+  JSON.stringify (cyclic);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+
+var shared = { x: 1 };
+assert (JSON.stringify ([ shared, { y: shared } ]) === '[{"x":1},{"y":{"x":1}}]');
+
+/* Values which need the standard algorithm. */
+Object.prototype.toJSON = function () { return 5; };
+assert (JSON.stringify ({ a: 1 }) === "5");
+delete Object.prototype.toJSON;
+
+Array.prototype[1] = "proto";
+assert (JSON.stringify ([ 1, , 3 ]) === '[1,"proto",3]');
+delete Array.prototype[1];
+
+assert (JSON.stringify ([ 1, , 3 ]) === '[1,null,3]');
+assert (JSON.stringify ([ new Number (3), new String ("s"), new Boolean (false) ]) === '[3,"s",false]');
+assert (JSON.stringify ({ d: new Date (0) }) === '{"d":"1970-01-01T00:00:00.000Z"}');
+assert (JSON.stringify ({ a: [], b: {}, c: [ {} ] }, null, 1) === '{\n "a": [],\n "b": {},\n "c": [\n  {}\n ]\n}');
+assert (JSON.stringify ({ a: undefined, b: function () {} }) === "{}");
+assert (JSON.stringify ([ -0, 0.1, 1e-7, 123456789012 ]) === "[0,0.1,1e-7,123456789012]");
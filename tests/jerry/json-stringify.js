@@ -213,3 +213,16 @@ assert (JSON.stringify (object, null, undefined) == '{"a":2}');
 assert (JSON.stringify (object, null, new Boolean (true)) == '{"a":2}');
 assert (JSON.stringify (object, null, [1, 2, 3] ) == '{"a":2}');
 assert (JSON.stringify (object, null, { "a": 3 }) == '{"a":2}');
+
+// Checking escapes mixed with longer unescaped character sequences
+assert (JSON.stringify ("\u0001\b\f\n\r\t\"\\é\u001f") == '"\\u0001\\b\\f\\n\\r\\t\\"\\\\é\\u001f"');
+assert (JSON.stringify ("abc\ndef\u00e9ghi") == '"abc\\ndef\u00e9ghi"');
+
+var long_string = "";
+for (var i = 0; i < 3000; i++)
+{
+  long_string += String.fromCharCode (i % 300);
+}
+assert (JSON.parse (JSON.stringify (long_string)) === long_string);
+
+assert (JSON.stringify ({ a: [1, "x", { b: null }] }, null, 2) == '{\n  "a": [\n    1,\n    "x",\n    {\n      "b": null\n    }\n  ]\n}');
@@ -0,0 +1,82 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check_syntax_error (code)
+{
+  try
+  {
+    eval (code);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+var keywords = [ "do", "if", "in", "for", "new", "try", "var", "case", "else", "enum",
+                 "null", "this", "true", "void", "with", "break", "catch", "class", "const",
+                 "false", "super", "throw", "while", "delete", "export", "import", "return",
+                 "switch", "typeof", "default", "extends", "finally", "continue", "debugger",
+                 "function", "instanceof" ];
+
+for (var i = 0; i < keywords.length; i++)
+{
+  check_syntax_error ("var " + keywords[i] + " = 1;");
+
+  // Identifiers which only differ from the keywords in a few characters.
+  var names = [ keywords[i] + "x",
+                keywords[i].substring (1),
+                keywords[i].toUpperCase (),
+                "$" + keywords[i],
+                keywords[i].substring (0, keywords[i].length - 1) + "_" ];
+
+  for (var j = 0; j < names.length; j++)
+  {
+    assert (eval ("var " + names[j] + " = " + i + "; " + names[j]) === i);
+  }
+}
+
+var future_reserved = [ "let", "yield", "public", "static", "package", "private",
+                        "interface", "protected", "implements" ];
+
+for (var i = 0; i < future_reserved.length; i++)
+{
+  assert (eval ("var " + future_reserved[i] + " = " + i + "; " + future_reserved[i]) === i);
+  check_syntax_error ("'use strict'; var " + future_reserved[i] + " = 1;");
+}
+
+// Identifiers which have the same hash as a shorter keyword.
+var same_hash = [ "acxu", "aaxxm", "aaxxxa", "aaxxxxm", "aaxxxxxm", "abxxxxxxl", "aaxxxxxxxl", "acxxxxxxxl" ];
+
+for (var i = 0; i < same_hash.length; i++)
+{
+  assert (eval ("var " + same_hash[i] + " = " + i + "; " + same_hash[i]) === i);
+}
+
+var aaxxxxxxxl = 2;
+assert (aaxxxxxxxl === 2);
+
+// Keywords written with escape sequences are identifiers.
+var \u0069f = 5;
+assert (\u0069f === 5);
+var a\u0062c = 6;
+assert (abc === 6);
+var árvíz = 7;
+assert (árvíz === 7);
+
+// Comments with non-ASCII characters.
+/* árvíztűrő * tükörfúrógép ** / */ var x = /*   */ 8 // árvíz
+assert (x === 8);
@@ -0,0 +1,60 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Number keys which are not array indices are converted to the same names as strings. */
+var map = {};
+
+map[-1] = "a";
+map[0.5] = "b";
+map[1e21] = "c";
+map[-0] = "d";
+
+assert (map["-1"] === "a");
+assert (map["0.5"] === "b");
+assert (map["1e+21"] === "c");
+assert (map["0"] === "d");
+assert (map[-1] === "a" && map[0.5] === "b" && map[1e21] === "c");
+assert ("abc"[-1] === undefined);
+
+/* More keys than the entries of the conversion cache. */
+for (var i = 0; i < 200; i++)
+{
+  map[-i - 2] = i;
+  map[i + 0.5] = -i;
+}
+
+for (var i = 0; i < 200; i++)
+{
+  assert (map[-i - 2] === i);
+  assert (map[String (i + 0.5)] === -i);
+  assert (delete map[i + 0.5]);
+  assert (map[i + 0.5] === undefined);
+}
+
+/* The same name is shared by many objects. */
+var objects = [];
+
+for (var i = 0; i < 5000; i++)
+{
+  var obj = {};
+  obj[-1.5] = i;
+  objects.push (obj);
+}
+
+for (var i = 0; i < objects.length; i++)
+{
+  assert (objects[i][-1.5] === i);
+  assert (Object.keys (objects[i])[0] === "-1.5");
+}
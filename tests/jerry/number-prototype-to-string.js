@@ -121,3 +121,27 @@ try {
 } catch (e) {
   assert(e instanceof RangeError);
 }
+
+// Shortest representation: the closest and even digits are selected
+assert (String (2 / 67108864) === "2.9802322387695312e-8");
+assert (String (34517 / 262144) === "0.13167190551757812");
+assert (String (1 / 1125899906842624) === "8.881784197001252e-16");
+assert (String (0.1 + 0.2) === "0.30000000000000004");
+assert (String (1 / 3) === "0.3333333333333333");
+assert (String (5e-324) === "5e-324");
+assert (String (1.7976931348623157e308) === "1.7976931348623157e+308");
+assert (String (123e-20) === "1.23e-18");
+assert (String (1e21) === "1e+21");
+assert (String (0.000001) === "0.000001");
+assert (String (1e-7) === "1e-7");
+
+// Integer conversion
+assert (String (0) === "0");
+assert (String (7) === "7");
+assert (String (10) === "10");
+assert (String (99) === "99");
+assert (String (100) === "100");
+assert (String (123456789) === "123456789");
+assert (String (4294967295) === "4294967295");
+assert (String (4294967296) === "4294967296");
+assert (String (-1000000000) === "-1000000000");
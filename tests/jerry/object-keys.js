@@ -97,3 +97,31 @@ props = Object.keys(o);
 assert(props.length === 2);
 assert(o[props[0]] === "OK");
 assert(o[props[1]] === "OK");
+
+function make (a, b) {
+  return { a: a, b: b };
+}
+
+for (var i = 0; i < 4; i++) {
+  var keys = Object.keys (make (i, i));
+  assert (keys.length === 2 && keys[0] === "a" && keys[1] === "b");
+  keys.push ("c");
+}
+
+var m = make (1, 2);
+m.c = 3;
+assert (Object.keys (m).join () === "a,b,c");
+delete m.a;
+assert (Object.keys (m).join () === "b,c");
+Object.defineProperty (m, "b", { enumerable: false });
+assert (Object.keys (m).join () === "c");
+assert (Object.keys (make (1, 2)).join () === "a,b");
+
+var proto = { p: 1 };
+var child = Object.create (proto);
+child.a = 1;
+assert (Object.keys (child).join () === "a");
+proto.q = 2;
+assert (Object.keys (child).join () === "a");
+assert (Object.keys (Object.create (null)).length === 0);
+assert (Object.keys ([3, 4]).join () === "0,1");
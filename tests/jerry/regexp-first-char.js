@@ -0,0 +1,72 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var r;
+var log = "INFO: started; WARN: slow; ERROR: 42; ERROR: 7";
+
+// Literal prefix
+r = /ERROR: (\d+)/;
+assert (r.exec (log) == "ERROR: 42,42");
+assert (r.exec (log).index === 27);
+assert (r.exec ("ERROR: x") === null);
+assert (r.exec ("ERROR:") === null);
+assert (r.exec ("") === null);
+
+r = /ERROR: (\d+)/g;
+assert (r.exec (log) == "ERROR: 42,42");
+assert (r.lastIndex === 36);
+assert (r.exec (log) == "ERROR: 7,7");
+assert (r.lastIndex === 46);
+assert (r.exec (log) === null);
+assert (r.lastIndex === 0);
+
+r = /árvíz(tűrő)?/;
+assert (r.exec ("tükör árvíztűrő").index === 6);
+assert (r.exec ("árví") === null);
+
+r = /aab/;
+assert (r.exec ("aaaab").index === 2);
+
+// First character set
+r = /[EW][A-Z]+: (\w+)/;
+assert (r.exec (log) == "WARN: slow,slow");
+
+r = /(?:foo|bár)+/i;
+assert (r.exec ("xx BáRfoo") == "BáRfoo");
+assert (r.exec ("xx bá") === null);
+
+r = /\d+|x/;
+assert (r.exec ("abc x 12").index === 4);
+assert (r.exec ("abc 12 x").index === 4);
+
+r = /a*b/;
+assert (r.exec ("ccaab").index === 2);
+assert (r.exec ("cccb").index === 3);
+
+r = /[á-ű]{2}/;
+assert (r.exec ("aáéb") == "áé");
+
+r = /\bis\b/g;
+assert ("This island is".replace (r, "IS") === "This island IS");
+
+// Patterns which can match the empty string at any position
+r = /a*/;
+assert (r.exec ("bbb").index === 0);
+
+r = /(?:a|)b?/g;
+assert ("cc".replace (r, "-") === "-c-c-");
+
+assert ("a1b22c333".split (/\d+/).length === 4);
+assert ("a1b22c333".replace (/\d+/g, "#") === "a#b#c#");
@@ -0,0 +1,86 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var r;
+var input = "";
+
+for (var i = 0; i < 64; i++)
+{
+  input += "a";
+}
+
+// These patterns need exponential time with backtracking
+r = new RegExp ("(a|aa)*b");
+assert (r.exec (input) === null);
+assert (r.exec (input + "b")[0] === input + "b");
+assert (r.exec (input + "b")[1] === "a");
+
+r = new RegExp ("^(a+)+$");
+assert (r.test (input));
+assert (!r.test (input + "!"));
+
+r = new RegExp ("(?:a|a)*c");
+assert (!r.test (input));
+
+// Priority of the alternatives and iterations
+r = new RegExp ("(a|ab)(c|bcd)(d*)");
+assert (r.exec ("abcd") == "abcd,a,bcd,");
+
+r = new RegExp ("(a+?)(a*)");
+assert (r.exec ("aaa") == "aaa,a,aa");
+
+r = new RegExp ("(a{1,2}?)(a{0,2})b");
+assert (r.exec ("xaaab") == "aaab,a,aa");
+assert (r.exec ("xaaab").index === 1);
+
+// The captures inside an iteration are reset before each iteration
+r = new RegExp ("(?:(a)|b)+");
+assert (r.exec ("ab") == "ab,");
+assert (r.exec ("ab")[1] === undefined);
+
+r = new RegExp ("(z)((a+)?(b+)?(c))*");
+assert (r.exec ("zaacbbbcac") == "zaacbbbcac,z,ac,a,,c");
+assert (r.exec ("zaacbbbcac")[4] === undefined);
+
+r = new RegExp ("((a)|b){2}");
+assert (r.exec ("ab") == "ab,b,");
+
+// The lookahead routes the pattern to the backtracking matcher,
+// which keeps the captures of the earlier iterations
+r = new RegExp ("(?:(a)|b)+(?=)");
+assert (r.exec ("ab") == "ab,a");
+
+r = new RegExp ("(\\w+)\\s(\\w+)");
+assert (r.exec ("John Smith") == "John Smith,John,Smith");
+
+r = new RegExp ("\\bis\\b", "g");
+var str = "This island is beautiful";
+assert (r.exec (str).index === 12);
+assert (r.lastIndex === 14);
+assert (r.exec (str) === null);
+assert (r.lastIndex === 0);
+
+r = new RegExp ("^b|c$", "m");
+assert (r.exec ("a\nb").index === 2);
+assert (r.exec ("c\na").index === 0);
+
+r = new RegExp ("[a-c]+", "i");
+assert (r.exec ("xxABCabcd") == "ABCabc");
+
+r = new RegExp ("árvíz(tűrő)?");
+assert (r.exec ("árvíztűrő tükör") == "árvíztűrő,tűrő");
+
+assert ("aaa".replace (/a*?/g, "-") === "-a-a-a-");
+assert ("a,b,,c".split (/,/).length === 4);
@@ -112,3 +112,27 @@ assert(String.prototype.indexOf.call(test_object, "Obj") === 8);
 
 // check coercible - Number
 assert(String.prototype.indexOf.call(123, "2") === 1);
+
+// empty search string
+assert("abc".indexOf("", 2) === 2);
+assert("abc".indexOf("", 5) === 3);
+
+// long strings
+var long_string = "";
+for (var i = 0; i < 100; i++) {
+  long_string += "abcdefghij";
+}
+long_string += "needle" + long_string;
+
+assert(long_string.indexOf("needle") === 1000);
+assert(long_string.indexOf("needle", 1000) === 1000);
+assert(long_string.indexOf("needle", 1001) === -1);
+assert(long_string.indexOf("jabc", 3) === 9);
+assert(long_string.indexOf("jneedlea") === 999);
+
+// non-ascii strings
+assert("árvíztűrő tükörfúrógép".indexOf("tük") === 10);
+assert("árvíztűrő tükörfúrógép".indexOf("ép", 5) === 20);
+assert("𐐀\ud801".indexOf("\ud801", 1) === 2);
+assert("𐐀\ud801".indexOf("\udc00") === 1);
+assert("xáyáz".indexOf("á", 2) === 3);
@@ -126,3 +126,27 @@ assert(String.prototype.lastIndexOf.call(test_object, "Obj") === 8);
 
 // check coercible - Number
 assert(String.prototype.lastIndexOf.call(123, "2") === 1);
+
+// empty search string
+assert("abc".lastIndexOf("", 1) === 1);
+assert("abc".lastIndexOf("") === 3);
+
+// long strings
+var long_string = "";
+for (var i = 0; i < 100; i++) {
+  long_string += "abcdefghij";
+}
+long_string += "needle" + long_string;
+
+assert(long_string.lastIndexOf("needle") === 1000);
+assert(long_string.lastIndexOf("needle", 1000) === 1000);
+assert(long_string.lastIndexOf("needle", 999) === -1);
+assert(long_string.lastIndexOf("abc", 5) === 0);
+assert(long_string.lastIndexOf("ij") === 2004);
+
+// non-ascii strings
+assert("árvíztűrő tükörfúrógép".lastIndexOf("r") === 17);
+assert("árvíztűrő tükörfúrógép".lastIndexOf("r", 16) === 14);
+assert("𐐀\ud801".lastIndexOf("\ud801", 1) === 0);
+assert("𐐀\ud801".lastIndexOf("\udc00") === 1);
+assert("xáyáz".lastIndexOf("á", 2) === 1);
@@ -159,3 +159,24 @@ catch (e)
   assert (e instanceof ReferenceError);
   assert (e.message === "foo");
 }
+
+/* Check string separators */
+var res = "a, b, c".split(", ");
+assert (res.length === 3);
+assert (res[0] === "a" && res[1] === "b" && res[2] === "c");
+
+res = ", a, , b, ".split(", ");
+assert (res.length === 5);
+assert (res[0] === "" && res[1] === "a" && res[2] === "" && res[3] === "b" && res[4] === "");
+
+res = "áéáí".split("á");
+assert (res.length === 3);
+assert (res[0] === "" && res[1] === "é" && res[2] === "í");
+
+res = "a1b2c3".split("", 4);
+assert (res.length === 4);
+assert (res[0] === "a" && res[1] === "1" && res[2] === "b" && res[3] === "2");
+
+res = "no separator".split("#");
+assert (res.length === 1);
+assert (res[0] === "no separator");
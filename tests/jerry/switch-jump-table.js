@@ -0,0 +1,267 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function integer_switch (value)
+{
+  switch (value)
+  {
+    case -2:
+      return "m2";
+    case -1:
+      return "m1";
+    case 0:
+      return "zero";
+    case 1:
+      return "one";
+    case 3:
+      return "three";
+    default:
+      return "default";
+  }
+}
+
+assert (integer_switch (-2) === "m2");
+assert (integer_switch (-1) === "m1");
+assert (integer_switch (0) === "zero");
+assert (integer_switch (-0) === "zero");
+assert (integer_switch (1) === "one");
+assert (integer_switch (2) === "default");
+assert (integer_switch (3) === "three");
+assert (integer_switch (4) === "default");
+assert (integer_switch (-3) === "default");
+assert (integer_switch (6 / 2) === "three");
+assert (integer_switch (0.5) === "default");
+assert (integer_switch (-1.5) === "default");
+assert (integer_switch (1e300) === "default");
+assert (integer_switch (-Infinity) === "default");
+assert (integer_switch (NaN) === "default");
+assert (integer_switch ("1") === "default");
+assert (integer_switch (true) === "default");
+assert (integer_switch (null) === "default");
+assert (integer_switch (undefined) === "default");
+assert (integer_switch (new Number (1)) === "default");
+
+/* Fall through, default case in the middle and breaks. */
+function fall_through (value)
+{
+  var str = "";
+
+  switch (value)
+  {
+    case 4:
+      str += "4";
+    case 5:
+      str += "5";
+      break;
+    default:
+      str += "d";
+    case 6:
+      str += "6";
+    case 7:
+      str += "7";
+      break;
+    case 8:
+      str += "8";
+  }
+  return str;
+}
+
+assert (fall_through (4) === "45");
+assert (fall_through (5) === "5");
+assert (fall_through (6) === "67");
+assert (fall_through (7) === "7");
+assert (fall_through (8) === "8");
+assert (fall_through (9) === "d67");
+assert (fall_through ("4") === "d67");
+
+/* Switch statements in loops. */
+var str = "";
+
+outer:
+for (var i = 0; i < 8; i++)
+{
+  switch (i)
+  {
+    case 1:
+      str += "a";
+      continue;
+    case 2:
+      str += "b";
+      break;
+    case 3:
+      str += "c";
+      continue outer;
+    case 4:
+      break outer;
+    case 0:
+      str += "z";
+  }
+  str += "-";
+}
+
+assert (str === "z-ab-c");
+
+/* Duplicated values: the first case is selected. */
+function duplicated (value)
+{
+  switch (value)
+  {
+    case 1:
+      return 1;
+    case 2:
+      return 2;
+    case 1:
+      return 3;
+    case 3:
+      return 4;
+    case 4:
+      return 5;
+  }
+}
+
+assert (duplicated (1) === 1);
+assert (duplicated (2) === 2);
+assert (duplicated (3) === 4);
+assert (duplicated (4) === 5);
+assert (duplicated (5) === undefined);
+
+/* Case expressions with side effects must be evaluated in order. */
+var counter = 0;
+
+function side_effect (value)
+{
+  switch (value)
+  {
+    case 0:
+      return "a";
+    case 1:
+      return "b";
+    case (counter++, 2):
+      return "c";
+    case 3:
+      return "d";
+  }
+  return "e";
+}
+
+assert (side_effect (0) === "a" && counter === 0);
+assert (side_effect (3) === "d" && counter === 1);
+assert (side_effect (5) === "e" && counter === 2);
+
+function string_switch (value)
+{
+  switch (value)
+  {
+    case "apple":
+      return 1;
+    case "banana":
+      return 2;
+    case "cherry":
+      return 3;
+    case "":
+      return 4;
+    case "árvíz":
+      return 5;
+    case "12":
+      return 6;
+    case "length":
+      return 7;
+    default:
+      return 0;
+  }
+}
+
+assert (string_switch ("apple") === 1);
+assert (string_switch ("banana") === 2);
+assert (string_switch ("cher" + "ry") === 3);
+assert (string_switch ("") === 4);
+assert (string_switch ("árvíz") === 5);
+assert (string_switch (String (12)) === 6);
+assert (string_switch ("length") === 7);
+assert (string_switch (12) === 0);
+assert (string_switch ("Apple") === 0);
+assert (string_switch (new String ("apple")) === 0);
+assert (string_switch (undefined) === 0);
+assert (string_switch ({}) === 0);
+
+/* Non-matching strings must not select a case even if their hash is the same. */
+var names = [ "apple", "banana", "cherry", "", "árvíz", "12", "length" ];
+
+for (var i = 0; i < 2000; i++)
+{
+  var name = "s" + i;
+  assert (string_switch (name) === 0);
+  assert (string_switch (String.fromCharCode (i)) === 0);
+}
+
+for (var i = 0; i < names.length; i++)
+{
+  assert (string_switch (names[i]) === i + 1);
+}
+
+/* Large generated tables. */
+function build_switch (count, prefix)
+{
+  var source = "(function (value) { switch (value) {";
+
+  for (var i = 0; i < count; i++)
+  {
+    var key = prefix === undefined ? String (i * 2 - count) : "'" + prefix + i + "'";
+    source += "case " + key + ": return " + i + ";";
+  }
+
+  return eval (source + "default: return -1; } })");
+}
+
+var int_table = build_switch (120);
+
+for (var i = -130; i < 130; i++)
+{
+  var expected = (i % 2 === 0 && i >= -120 && i < 120) ? (i + 120) / 2 : -1;
+  assert (int_table (i) === expected);
+}
+
+var str_table = build_switch (100, "key");
+
+for (var i = 0; i < 110; i++)
+{
+  assert (str_table ("key" + i) === (i < 100 ? i : -1));
+  assert (str_table ("Key" + i) === -1);
+}
+
+/* Mixed case types use the comparison chain. */
+function mixed (value)
+{
+  switch (value)
+  {
+    case 1:
+      return "one";
+    case "1":
+      return "string one";
+    case 2:
+      return "two";
+    case 3:
+      return "three";
+  }
+}
+
+assert (mixed (1) === "one");
+assert (mixed ("1") === "string one");
+assert (mixed (3) === "three");
+assert (mixed (4) === undefined);
+
+/* Completion value of switch statements. */
+assert (eval ("switch (2) { case 1: 'a'; case 2: 'b'; case 3: 'c'; break; case 4: 'd'; }") === "c");
+assert (eval ("7; switch ('x') { case 'a': 1; case 'b': 2; case 'c': 3; case 'd': 4; }") === 7);
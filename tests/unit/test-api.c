@@ -295,6 +295,54 @@ test_run_simple (const char *script_p) /**< source code to run */
   return jerry_run_simple ((const jerry_char_t *) script_p, script_size, JERRY_INIT_EMPTY);
 } /* test_run_simple */
 
+static size_t
+read_source_chunk (jerry_char_t *buffer_p, /**< destination buffer */
+                   size_t buffer_size, /**< size of the buffer */
+                   void *user_data_p) /**< pointer to the unread part of a zero terminated source */
+{
+  const char **source_pp = (const char **) user_data_p;
+  size_t size = strlen (*source_pp);
+
+  /* Small chunks, which split the tokens */
+  if (size > 7)
+  {
+    size = 7;
+  }
+
+  if (size > buffer_size)
+  {
+    size = buffer_size;
+  }
+
+  memcpy (buffer_p, *source_pp, size);
+  *source_pp += size;
+  return size;
+} /* read_source_chunk */
+
+/**
+ * Buffer which collects a serialized JSON text
+ */
+typedef struct
+{
+  char text[128]; /**< collected text */
+  jerry_size_t size; /**< size of the collected text */
+  uint32_t calls; /**< number of the callback calls */
+} json_buffer_t;
+
+static void
+write_json_chunk (const jerry_char_t *buffer_p, /**< JSON text */
+                  jerry_size_t buffer_size, /**< size of the chunk */
+                  void *user_data_p) /**< json_buffer_t */
+{
+  json_buffer_t *json_buffer_p = (json_buffer_t *) user_data_p;
+
+  TEST_ASSERT (json_buffer_p->size + buffer_size < sizeof (json_buffer_p->text));
+  memcpy (json_buffer_p->text + json_buffer_p->size, buffer_p, buffer_size);
+  json_buffer_p->size += buffer_size;
+  json_buffer_p->text[json_buffer_p->size] = '\0';
+  json_buffer_p->calls++;
+} /* write_json_chunk */
+
 int
 main (void)
 {
@@ -824,5 +872,365 @@ main (void)
     jerry_cleanup ();
   }
 
+  // Dump / execute snapshot with regular expressions
+  if (true)
+  {
+    static uint8_t regexp_snapshot_buffer[2048];
+
+    const char *regexp_code_p = "/ERROR: (\\d+)/g.exec ('ERROR: 42')[1] + /[a-c]+|x/i.exec ('yCab')[0];";
+
+    jerry_init (JERRY_INIT_EMPTY);
+    size_t regexp_snapshot_size = jerry_parse_and_save_snapshot ((jerry_char_t *) regexp_code_p,
+                                                                 strlen (regexp_code_p),
+                                                                 true,
+                                                                 false,
+                                                                 regexp_snapshot_buffer,
+                                                                 sizeof (regexp_snapshot_buffer));
+    TEST_ASSERT (regexp_snapshot_size != 0);
+    jerry_cleanup ();
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    res = jerry_exec_snapshot (regexp_snapshot_buffer, regexp_snapshot_size, false);
+
+    TEST_ASSERT (!jerry_value_has_error_flag (res));
+    TEST_ASSERT (jerry_value_is_string (res));
+    sz = jerry_get_string_size (res);
+    TEST_ASSERT (sz == 5);
+    sz = jerry_string_to_char_buffer (res, (jerry_char_t *) buffer, sz);
+    TEST_ASSERT (sz == 5);
+    jerry_release_value (res);
+    TEST_ASSERT (!strncmp (buffer, "42Cab", (size_t) sz));
+
+    jerry_cleanup ();
+  }
+
+  // Dump / execute snapshot with literals referenced in place
+  if (true)
+  {
+    static uint8_t literal_snapshot_buffer[1024];
+
+    const char *literal_code_p = ("var snapshotObject = { longPropertyName: 'value of property',"
+                                  "                       '123456789': '\xc3\xa1rv\xc3\xadzt\xc5\xb1r\xc5\x91' };"
+                                  "snapshotObject.longPropertyName + snapshotObject[123456789].length;");
+
+    jerry_init (JERRY_INIT_EMPTY);
+    size_t literal_snapshot_size = jerry_parse_and_save_snapshot ((jerry_char_t *) literal_code_p,
+                                                                  strlen (literal_code_p),
+                                                                  true,
+                                                                  false,
+                                                                  literal_snapshot_buffer,
+                                                                  sizeof (literal_snapshot_buffer));
+    TEST_ASSERT (literal_snapshot_size != 0);
+    jerry_cleanup ();
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    res = jerry_exec_snapshot (literal_snapshot_buffer, literal_snapshot_size, false);
+
+    TEST_ASSERT (!jerry_value_has_error_flag (res));
+    TEST_ASSERT (jerry_value_is_string (res));
+    sz = jerry_get_string_size (res);
+    TEST_ASSERT (sz == 18);
+    sz = jerry_string_to_char_buffer (res, (jerry_char_t *) buffer, sz);
+    TEST_ASSERT (sz == 18);
+    jerry_release_value (res);
+    TEST_ASSERT (!strncmp (buffer, "value of property9", (size_t) sz));
+
+    /* Strings created by the API must match the literals of the snapshot. */
+    jerry_value_t global_obj_val = jerry_get_global_object ();
+    jerry_value_t object_name_val = jerry_create_string ((jerry_char_t *) "snapshotObject");
+    jerry_value_t object_val = jerry_get_property (global_obj_val, object_name_val);
+    TEST_ASSERT (jerry_value_is_object (object_val));
+
+    jerry_value_t prop_name_val = jerry_create_string ((jerry_char_t *) "longPropertyName");
+    jerry_value_t prop_val = jerry_get_property (object_val, prop_name_val);
+    TEST_ASSERT (jerry_value_is_string (prop_val));
+    TEST_ASSERT (jerry_get_string_length (prop_val) == 17);
+
+    jerry_release_value (prop_val);
+    jerry_release_value (prop_name_val);
+    jerry_release_value (object_val);
+    jerry_release_value (object_name_val);
+    jerry_release_value (global_obj_val);
+
+    jerry_cleanup ();
+  }
+
+  // Dump / execute snapshot bundle
+  if (true)
+  {
+    /* The byte code of the modules is larger than the area addressable by 16 bit offsets. */
+    static uint8_t bundle_snapshot_buffer[768 * 1024];
+    static char large_module_source[48 * 1024];
+
+    const char *module_prefix_p = "var r = 0;\n";
+    const char *module_line_p = "r += (function (a) { return a; }) (1);\n";
+    size_t large_module_size = 0;
+
+    memcpy (large_module_source, module_prefix_p, strlen (module_prefix_p));
+    large_module_size += strlen (module_prefix_p);
+
+    for (int i = 0; i < 1000; i++)
+    {
+      memcpy (large_module_source + large_module_size, module_line_p, strlen (module_line_p));
+      large_module_size += strlen (module_line_p);
+    }
+
+    large_module_source[large_module_size++] = 'r';
+
+    const char *lazy_module_p = ("function outer () {"
+                                 "  function inner (n) { return n <= 1 ? 1 : n * inner (n - 1); }"
+                                 "  function unused () { return function () { return 'never created'; }; }"
+                                 "  return inner;"
+                                 "}"
+                                 "outer () (5) + (function fact (n) { return n <= 1 ? 1 : n * fact (n - 1); }) (4);");
+
+    jerry_snapshot_source_t bundle_sources[21];
+
+    bundle_sources[0].source_p = (const jerry_char_t *) lazy_module_p;
+    bundle_sources[0].source_size = strlen (lazy_module_p);
+
+    for (int i = 1; i < 21; i++)
+    {
+      bundle_sources[i].source_p = (const jerry_char_t *) large_module_source;
+      bundle_sources[i].source_size = large_module_size;
+    }
+
+    jerry_init (JERRY_INIT_EMPTY);
+    size_t bundle_snapshot_size = jerry_parse_and_save_snapshot_bundle (bundle_sources,
+                                                                        21,
+                                                                        true,
+                                                                        false,
+                                                                        bundle_snapshot_buffer,
+                                                                        sizeof (bundle_snapshot_buffer));
+    TEST_ASSERT (bundle_snapshot_size > 0xffffu * 8u);
+    jerry_cleanup ();
+
+    TEST_ASSERT (jerry_get_snapshot_module_count (bundle_snapshot_buffer, bundle_snapshot_size) == 21);
+
+    for (int copy_bytecode = 0; copy_bytecode < 2; copy_bytecode++)
+    {
+      jerry_init (JERRY_INIT_EMPTY);
+
+      res = jerry_exec_snapshot_module (bundle_snapshot_buffer, bundle_snapshot_size, 0, copy_bytecode != 0);
+      TEST_ASSERT (jerry_value_is_number (res));
+      TEST_ASSERT (jerry_get_number_value (res) == 144.0);
+      jerry_release_value (res);
+
+      res = jerry_exec_snapshot_module (bundle_snapshot_buffer, bundle_snapshot_size, 20, copy_bytecode != 0);
+      TEST_ASSERT (jerry_value_is_number (res));
+      TEST_ASSERT (jerry_get_number_value (res) == 1000.0);
+      jerry_release_value (res);
+
+      res = jerry_exec_snapshot_module (bundle_snapshot_buffer, bundle_snapshot_size, 21, copy_bytecode != 0);
+      TEST_ASSERT (jerry_value_has_error_flag (res));
+      jerry_release_value (res);
+
+      jerry_cleanup ();
+    }
+
+    /* All modules are executed, and the result of the last one is returned. */
+    jerry_init (JERRY_INIT_EMPTY);
+
+    res = jerry_exec_snapshot (bundle_snapshot_buffer, bundle_snapshot_size, false);
+    TEST_ASSERT (jerry_value_is_number (res));
+    TEST_ASSERT (jerry_get_number_value (res) == 1000.0);
+    jerry_release_value (res);
+
+    jerry_cleanup ();
+  }
+
+  // Test: RegExp cache
+  jerry_init (JERRY_INIT_EMPTY);
+  jerry_set_regexp_cache_size (2);
+
+  jerry_regexp_cache_stats_t re_cache_stats;
+
+  if (jerry_get_regexp_cache_stats (&re_cache_stats))
+  {
+    TEST_ASSERT (re_cache_stats.capacity == 2);
+    TEST_ASSERT (re_cache_stats.count == 0);
+
+    const char *re_cache_src_p = ("var a = new RegExp ('a');"
+                                  "var b = new RegExp ('b');"
+                                  "var a2 = new RegExp ('a');"
+                                  "var c = new RegExp ('c');"
+                                  "var b2 = new RegExp ('b', 'g');");
+    res = jerry_eval ((jerry_char_t *) re_cache_src_p, strlen (re_cache_src_p), false);
+    TEST_ASSERT (!jerry_value_has_error_flag (res));
+    jerry_release_value (res);
+
+    TEST_ASSERT (jerry_get_regexp_cache_stats (&re_cache_stats));
+    TEST_ASSERT (re_cache_stats.count == 2);
+    TEST_ASSERT (re_cache_stats.hits == 1);
+    TEST_ASSERT (re_cache_stats.misses == 4);
+    TEST_ASSERT (re_cache_stats.evictions == 2);
+
+    jerry_set_regexp_cache_size (0);
+
+    const char *re_no_cache_src_p = "new RegExp ('a')";
+    res = jerry_eval ((jerry_char_t *) re_no_cache_src_p, strlen (re_no_cache_src_p), false);
+    TEST_ASSERT (!jerry_value_has_error_flag (res));
+    jerry_release_value (res);
+
+    TEST_ASSERT (jerry_get_regexp_cache_stats (&re_cache_stats));
+    TEST_ASSERT (re_cache_stats.capacity == 0);
+    TEST_ASSERT (re_cache_stats.count == 0);
+    TEST_ASSERT (re_cache_stats.misses == 5);
+  }
+
+  jerry_cleanup ();
+
+  // Test: parse a source read in chunks
+  jerry_init (JERRY_INIT_EMPTY);
+
+  const char *stream_src_p = ("var sum = 0;\n"
+                              "for (var i = 0; i < 100; i++) { sum += i; }\n"
+                              "var text = 'árvíztűrő tükörfúrógép';\n"
+                              "/* long comment, which needs a larger buffer than the initial one of the engine "
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................"
+                              "................................................................................ */"
+                              "sum + text.length;");
+  const char *stream_cursor_p = stream_src_p;
+  parsed_code_val = jerry_parse_stream (read_source_chunk, &stream_cursor_p, false);
+  TEST_ASSERT (!jerry_value_has_error_flag (parsed_code_val));
+  TEST_ASSERT (*stream_cursor_p == '\0');
+
+  res = jerry_run (parsed_code_val);
+  TEST_ASSERT (jerry_value_is_number (res));
+  TEST_ASSERT (jerry_get_number_value (res) == 4972.0);
+  jerry_release_value (res);
+  jerry_release_value (parsed_code_val);
+
+  stream_src_p = "var a = ;";
+  stream_cursor_p = stream_src_p;
+  res = jerry_parse_stream (read_source_chunk, &stream_cursor_p, false);
+  TEST_ASSERT (jerry_value_has_error_flag (res));
+  jerry_release_value (res);
+
+  stream_src_p = "";
+  stream_cursor_p = stream_src_p;
+  parsed_code_val = jerry_parse_stream (read_source_chunk, &stream_cursor_p, false);
+  TEST_ASSERT (!jerry_value_has_error_flag (parsed_code_val));
+  res = jerry_run (parsed_code_val);
+  TEST_ASSERT (jerry_value_is_undefined (res));
+  jerry_release_value (res);
+  jerry_release_value (parsed_code_val);
+
+  jerry_cleanup ();
+
+  // Test: JSON parse and stringify
+  jerry_init (JERRY_INIT_EMPTY);
+
+  const char *json_src_p = "{ \"name\": \"jerry\", \"list\": [1, 2.5, true, null], \"nested\": {\"a\": \"\\u00e1\"} }";
+  obj_val = jerry_json_parse ((const jerry_char_t *) json_src_p, (jerry_size_t) strlen (json_src_p));
+  TEST_ASSERT (jerry_value_is_object (obj_val));
+
+  jerry_value_t json_prop_name = jerry_create_string ((const jerry_char_t *) "list");
+  res = jerry_get_property (obj_val, json_prop_name);
+  TEST_ASSERT (jerry_value_is_array (res));
+  TEST_ASSERT (jerry_get_array_length (res) == 4);
+  jerry_release_value (res);
+  jerry_release_value (json_prop_name);
+
+  json_buffer_t json_buffer;
+  json_buffer.size = 0;
+  json_buffer.calls = 0;
+  res = jerry_json_stringify (obj_val, write_json_chunk, &json_buffer);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  TEST_ASSERT (json_buffer.calls == 1);
+  TEST_ASSERT (!strcmp (json_buffer.text,
+                        "{\"name\":\"jerry\",\"list\":[1,2.5,true,null],\"nested\":{\"a\":\"\xc3\xa1\"}}"));
+  jerry_release_value (res);
+  jerry_release_value (obj_val);
+
+  json_src_p = "[1, 2,]";
+  res = jerry_json_parse ((const jerry_char_t *) json_src_p, (jerry_size_t) strlen (json_src_p));
+  TEST_ASSERT (jerry_value_has_error_flag (res));
+  jerry_release_value (res);
+
+  /* Values which are not plain data are serialized by the standard algorithm. */
+  const char *json_value_src_p = "var d = { toJSON: function () { return 'x'; } }; [d, new Number (5), undefined]";
+  val_t = jerry_eval ((const jerry_char_t *) json_value_src_p, strlen (json_value_src_p), false);
+  TEST_ASSERT (jerry_value_is_array (val_t));
+  json_buffer.size = 0;
+  res = jerry_json_stringify (val_t, write_json_chunk, &json_buffer);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  TEST_ASSERT (!strcmp (json_buffer.text, "[\"x\",5,null]"));
+  jerry_release_value (res);
+  jerry_release_value (val_t);
+
+  json_buffer.size = 0;
+  json_buffer.calls = 0;
+  val_t = jerry_create_undefined ();
+  res = jerry_json_stringify (val_t, write_json_chunk, &json_buffer);
+  TEST_ASSERT (jerry_value_is_undefined (res));
+  TEST_ASSERT (json_buffer.calls == 0);
+  jerry_release_value (res);
+
+  /* Functions have no JSON representation either. */
+  json_value_src_p = "(function () { return 1; })";
+  val_t = jerry_eval ((const jerry_char_t *) json_value_src_p, strlen (json_value_src_p), false);
+  TEST_ASSERT (jerry_value_is_function (val_t));
+  res = jerry_json_stringify (val_t, write_json_chunk, &json_buffer);
+  TEST_ASSERT (jerry_value_is_undefined (res));
+  TEST_ASSERT (json_buffer.calls == 0);
+  jerry_release_value (res);
+  jerry_release_value (val_t);
+
+  json_value_src_p = "var cycle = {}; cycle.self = cycle; cycle";
+  val_t = jerry_eval ((const jerry_char_t *) json_value_src_p, strlen (json_value_src_p), false);
+  res = jerry_json_stringify (val_t, write_json_chunk, &json_buffer);
+  TEST_ASSERT (jerry_value_has_error_flag (res));
+  TEST_ASSERT (json_buffer.calls == 0);
+  jerry_release_value (res);
+  jerry_release_value (val_t);
+
+  jerry_cleanup ();
+
+  // Test: lazily compiled functions
+  jerry_init (JERRY_INIT_LAZY_FUNCTIONS);
+
+  const char *lazy_error_src_p = "function f () { function g () { var a = ; } }";
+  res = jerry_parse ((jerry_char_t *) lazy_error_src_p, strlen (lazy_error_src_p), false);
+  TEST_ASSERT (jerry_value_has_error_flag (res));
+  jerry_release_value (res);
+
+  const char *lazy_src_p = ("function add (a, b, c) { return a + b + c; }\n"
+                            "function strict () { 'use strict'; return this; }\n"
+                            "var counters = [];\n"
+                            "for (var i = 0; i < 3; i++) {\n"
+                            "  counters.push (function (n) { return function () { return ++n; }; } (i * 10));\n"
+                            "}\n"
+                            "function fact (n) { return n <= 1 ? 1 : n * fact (n - 1); }\n"
+                            "var getter = { get value () { return add (1, 2, 3); } };\n"
+                            "var is_ok = (add.length === 3\n"
+                            "             && strict () === undefined\n"
+                            "             && counters[0] () === 1 && counters[2] () === 21 && counters[0] () === 2\n"
+                            "             && getter.value === 6);\n"
+                            "is_ok ? fact (5) : 0;");
+  parsed_code_val = jerry_parse ((jerry_char_t *) lazy_src_p, strlen (lazy_src_p), false);
+  TEST_ASSERT (!jerry_value_has_error_flag (parsed_code_val));
+
+  res = jerry_run (parsed_code_val);
+  TEST_ASSERT (jerry_value_is_number (res));
+  TEST_ASSERT (jerry_get_number_value (res) == 120.0);
+  jerry_release_value (res);
+  jerry_release_value (parsed_code_val);
+
+  jerry_cleanup ();
+
   return 0;
 } /* main */
@@ -39,6 +39,9 @@ main ()
     (const lit_utf8_byte_t *) "-Infinity",
     (const lit_utf8_byte_t *) "0",
     (const lit_utf8_byte_t *) "0",
+    (const lit_utf8_byte_t *) "16777215",
+    (const lit_utf8_byte_t *) "2.9802322387695312e-8",
+    (const lit_utf8_byte_t *) "0.13167190551757812",
   };
 
   const ecma_number_t nums[] =
@@ -53,7 +56,10 @@ main ()
     (ecma_number_t) INFINITY,
     (ecma_number_t) -INFINITY,
     (ecma_number_t) +0.0,
-    (ecma_number_t) -0.0
+    (ecma_number_t) -0.0,
+    (ecma_number_t) 16777215.0,
+    (ecma_number_t) 2.98023223876953125e-8,
+    (ecma_number_t) 0.131671905517578125
   };
 
   for (uint32_t i = 0;
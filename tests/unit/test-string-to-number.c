@@ -48,6 +48,14 @@ main ()
     (const jerry_char_t *) "-Infinity",
     (const jerry_char_t *) "0",
     (const jerry_char_t *) "0",
+    (const jerry_char_t *) "Inf",
+    (const jerry_char_t *) ".",
+    (const jerry_char_t *) "e5",
+    (const jerry_char_t *) " .5 ",
+    (const jerry_char_t *) "1608882928643910.2",
+    (const jerry_char_t *) "9007199254740993",
+    (const jerry_char_t *) "0x20000000000003",
+    (const jerry_char_t *) "12345678901234567890123",
   };
 
   const ecma_number_t nums[] =
@@ -69,7 +77,15 @@ main ()
     (ecma_number_t) INFINITY,
     (ecma_number_t) -INFINITY,
     (ecma_number_t) +0.0,
-    (ecma_number_t) -0.0
+    (ecma_number_t) -0.0,
+    (ecma_number_t) NAN,
+    (ecma_number_t) NAN,
+    (ecma_number_t) NAN,
+    (ecma_number_t) 0.5,
+    (ecma_number_t) 1608882928643910.2,
+    (ecma_number_t) 9007199254740993.0,
+    (ecma_number_t) 9007199254740996.0,
+    (ecma_number_t) 12345678901234567890123.0
   };
 
   for (uint32_t i = 0;
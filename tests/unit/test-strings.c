@@ -198,6 +198,24 @@ main ()
   lit_utf8_byte_t valid_utf8_string_1[] = {0xED, 0xA4, 0x81};
   TEST_ASSERT (lit_is_cesu8_string_valid (valid_utf8_string_1, sizeof (valid_utf8_string_1)));
 
+  /* Non-ascii characters inside long ascii runs, at every alignment */
+  lit_utf8_byte_t ascii_run_string[64];
+
+  for (lit_utf8_size_t offset = 0; offset + 3 <= sizeof (ascii_run_string); offset++)
+  {
+    memset (ascii_run_string, 'a', sizeof (ascii_run_string));
+    TEST_ASSERT (lit_is_cesu8_string_valid (ascii_run_string, sizeof (ascii_run_string)));
+    TEST_ASSERT (lit_utf8_string_length (ascii_run_string, sizeof (ascii_run_string)) == sizeof (ascii_run_string));
+
+    lit_code_unit_to_utf8 (0xD7FF, ascii_run_string + offset);
+    TEST_ASSERT (lit_is_cesu8_string_valid (ascii_run_string, sizeof (ascii_run_string)));
+    TEST_ASSERT (lit_utf8_string_length (ascii_run_string, sizeof (ascii_run_string)) == sizeof (ascii_run_string) - 2);
+
+    ascii_run_string[offset + 1] = (lit_utf8_byte_t) 'a';
+    TEST_ASSERT (!lit_is_cesu8_string_valid (ascii_run_string, sizeof (ascii_run_string)));
+    TEST_ASSERT (!lit_is_utf8_string_valid (ascii_run_string, sizeof (ascii_run_string)));
+  }
+
   lit_utf8_byte_t res_buf[3];
   lit_utf8_size_t res_size;
 